@@ -249,7 +249,8 @@ struct PreconditionerBenchmark : Benchmark<preconditioner_benchmark_state> {
             auto apply_logger = create_operations_logger(
                 FLAGS_gpu_timer, FLAGS_nested_names, exec,
                 precond_case["apply"]["components"],
-                ic_apply.get_num_repetitions());
+                ic_apply.get_num_repetitions(),
+                FLAGS_roofline ? &precond_case["apply"]["roofline"] : nullptr);
             exec->add_logger(apply_logger);
             if (exec->get_master() != exec) {
                 exec->get_master()->add_logger(apply_logger);
@@ -38,9 +38,9 @@ DEFINE_string(solvers, "cg",
               "A comma-separated list of solvers to run. "
               "Supported values are: bicgstab, bicg, cb_gmres_keep, "
               "cb_gmres_reduce1, cb_gmres_reduce2, cb_gmres_integer, "
-              "cb_gmres_ireduce1, cb_gmres_ireduce2, cg, cgs, fcg, gmres, idr, "
-              "lower_trs, upper_trs, spd_direct, symm_direct, "
-              "near_symm_direct, direct, overhead");
+              "cb_gmres_ireduce1, cb_gmres_ireduce2, cb_gmres_adaptive, cg, "
+              "cgs, fcg, gmres, idr, lower_trs, upper_trs, spd_direct, "
+              "symm_direct, near_symm_direct, direct, overhead");
 
 DEFINE_uint32(
     nrhs, 1,
@@ -163,6 +163,8 @@ std::unique_ptr<gko::LinOpFactory> generate_solver(
             s_prec = gko::solver::cb_gmres::storage_precision::ireduce1;
         } else if (spec == "ireduce2") {
             s_prec = gko::solver::cb_gmres::storage_precision::ireduce2;
+        } else if (spec == "adaptive") {
+            s_prec = gko::solver::cb_gmres::storage_precision::adaptive;
         } else {
             throw std::range_error(
                 std::string(
@@ -512,7 +514,9 @@ struct SolverBenchmark : Benchmark<solver_benchmark_state<Generator>> {
             {
                 auto apply_logger = create_operations_logger(
                     FLAGS_gpu_timer, FLAGS_nested_names, exec,
-                    solver_case["apply"]["components"], 1);
+                    solver_case["apply"]["components"], 1,
+                    FLAGS_roofline ? &solver_case["apply"]["roofline"]
+                                   : nullptr);
                 exec->add_logger(apply_logger);
                 if (exec != exec->get_master()) {
                     exec->get_master()->add_logger(apply_logger);
@@ -143,7 +143,8 @@ struct SparseBlasBenchmark : Benchmark<std::unique_ptr<Mtx>> {
             operation_case["components"] = json::object();
             auto gen_logger = create_operations_logger(
                 FLAGS_gpu_timer, FLAGS_nested_names, exec,
-                operation_case["components"], repetitions);
+                operation_case["components"], repetitions,
+                FLAGS_roofline ? &operation_case["roofline"] : nullptr);
             exec->add_logger(gen_logger);
             for (unsigned i = 0; i < repetitions; i++) {
                 op->run();
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/mtx_io.hpp>
+
+
+template <typename Reader>
+void benchmark(const char* name, const char* input, std::size_t file_size,
+               int repetitions, Reader reader)
+{
+    double total_time{};
+    gko::size_type num_entries{};
+    for (int i = 0; i < repetitions; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        num_entries = reader(input);
+        const auto stop = std::chrono::steady_clock::now();
+        total_time += std::chrono::duration<double>(stop - start).count();
+    }
+    const auto time = total_time / repetitions;
+    std::cout << name << ": " << time << " s, " << num_entries / time
+              << " entries/s, " << file_size / time / 1e6 << " MB/s\n";
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [input] [num_threads] [repetitions]\n"
+                     "Compares the time it takes to read the input file in "
+                     "MatrixMarket format sequentially and with the parallel "
+                     "reader using num_threads threads (default: all hardware "
+                     "threads), averaged over the given number of "
+                     "repetitions (default: 1).\n";
+        return 1;
+    }
+    const auto input = argv[1];
+    const auto num_threads =
+        argc > 2 ? static_cast<gko::size_type>(std::atoi(argv[2])) : 0;
+    const auto repetitions = argc > 3 ? std::atoi(argv[3]) : 1;
+    std::size_t file_size{};
+    std::string header;
+    {
+        std::ifstream is(input, std::ios::binary | std::ios::ate);
+        file_size = is.tellg();
+        is.seekg(0);
+        std::getline(is, header);
+    }
+    const auto is_complex = header.find("complex") != std::string::npos;
+    try {
+        benchmark("sequential", input, file_size, repetitions,
+                  [&](const char* filename) {
+                      std::ifstream is(filename);
+                      if (is_complex) {
+                          return gko::read_raw<std::complex<double>,
+                                               gko::int64>(is)
+                              .nonzeros.size();
+                      }
+                      return gko::read_raw<double, gko::int64>(is)
+                          .nonzeros.size();
+                  });
+        benchmark("parallel", input, file_size, repetitions,
+                  [&](const char* filename) {
+                      if (is_complex) {
+                          return gko::read_raw_parallel<std::complex<double>,
+                                                        gko::int64>(
+                                     filename, num_threads)
+                              .nonzeros.size();
+                      }
+                      return gko::read_raw_parallel<double, gko::int64>(
+                                 filename, num_threads)
+                          .nonzeros.size();
+                  });
+    } catch (gko::Error& err) {
+        std::cerr << err.what() << '\n';
+        return 2;
+    }
+}
@@ -43,8 +43,9 @@ DEFINE_string(executor, "reference",
               "omp, cuda, hip");
 
 DEFINE_string(allocator, "default",
-              "The allocator used in the executor. Only relevant for CUDA and "
-              "HIP executors, one of: default, async, host, unified");
+              "The allocator used in the executor. For CUDA and HIP executors "
+              "one of: default, async, host, unified. For reference and OMP "
+              "executors one of: default, caching, numa, numa_huge");
 
 DEFINE_uint32(device_id, 0, "ID of the device where to run the code");
 
@@ -71,6 +72,11 @@ DEFINE_bool(detailed, true,
 
 DEFINE_bool(nested_names, false, "If set, separately logs nested operations");
 
+DEFINE_bool(roofline, false,
+            "If set, the detailed run additionally stores the reported FLOP "
+            "and byte counts as well as the achieved GFLOP/s and GB/s of each "
+            "operation in a 'roofline' object");
+
 DEFINE_bool(profile, false,
             "If set, enables profiler mode: 1 repetition, 0 warmup "
             "repetitions, detailed=false, profiler_hook=auto (if it is not "
@@ -79,7 +85,8 @@ DEFINE_bool(profile, false,
 DEFINE_string(
     profiler_hook, "none",
     "Which profiler annotation mode to use, if any. Options are "
-    "none, nvtx, roctx, vtune, tau, debug, auto (choose based on executor).");
+    "none, nvtx, roctx, vtune, tau, debug, trace (write a Chrome trace to "
+    "ginkgo_trace.json), auto (choose based on executor).");
 
 DEFINE_uint32(seed, 42, "Seed used for the random number generator");
 
@@ -204,6 +211,8 @@ std::shared_ptr<gko::log::ProfilerHook> create_profiler_hook(
             {"roctx", [] { return ProfilerHook::create_roctx(); }},
             {"tau", [] { return ProfilerHook::create_tau(); }},
             {"vtune", [] { return ProfilerHook::create_vtune(); }},
+            {"trace",
+             [] { return ProfilerHook::create_trace("ginkgo_trace.json"); }},
             {"debug", [] {
                  return ProfilerHook::create_custom(
                      [](const char* name, gko::log::profile_event_category) {
@@ -294,6 +303,21 @@ void backup_results(json& results)
 }
 
 
+inline std::shared_ptr<gko::CpuAllocatorBase> create_cpu_allocator()
+{
+    std::string flag{FLAGS_allocator};
+    if (flag == "caching") {
+        return std::make_shared<gko::CachingCpuAllocator>();
+    } else if (flag == "numa") {
+        return std::make_shared<gko::NumaCpuAllocator>(64, false, true);
+    } else if (flag == "numa_huge") {
+        return std::make_shared<gko::NumaCpuAllocator>(64, true, true);
+    } else {
+        return std::make_shared<gko::CpuAllocator>();
+    }
+}
+
+
 inline std::shared_ptr<gko::CudaAllocatorBase> create_cuda_allocator()
 {
     std::string flag{FLAGS_allocator};
@@ -331,8 +355,12 @@ inline std::shared_ptr<gko::HipAllocatorBase> create_hip_allocator()
 // executor mapping
 const std::map<std::string, std::function<std::shared_ptr<gko::Executor>(bool)>>
     executor_factory{
-        {"reference", [](bool) { return gko::ReferenceExecutor::create(); }},
-        {"omp", [](bool) { return gko::OmpExecutor::create(); }},
+        {"reference",
+         [](bool) {
+             return gko::ReferenceExecutor::create(create_cpu_allocator());
+         }},
+        {"omp",
+         [](bool) { return gko::OmpExecutor::create(create_cpu_allocator()); }},
         {"cuda",
          [](bool) {
              return gko::CudaExecutor::create(FLAGS_device_id,
@@ -363,8 +391,13 @@ const std::map<std::string,
                std::function<std::shared_ptr<gko::Executor>(MPI_Comm)>>
     executor_factory_mpi{
         {"reference",
-         [](MPI_Comm) { return gko::ReferenceExecutor::create(); }},
-        {"omp", [](MPI_Comm) { return gko::OmpExecutor::create(); }},
+         [](MPI_Comm) {
+             return gko::ReferenceExecutor::create(create_cpu_allocator());
+         }},
+        {"omp",
+         [](MPI_Comm) {
+             return gko::OmpExecutor::create(create_cpu_allocator());
+         }},
         {"cuda",
          [](MPI_Comm comm) {
              FLAGS_device_id = gko::experimental::mpi::map_rank_to_device_id(
@@ -22,10 +22,25 @@
 
 struct JsonSummaryWriter : gko::log::ProfilerHook::SummaryWriter,
                            gko::log::ProfilerHook::NestedSummaryWriter {
-    JsonSummaryWriter(json& object, gko::uint32 repetitions)
-        : object{&object}, repetitions{repetitions}
+    JsonSummaryWriter(json& object, gko::uint32 repetitions,
+                      json* roofline = nullptr)
+        : object{&object}, repetitions{repetitions}, roofline{roofline}
     {}
 
+    void write_roofline(const std::string& name, gko::size_type flops,
+                        gko::size_type bytes, std::chrono::nanoseconds time)
+    {
+        if (!roofline || bytes == 0) {
+            return;
+        }
+        const auto seconds = time.count() * 1e-9;
+        auto& entry = (*roofline)[name];
+        entry["flops"] = static_cast<double>(flops) / repetitions;
+        entry["bytes"] = static_cast<double>(bytes) / repetitions;
+        entry["gflops"] = seconds > 0 ? flops * 1e-9 / seconds : 0.0;
+        entry["gbps"] = seconds > 0 ? bytes * 1e-9 / seconds : 0.0;
+    }
+
     void write(
         const std::vector<gko::log::ProfilerHook::summary_entry>& entries,
         std::chrono::nanoseconds overhead) override
@@ -34,6 +49,8 @@ struct JsonSummaryWriter : gko::log::ProfilerHook::SummaryWriter,
             if (entry.name != "total") {
                 (*object)[entry.name] =
                     entry.exclusive.count() * 1e-9 / repetitions;
+                write_roofline(entry.name, entry.flops, entry.bytes,
+                               entry.inclusive);
             }
         }
         (*object)["overhead"] = overhead.count() * 1e-9 / repetitions;
@@ -54,6 +71,8 @@ struct JsonSummaryWriter : gko::log::ProfilerHook::SummaryWriter,
             }
             (*object)[prefix + node.name] =
                 exclusive.count() * 1e-9 / repetitions;
+            write_roofline(prefix + node.name, node.flops, node.bytes,
+                           node.elapsed);
         };
         // we don't need to annotate the total
         for (const auto& child : root.children) {
@@ -64,12 +83,13 @@ struct JsonSummaryWriter : gko::log::ProfilerHook::SummaryWriter,
 
     json* object;
     gko::uint32 repetitions;
+    json* roofline;
 };
 
 
 inline std::shared_ptr<gko::log::ProfilerHook> create_operations_logger(
     bool gpu_timer, bool nested, std::shared_ptr<gko::Executor> exec,
-    json& object, gko::uint32 repetitions)
+    json& object, gko::uint32 repetitions, json* roofline = nullptr)
 {
     std::shared_ptr<gko::Timer> timer;
     if (gpu_timer) {
@@ -79,10 +99,12 @@ inline std::shared_ptr<gko::log::ProfilerHook> create_operations_logger(
     }
     if (nested) {
         return gko::log::ProfilerHook::create_nested_summary(
-            timer, std::make_unique<JsonSummaryWriter>(object, repetitions));
+            timer, std::make_unique<JsonSummaryWriter>(object, repetitions,
+                                                       roofline));
     } else {
         return gko::log::ProfilerHook::create_summary(
-            timer, std::make_unique<JsonSummaryWriter>(object, repetitions));
+            timer, std::make_unique<JsonSummaryWriter>(object, repetitions,
+                                                       roofline));
     }
 }
 
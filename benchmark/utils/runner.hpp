@@ -29,6 +29,8 @@ std::shared_ptr<gko::log::ProfilerHook> create_profiler_hook(
             {"roctx", [] { return ProfilerHook::create_roctx(); }},
             {"tau", [] { return ProfilerHook::create_tau(); }},
             {"vtune", [] { return ProfilerHook::create_vtune(); }},
+            {"trace",
+             [] { return ProfilerHook::create_trace("ginkgo_trace.json"); }},
             {"debug", [do_print] {
                  return ProfilerHook::create_custom(
                      [do_print](const char* name,
@@ -8,6 +8,7 @@
 #include <ginkgo/core/base/math.hpp>
 
 
+#include "common/unified/base/kernel_launch_reduction.hpp"
 #include "common/unified/base/kernel_launch_solver.hpp"
 
 
@@ -164,6 +165,43 @@ void step_3(
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_3_KERNEL);
 
 
+template <typename ValueType>
+void step_3_and_dot(
+    std::shared_ptr<const DefaultExecutor> exec, matrix::Dense<ValueType>* x,
+    matrix::Dense<ValueType>* r, const matrix::Dense<ValueType>* s,
+    const matrix::Dense<ValueType>* t, const matrix::Dense<ValueType>* y,
+    const matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* rr,
+    const matrix::Dense<ValueType>* alpha, const matrix::Dense<ValueType>* beta,
+    const matrix::Dense<ValueType>* gamma, matrix::Dense<ValueType>* omega,
+    matrix::Dense<ValueType>* new_rho, array<char>& tmp,
+    const array<stopping_status>* stop_status)
+{
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto r, auto s, auto t,
+                      auto y, auto z, auto rr, auto alpha, auto beta,
+                      auto gamma, auto omega, auto stop) {
+            auto r_val = r(row, col);
+            if (!stop[col].has_stopped()) {
+                auto tmp = safe_divide(gamma[col], beta[col]);
+                if (row == 0) {
+                    omega[col] = tmp;
+                }
+                x(row, col) += alpha[col] * y(row, col) + tmp * z(row, col);
+                r_val = s(row, col) - tmp * t(row, col);
+                r(row, col) = r_val;
+            }
+            return conj(rr(row, col)) * r_val;
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), new_rho->get_values(), x->get_size(),
+        tmp, x, r, s, t, y, z, rr, alpha->get_const_values(),
+        beta->get_const_values(), gamma->get_const_values(),
+        omega->get_values(), stop_status->get_const_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_3_AND_DOT_KERNEL);
+
+
 template <typename ValueType>
 void finalize(std::shared_ptr<const DefaultExecutor> exec,
               matrix::Dense<ValueType>* x, const matrix::Dense<ValueType>* y,
@@ -8,6 +8,7 @@
 #include <ginkgo/core/base/math.hpp>
 
 
+#include "common/unified/base/kernel_launch_reduction.hpp"
 #include "common/unified/base/kernel_launch_solver.hpp"
 
 
@@ -118,6 +119,40 @@ void step_2(std::shared_ptr<const DefaultExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_FCG_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void step_2_and_dot(std::shared_ptr<const DefaultExecutor> exec,
+                    matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+                    matrix::Dense<ValueType>* t,
+                    const matrix::Dense<ValueType>* p,
+                    const matrix::Dense<ValueType>* q,
+                    const matrix::Dense<ValueType>* beta,
+                    const matrix::Dense<ValueType>* rho,
+                    matrix::Dense<ValueType>* new_rho, array<char>& tmp,
+                    const array<stopping_status>* stop_status)
+{
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto r, auto t, auto p,
+                      auto q, auto beta, auto rho, auto stop) {
+            auto r_val = r(row, col);
+            if (!stop[col].has_stopped() && is_nonzero(beta[col])) {
+                auto tmp = rho[col] / beta[col];
+                auto prev_r = r_val;
+                x(row, col) += tmp * p(row, col);
+                r_val -= tmp * q(row, col);
+                r(row, col) = r_val;
+                t(row, col) = r_val - prev_r;
+            }
+            return conj(r_val) * r_val;
+        },
+        GKO_KERNEL_REDUCE_SUM(ValueType), new_rho->get_values(), x->get_size(),
+        tmp, x, r, t, p, q, beta->get_const_values(), rho->get_const_values(),
+        stop_status->get_const_data());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_FCG_STEP_2_AND_DOT_KERNEL);
+
+
 }  // namespace fcg
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
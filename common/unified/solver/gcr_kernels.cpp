@@ -8,6 +8,7 @@
 #include <ginkgo/core/base/math.hpp>
 
 
+#include "common/unified/base/kernel_launch_reduction.hpp"
 #include "common/unified/base/kernel_launch_solver.hpp"
 
 
@@ -109,6 +110,38 @@ void step_1(std::shared_ptr<const DefaultExecutor> exec,
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GCR_STEP_1_KERNEL);
 
+
+template <typename ValueType>
+void step_1_and_norm(
+    std::shared_ptr<const DefaultExecutor> exec, matrix::Dense<ValueType>* x,
+    matrix::Dense<ValueType>* residual, const matrix::Dense<ValueType>* p,
+    const matrix::Dense<ValueType>* Ap,
+    const matrix::Dense<remove_complex<ValueType>>* Ap_norm,
+    const matrix::Dense<ValueType>* rAp,
+    matrix::Dense<remove_complex<ValueType>>* residual_norm, array<char>& tmp,
+    const stopping_status* stop_status)
+{
+    run_kernel_col_reduction_cached(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto x, auto residual, auto p,
+                      auto Ap, auto Ap_norm, auto rAp, auto stop) {
+            auto res = residual(row, col);
+            if (!stop[col].has_stopped()) {
+                auto tmp = rAp[col] / Ap_norm[col];
+                x(row, col) += tmp * p(row, col);
+                res -= tmp * Ap(row, col);
+                residual(row, col) = res;
+            }
+            return squared_norm(res);
+        },
+        [] GKO_KERNEL(auto a, auto b) { return a + b; },
+        [] GKO_KERNEL(auto a) { return sqrt(a); }, remove_complex<ValueType>{},
+        residual_norm->get_values(), x->get_size(), tmp, x, residual, p, Ap,
+        Ap_norm->get_const_values(), rAp->get_const_values(), stop_status);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GCR_STEP_1_AND_NORM_KERNEL);
+
 }  // namespace gcr
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
@@ -28,4 +28,124 @@ void CpuAllocator::deallocate(void* ptr)
 }
 
 
+namespace {
+
+
+size_type get_size_class(size_type num_bytes)
+{
+    size_type size_class{};
+    while ((CachingCpuAllocator::min_block_size << size_class) < num_bytes) {
+        size_class++;
+    }
+    return size_class;
+}
+
+
+}  // namespace
+
+
+CachingCpuAllocator::CachingCpuAllocator(
+    size_type max_cached_bytes, size_type max_block_size,
+    std::shared_ptr<CpuAllocatorBase> upstream)
+    : max_cached_bytes_{max_cached_bytes},
+      max_block_size_{max_block_size},
+      upstream_{std::move(upstream)},
+      stats_{}
+{}
+
+
+CachingCpuAllocator::~CachingCpuAllocator() { this->trim(); }
+
+
+void* CachingCpuAllocator::allocate(size_type num_bytes)
+{
+    const auto size_class = get_size_class(num_bytes);
+    const auto block_size = min_block_size << size_class;
+    const auto cacheable = block_size <= max_block_size_;
+    void* ptr{};
+    bool hit{};
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        if (cacheable && size_class < free_blocks_.size() &&
+            !free_blocks_[size_class].empty()) {
+            ptr = free_blocks_[size_class].back();
+            free_blocks_[size_class].pop_back();
+            stats_.cached_bytes -= block_size;
+            hit = true;
+        }
+    }
+    const auto alloc_size = cacheable ? block_size : num_bytes;
+    if (!hit) {
+        ptr = upstream_->allocate(alloc_size);
+    }
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        block_sizes_.emplace(ptr, std::make_pair(alloc_size, cacheable));
+        stats_.used_bytes += alloc_size;
+        (hit ? stats_.num_hits : stats_.num_misses)++;
+    }
+    this->template log<log::Logger::cached_allocation_completed>(
+        this, num_bytes, reinterpret_cast<uintptr>(ptr), hit);
+    return ptr;
+}
+
+
+void CachingCpuAllocator::deallocate(void* ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        const auto it = block_sizes_.find(ptr);
+        GKO_ASSERT(it != block_sizes_.end());
+        const auto block_size = it->second.first;
+        const auto cacheable = it->second.second;
+        block_sizes_.erase(it);
+        stats_.used_bytes -= block_size;
+        if (cacheable && stats_.cached_bytes + block_size <= max_cached_bytes_) {
+            const auto size_class = get_size_class(block_size);
+            if (free_blocks_.size() <= size_class) {
+                free_blocks_.resize(size_class + 1);
+            }
+            free_blocks_[size_class].push_back(ptr);
+            stats_.cached_bytes += block_size;
+            return;
+        }
+    }
+    upstream_->deallocate(ptr);
+}
+
+
+void CachingCpuAllocator::trim(size_type max_cached_bytes)
+{
+    std::vector<void*> released;
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        // release the largest blocks first
+        for (auto size_class = free_blocks_.size();
+             size_class > 0 && stats_.cached_bytes > max_cached_bytes;
+             --size_class) {
+            auto& blocks = free_blocks_[size_class - 1];
+            const auto block_size = min_block_size << (size_class - 1);
+            while (!blocks.empty() && stats_.cached_bytes > max_cached_bytes) {
+                released.push_back(blocks.back());
+                blocks.pop_back();
+                stats_.cached_bytes -= block_size;
+            }
+        }
+    }
+    for (auto ptr : released) {
+        upstream_->deallocate(ptr);
+    }
+}
+
+
+CachingCpuAllocator::statistics CachingCpuAllocator::get_statistics() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return stats_;
+}
+
+
 }  // namespace gko
@@ -7,17 +7,41 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
+#include <numeric>
 #include <regex>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GKO_HAVE_MMAP 1
+#endif
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 
 
 namespace gko {
@@ -37,6 +61,151 @@ namespace {
     }
 
 
+/**
+ * Provides access to the contents of a file, memory-mapped if supported.
+ * The mapping is private, so writes to it are not carried through to the
+ * file, and pages are only copied once they are written to.
+ */
+class mapped_file {
+public:
+    explicit mapped_file(const std::string& filename)
+    {
+#ifdef GKO_HAVE_MMAP
+        const auto fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw GKO_STREAM_ERROR("error when opening " + filename);
+        }
+        struct stat file_stat {};
+        if (::fstat(fd, &file_stat) != 0) {
+            ::close(fd);
+            throw GKO_STREAM_ERROR("error when reading the size of " +
+                                   filename);
+        }
+        size_ = static_cast<size_type>(file_stat.st_size);
+        if (size_ > 0) {
+            auto map = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                ::close(fd);
+                throw GKO_STREAM_ERROR("error when mapping " + filename);
+            }
+            ::madvise(map, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<char*>(map);
+        }
+        ::close(fd);
+#else
+        std::ifstream stream(filename, std::ios::binary);
+        GKO_CHECK_STREAM(stream, "error when opening " + filename);
+        buffer_.assign(std::istreambuf_iterator<char>(stream),
+                       std::istreambuf_iterator<char>());
+        GKO_CHECK_MATCH(!stream.bad(), "error when reading " + filename);
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#endif
+    }
+
+    ~mapped_file()
+    {
+#ifdef GKO_HAVE_MMAP
+        if (data_) {
+            ::munmap(data_, size_);
+        }
+#endif
+    }
+
+    mapped_file(const mapped_file&) = delete;
+
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    char* get_data() { return data_; }
+
+    size_type get_size() const { return size_; }
+
+    const char* begin() const { return data_; }
+
+    const char* end() const { return data_ + size_; }
+
+private:
+    char* data_{};
+    size_type size_{};
+#ifndef GKO_HAVE_MMAP
+    std::vector<char> buffer_;
+#endif
+};
+
+
+bool is_blank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+
+const char* skip_blanks(const char* pos, const char* end)
+{
+    return std::find_if_not(pos, end, is_blank);
+}
+
+
+/**
+ * Parses a non-negative integer and advances pos past it.
+ */
+template <typename IndexType>
+IndexType parse_index(const char*& pos, const char* end)
+{
+    pos = skip_blanks(pos, end);
+    if (pos == end || *pos < '0' || *pos > '9') {
+        throw GKO_STREAM_ERROR("error when parsing a matrix index");
+    }
+    int64 value{};
+    for (; pos != end && *pos >= '0' && *pos <= '9'; ++pos) {
+        value = value * 10 + (*pos - '0');
+    }
+    return static_cast<IndexType>(value);
+}
+
+
+/**
+ * Parses a floating point number and advances pos past it.
+ */
+double parse_value(const char*& pos, const char* end)
+{
+    pos = skip_blanks(pos, end);
+    const auto token_end = std::find_if(
+        pos, end, [](char c) { return is_blank(c) || c == '\n'; });
+    // strtod needs a null-terminated string, the mapped file has none
+    char buffer[64];
+    const auto length = static_cast<size_type>(token_end - pos);
+    if (length == 0 || length >= sizeof(buffer)) {
+        throw GKO_STREAM_ERROR("error when parsing a matrix entry");
+    }
+    std::memcpy(buffer, pos, length);
+    buffer[length] = '\0';
+    char* parsed_end{};
+    const auto value = std::strtod(buffer, &parsed_end);
+    if (parsed_end != buffer + length) {
+        throw GKO_STREAM_ERROR("error when parsing a matrix entry");
+    }
+    pos = token_end;
+    return value;
+}
+
+
+/**
+ * Runs fn(i) for every i in [0, num_tasks) on its own thread.
+ */
+template <typename Function>
+void run_parallel(size_type num_tasks, Function fn)
+{
+    std::vector<std::thread> threads;
+    for (size_type i = 1; i < num_tasks; ++i) {
+        threads.emplace_back(fn, i);
+    }
+    if (num_tasks > 0) {
+        fn(0);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+
 /**
  * The mtx_io class provides the functionality of reading and writing matrix
  * market format files.
@@ -74,6 +243,200 @@ public:
         return data;
     }
 
+    /**
+     * Reads a matrix from a stream in chunks of bounded size.
+     *
+     * Only the entries of the current chunk are kept in memory for coordinate
+     * layout files. Array layout files are read completely before they are
+     * split into chunks.
+     *
+     * @param is  the input stream.
+     * @param chunk_size  the maximum number of entries per chunk.
+     * @param size_fn  called with the matrix size and an upper bound on the
+     *                 number of entries before the first chunk is read.
+     * @param chunk_fn  called with each chunk of entries in file order.
+     */
+    void read_chunked(
+        std::istream& is, size_type chunk_size,
+        const std::function<void(dim<2>, size_type)>& size_fn,
+        const std::function<void(const matrix_data<ValueType, IndexType>&)>&
+            chunk_fn) const
+    {
+        // a symmetric entry can be inserted twice
+        chunk_size = std::max<size_type>(chunk_size, 2);
+        auto parsed_header = this->read_header(is);
+        std::istringstream dimensions_stream(parsed_header.dimensions_line);
+        if (parsed_header.layout != &coordinate_layout) {
+            auto data = parsed_header.layout->read_data(
+                dimensions_stream, is, parsed_header.entry,
+                parsed_header.modifier);
+            const auto num_entries = data.nonzeros.size();
+            size_fn(data.size, num_entries);
+            matrix_data<ValueType, IndexType> chunk{data.size};
+            for (size_type begin = 0; begin < num_entries;
+                 begin += chunk_size) {
+                const auto end = std::min(begin + chunk_size, num_entries);
+                chunk.nonzeros.assign(data.nonzeros.begin() + begin,
+                                      data.nonzeros.begin() + end);
+                chunk_fn(chunk);
+            }
+            return;
+        }
+        size_type num_rows{};
+        size_type num_cols{};
+        size_type num_nonzeros{};
+        GKO_CHECK_STREAM(
+            dimensions_stream >> num_rows >> num_cols >> num_nonzeros,
+            "error when determining matrix size, expected: rows cols nnz");
+        const size_type max_inserted =
+            parsed_header.modifier == &general_modifier ? 1 : 2;
+        size_fn(dim<2>{num_rows, num_cols}, max_inserted * num_nonzeros);
+        matrix_data<ValueType, IndexType> chunk{dim<2>{num_rows, num_cols}};
+        chunk.nonzeros.reserve(std::min(chunk_size, num_nonzeros));
+        for (size_type i = 0; i < num_nonzeros; ++i) {
+            IndexType row{};
+            IndexType col{};
+            GKO_CHECK_STREAM(is >> row >> col,
+                             "error when reading coordinates of matrix entry " +
+                                 std::to_string(i));
+            auto entry = parsed_header.entry->read_entry(is);
+            GKO_CHECK_STREAM(
+                is, "error when reading matrix entry " + std::to_string(i));
+            if (chunk.nonzeros.size() + max_inserted > chunk_size) {
+                chunk_fn(chunk);
+                chunk.nonzeros.clear();
+            }
+            parsed_header.modifier->insert_entry(row - 1, col - 1, entry,
+                                                 chunk);
+        }
+        if (!chunk.nonzeros.empty()) {
+            chunk_fn(chunk);
+        }
+    }
+
+    /**
+     * Reads a matrix from a character range using multiple threads.
+     *
+     * The entries of coordinate layout files are split at line boundaries
+     * into one chunk per thread, which is parsed and sorted independently
+     * before the chunks are merged. Array layout files are read sequentially.
+     *
+     * @param begin  the beginning of the file contents.
+     * @param end  the end of the file contents.
+     * @param num_threads  the number of threads to use.
+     *
+     * @return the matrix data.
+     */
+    matrix_data<ValueType, IndexType> read_parallel(
+        const char* begin, const char* end, size_type num_threads) const
+    {
+        // the header consists of the description line, comments and the
+        // dimensions line
+        auto pos = begin;
+        bool is_description = true;
+        bool is_comment = true;
+        while (pos != end && is_comment) {
+            const auto line_end = std::find(pos, end, '\n');
+            is_comment = is_description || *pos == '%';
+            is_description = false;
+            pos = line_end == end ? end : line_end + 1;
+        }
+        std::istringstream header_stream(std::string(begin, pos));
+        auto parsed_header = this->read_header(header_stream);
+        std::istringstream dimensions_stream(parsed_header.dimensions_line);
+        if (parsed_header.layout != &coordinate_layout) {
+            std::istringstream content(std::string(pos, end));
+            auto data = parsed_header.layout->read_data(
+                dimensions_stream, content, parsed_header.entry,
+                parsed_header.modifier);
+            data.sort_row_major();
+            return data;
+        }
+        size_type num_rows{};
+        size_type num_cols{};
+        size_type num_nonzeros{};
+        GKO_CHECK_STREAM(
+            dimensions_stream >> num_rows >> num_cols >> num_nonzeros,
+            "error when determining matrix size, expected: rows cols nnz");
+        const dim<2> size{num_rows, num_cols};
+
+        // split the entries at line boundaries
+        num_threads = std::max<size_type>(
+            1, std::min<size_type>(num_threads, (end - pos) / 4096 + 1));
+        std::vector<const char*> chunk_bounds(num_threads + 1, end);
+        chunk_bounds[0] = pos;
+        for (size_type i = 1; i < num_threads; ++i) {
+            const auto split = std::max(
+                chunk_bounds[i - 1], pos + (end - pos) * i / num_threads);
+            const auto line_end = std::find(split, end, '\n');
+            chunk_bounds[i] = line_end == end ? end : line_end + 1;
+        }
+        std::vector<matrix_data<ValueType, IndexType>> chunks(
+            num_threads, matrix_data<ValueType, IndexType>{size});
+        std::vector<size_type> chunk_nnz(num_threads);
+        std::vector<std::exception_ptr> errors(num_threads);
+        auto parse_chunk = [&](size_type chunk) {
+            try {
+                auto line = chunk_bounds[chunk];
+                const auto chunk_end = chunk_bounds[chunk + 1];
+                auto& data = chunks[chunk];
+                while (line != chunk_end) {
+                    const auto line_end = std::find(line, chunk_end, '\n');
+                    auto entry_pos = skip_blanks(line, line_end);
+                    if (entry_pos != line_end && *entry_pos != '%') {
+                        const auto row =
+                            parse_index<IndexType>(entry_pos, line_end);
+                        const auto col =
+                            parse_index<IndexType>(entry_pos, line_end);
+                        const auto entry = parsed_header.entry->parse_entry(
+                            entry_pos, line_end);
+                        parsed_header.modifier->insert_entry(row - 1, col - 1,
+                                                             entry, data);
+                        chunk_nnz[chunk]++;
+                    }
+                    line = line_end == chunk_end ? chunk_end : line_end + 1;
+                }
+                data.sort_row_major();
+            } catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        };
+        run_parallel(num_threads, parse_chunk);
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        const auto total_nnz =
+            std::accumulate(chunk_nnz.begin(), chunk_nnz.end(), size_type{});
+        if (total_nnz != num_nonzeros) {
+            throw GKO_STREAM_ERROR(
+                "expected " + std::to_string(num_nonzeros) +
+                " matrix entries, found " + std::to_string(total_nnz));
+        }
+
+        // merge the sorted chunks pairwise
+        using nonzero_type =
+            typename matrix_data<ValueType, IndexType>::nonzero_type;
+        for (size_type stride = 1; stride < num_threads; stride *= 2) {
+            run_parallel(ceildiv(num_threads, 2 * stride), [&](size_type pair) {
+                const auto first = 2 * pair * stride;
+                const auto second = first + stride;
+                if (second >= num_threads) {
+                    return;
+                }
+                auto& lhs = chunks[first].nonzeros;
+                auto& rhs = chunks[second].nonzeros;
+                std::vector<nonzero_type> merged(lhs.size() + rhs.size());
+                std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                           merged.begin());
+                lhs = std::move(merged);
+                rhs = std::vector<nonzero_type>{};
+            });
+        }
+        return std::move(chunks[0]);
+    }
+
     /**
      * Writes a matrix to a stream.
      *
@@ -99,6 +462,8 @@ private:
      */
     struct entry_format {
         virtual ValueType read_entry(std::istream& is) const = 0;
+        virtual ValueType parse_entry(const char*& pos,
+                                      const char* end) const = 0;
         virtual void write_entry(std::ostream& os,
                                  const ValueType& value) const = 0;
     };
@@ -126,6 +491,19 @@ private:
             return static_cast<ValueType>(result);
         }
 
+        /**
+         * parses entry from a character range
+         *
+         * @param  pos the position of the entry, advanced past the entry
+         * @param  end the end of the range
+         *
+         * @return the matrix entry.
+         */
+        ValueType parse_entry(const char*& pos, const char* end) const override
+        {
+            return static_cast<ValueType>(parse_value(pos, end));
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -173,6 +551,19 @@ private:
             return read_entry_impl<ValueType>(is);
         }
 
+        /**
+         * parses entry from a character range
+         *
+         * @param  pos the position of the entry, advanced past the entry
+         * @param  end the end of the range
+         *
+         * @return the matrix entry.
+         */
+        ValueType parse_entry(const char*& pos, const char* end) const override
+        {
+            return parse_entry_impl<ValueType>(pos, end);
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -208,6 +599,24 @@ private:
                 "trying to read a complex matrix into a real storage type");
         }
 
+        template <typename T>
+        static std::enable_if_t<is_complex_s<T>::value, T> parse_entry_impl(
+            const char*& pos, const char* end)
+        {
+            using real_type = remove_complex<T>;
+            const auto real = parse_value(pos, end);
+            const auto imag = parse_value(pos, end);
+            return {static_cast<real_type>(real), static_cast<real_type>(imag)};
+        }
+
+        template <typename T>
+        static std::enable_if_t<!is_complex_s<T>::value, T> parse_entry_impl(
+            const char*&, const char*)
+        {
+            throw GKO_STREAM_ERROR(
+                "trying to read a complex matrix into a real storage type");
+        }
+
     } complex_format{};
 
     /**
@@ -226,6 +635,19 @@ private:
             return one<ValueType>();
         }
 
+        /**
+         * parses entry from a character range
+         *
+         * @param  dummy position
+         * @param  dummy end of the range
+         *
+         * @return the matrix entry(one).
+         */
+        ValueType parse_entry(const char*&, const char*) const override
+        {
+            return one<ValueType>();
+        }
+
         /**
          * writes entry to the output stream
          *
@@ -740,6 +1162,19 @@ matrix_data<ValueType, IndexType> read_raw(std::istream& is)
 }
 
 
+template <typename ValueType, typename IndexType>
+matrix_data<ValueType, IndexType> read_raw_parallel(const std::string& filename,
+                                                    size_type num_threads)
+{
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    mapped_file file(filename);
+    return mtx_io<ValueType, IndexType>::get().read_parallel(
+        file.begin(), file.end(), num_threads);
+}
+
+
 /**
  * Returns the magic number at the beginning of the binary format header for the
  * given type parameters.
@@ -902,6 +1337,373 @@ matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
 }
 
 
+template <typename ValueType, typename IndexType>
+matrix_data<ValueType, IndexType> read_generic_raw_parallel(
+    const std::string& filename, size_type num_threads)
+{
+    std::ifstream stream(filename, std::ios::binary);
+    GKO_CHECK_STREAM(stream, "error when opening " + filename);
+    auto first_char = stream.peek();
+    GKO_CHECK_STREAM(stream, "failed reading from stream");
+    if (first_char == '%') {
+        stream.close();
+        return read_raw_parallel<ValueType, IndexType>(filename, num_threads);
+    } else {
+        return read_binary_raw<ValueType, IndexType>(stream);
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void read_raw_chunked(
+    std::istream& is, std::shared_ptr<const Executor> exec,
+    size_type chunk_size,
+    std::function<void(const device_matrix_data<ValueType, IndexType>&)> fn)
+{
+    mtx_io<ValueType, IndexType>::get().read_chunked(
+        is, chunk_size, [](dim<2>, size_type) {},
+        [&](const matrix_data<ValueType, IndexType>& chunk) {
+            fn(device_matrix_data<ValueType, IndexType>::create_from_host(
+                exec, chunk));
+        });
+}
+
+
+template <typename ValueType, typename IndexType>
+device_matrix_data<ValueType, IndexType> read_device_raw(
+    std::shared_ptr<const Executor> exec, std::istream& is,
+    size_type chunk_size)
+{
+    device_matrix_data<ValueType, IndexType> result{exec};
+    size_type num_entries{};
+    mtx_io<ValueType, IndexType>::get().read_chunked(
+        is, chunk_size,
+        [&](dim<2> size, size_type max_num_entries) {
+            result = device_matrix_data<ValueType, IndexType>{exec, size,
+                                                              max_num_entries};
+        },
+        [&](const matrix_data<ValueType, IndexType>& chunk) {
+            const auto device_chunk =
+                device_matrix_data<ValueType, IndexType>::create_from_host(
+                    exec, chunk);
+            const auto chunk_entries = device_chunk.get_num_stored_elements();
+            exec->copy(chunk_entries, device_chunk.get_const_row_idxs(),
+                       result.get_row_idxs() + num_entries);
+            exec->copy(chunk_entries, device_chunk.get_const_col_idxs(),
+                       result.get_col_idxs() + num_entries);
+            exec->copy(chunk_entries, device_chunk.get_const_values(),
+                       result.get_values() + num_entries);
+            num_entries += chunk_entries;
+        });
+    // symmetric storage only provides an upper bound for the entry count
+    if (num_entries < result.get_num_stored_elements()) {
+        device_matrix_data<ValueType, IndexType> shrunk{exec, result.get_size(),
+                                                        num_entries};
+        exec->copy(num_entries, result.get_const_row_idxs(),
+                   shrunk.get_row_idxs());
+        exec->copy(num_entries, result.get_const_col_idxs(),
+                   shrunk.get_col_idxs());
+        exec->copy(num_entries, result.get_const_values(),
+                   shrunk.get_values());
+        result = std::move(shrunk);
+    }
+    result.sort_row_major();
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_csr(
+    std::shared_ptr<const Executor> exec, std::istream& is,
+    size_type chunk_size)
+{
+    const auto start = is.tellg();
+    if (start == std::istream::pos_type(-1)) {
+        throw GKO_STREAM_ERROR("reading a Csr matrix needs a seekable stream");
+    }
+    const auto& reader = mtx_io<ValueType, IndexType>::get();
+    auto master = exec->get_master();
+    dim<2> size;
+    array<IndexType> row_ptrs{master};
+    // count the entries in each row
+    reader.read_chunked(
+        is, chunk_size,
+        [&](dim<2> mtx_size, size_type) {
+            size = mtx_size;
+            row_ptrs.resize_and_reset(size[0] + 1);
+            row_ptrs.fill(zero<IndexType>());
+        },
+        [&](const matrix_data<ValueType, IndexType>& chunk) {
+            for (const auto& nonzero : chunk.nonzeros) {
+                if (nonzero.row < 0 ||
+                    static_cast<size_type>(nonzero.row) >= size[0]) {
+                    throw GKO_STREAM_ERROR("row index " +
+                                           std::to_string(nonzero.row) +
+                                           " is out of bounds");
+                }
+                row_ptrs.get_data()[nonzero.row + 1]++;
+            }
+        });
+    std::partial_sum(row_ptrs.get_data(), row_ptrs.get_data() + size[0] + 1,
+                     row_ptrs.get_data());
+    const auto num_entries =
+        static_cast<size_type>(row_ptrs.get_const_data()[size[0]]);
+    array<IndexType> col_idxs{master, num_entries};
+    array<ValueType> values{master, num_entries};
+    array<IndexType> row_offsets{master, row_ptrs.get_const_data(),
+                                 row_ptrs.get_const_data() + size[0]};
+    // place the entries at their row's current offset
+    is.clear();
+    is.seekg(start);
+    reader.read_chunked(
+        is, chunk_size, [](dim<2>, size_type) {},
+        [&](const matrix_data<ValueType, IndexType>& chunk) {
+            for (const auto& nonzero : chunk.nonzeros) {
+                auto& offset = row_offsets.get_data()[nonzero.row];
+                col_idxs.get_data()[offset] = nonzero.column;
+                values.get_data()[offset] = nonzero.value;
+                offset++;
+            }
+        });
+    auto result = matrix::Csr<ValueType, IndexType>::create(
+        exec, size, std::move(values), std::move(col_idxs),
+        std::move(row_ptrs));
+    result->sort_by_column_index();
+    return result;
+}
+
+
+/**
+ * Returns the magic number at the beginning of the binary CSR format header
+ * for the given type parameters. It shares the type characters with the binary
+ * COO format.
+ */
+template <typename ValueType, typename IndexType>
+static constexpr uint64 binary_csr_format_magic()
+{
+    constexpr uint64 shift = 256;
+    constexpr uint64 type_bits =
+        binary_format_magic<ValueType, IndexType>() / (shift * shift * shift *
+                                                       shift * shift * shift);
+    return 'G' +
+           shift *
+               ('K' +
+                shift *
+                    ('O' +
+                     shift *
+                         ('C' +
+                          shift * ('S' + shift * ('R' + shift * type_bits)))));
+}
+
+
+constexpr uint64 binary_csr_format_version = 1;
+
+
+// every array in the binary CSR format starts at a multiple of this
+constexpr uint64 binary_csr_alignment = 64;
+
+
+struct binary_csr_header {
+    uint64 magic;
+    uint64 version;
+    uint64 num_rows;
+    uint64 num_cols;
+    uint64 num_entries;
+    uint64 row_ptrs_offset;
+    uint64 col_idxs_offset;
+    uint64 values_offset;
+};
+
+static_assert(sizeof(binary_csr_header) == binary_csr_alignment,
+              "unexpected binary CSR header size");
+
+
+namespace {
+
+
+template <typename FileValueType, typename FileIndexType, typename ValueType,
+          typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr_convert(
+    std::shared_ptr<const Executor> exec, const char* data,
+    const binary_csr_header& header)
+{
+    if (header.num_rows > std::numeric_limits<IndexType>::max() ||
+        header.num_cols > std::numeric_limits<IndexType>::max() ||
+        header.num_entries > std::numeric_limits<IndexType>::max()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, its index type would overflow");
+    }
+    if (is_complex<FileValueType>() && !is_complex<ValueType>()) {
+        throw GKO_STREAM_ERROR(
+            "cannot read into this format, would assign complex to real");
+    }
+    auto master = exec->get_master();
+    const auto num_rows = static_cast<size_type>(header.num_rows);
+    const auto num_entries = static_cast<size_type>(header.num_entries);
+    array<IndexType> row_ptrs{master, num_rows + 1};
+    array<IndexType> col_idxs{master, num_entries};
+    array<ValueType> values{master, num_entries};
+    for (size_type i = 0; i <= num_rows; i++) {
+        FileIndexType row_ptr{};
+        std::memcpy(&row_ptr,
+                    data + header.row_ptrs_offset + i * sizeof(FileIndexType),
+                    sizeof(FileIndexType));
+        row_ptrs.get_data()[i] = static_cast<IndexType>(row_ptr);
+    }
+    for (size_type i = 0; i < num_entries; i++) {
+        FileIndexType col{};
+        FileValueType value{};
+        std::memcpy(&col,
+                    data + header.col_idxs_offset + i * sizeof(FileIndexType),
+                    sizeof(FileIndexType));
+        std::memcpy(&value,
+                    data + header.values_offset + i * sizeof(FileValueType),
+                    sizeof(FileValueType));
+        col_idxs.get_data()[i] = static_cast<IndexType>(col);
+        values.get_data()[i] = static_cast<ValueType>(
+            select_helper<is_complex<ValueType>()>::get(value, real(value)));
+    }
+    return matrix::Csr<ValueType, IndexType>::create(
+        exec,
+        dim<2>{num_rows, static_cast<size_type>(header.num_cols)},
+        std::move(values), std::move(col_idxs), std::move(row_ptrs));
+}
+
+
+void write_binary_csr_padding(std::ostream& os, uint64 written)
+{
+    const std::array<char, binary_csr_alignment> padding{};
+    const auto padding_size =
+        (binary_csr_alignment - written % binary_csr_alignment) %
+        binary_csr_alignment;
+    GKO_CHECK_STREAM(os.write(padding.data(), padding_size),
+                     "failed writing padding");
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* mtx)
+{
+    auto host_mtx =
+        make_temporary_clone(mtx->get_executor()->get_master(), mtx);
+    const auto round_up = [](uint64 offset) {
+        return ceildiv(offset, binary_csr_alignment) * binary_csr_alignment;
+    };
+    binary_csr_header header{};
+    header.magic = binary_csr_format_magic<ValueType, IndexType>();
+    header.version = binary_csr_format_version;
+    header.num_rows = host_mtx->get_size()[0];
+    header.num_cols = host_mtx->get_size()[1];
+    header.num_entries = host_mtx->get_num_stored_elements();
+    const auto row_ptrs_size = (header.num_rows + 1) * sizeof(IndexType);
+    const auto col_idxs_size = header.num_entries * sizeof(IndexType);
+    const auto values_size = header.num_entries * sizeof(ValueType);
+    header.row_ptrs_offset = sizeof(binary_csr_header);
+    header.col_idxs_offset = round_up(header.row_ptrs_offset + row_ptrs_size);
+    header.values_offset = round_up(header.col_idxs_offset + col_idxs_size);
+    GKO_CHECK_STREAM(os.write(reinterpret_cast<const char*>(&header),
+                              sizeof(binary_csr_header)),
+                     "failed writing header");
+    GKO_CHECK_STREAM(
+        os.write(reinterpret_cast<const char*>(host_mtx->get_const_row_ptrs()),
+                 row_ptrs_size),
+        "failed writing row pointers");
+    write_binary_csr_padding(os, row_ptrs_size);
+    GKO_CHECK_STREAM(
+        os.write(reinterpret_cast<const char*>(host_mtx->get_const_col_idxs()),
+                 col_idxs_size),
+        "failed writing column indices");
+    write_binary_csr_padding(os, col_idxs_size);
+    GKO_CHECK_STREAM(
+        os.write(reinterpret_cast<const char*>(host_mtx->get_const_values()),
+                 values_size),
+        "failed writing values");
+    os.flush();
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::shared_ptr<const Executor> exec, const std::string& filename)
+{
+    auto file = std::make_shared<mapped_file>(filename);
+    binary_csr_header header{};
+    if (file->get_size() < sizeof(binary_csr_header)) {
+        throw GKO_STREAM_ERROR("failed reading header");
+    }
+    std::memcpy(&header, file->begin(), sizeof(binary_csr_header));
+    if (std::memcmp(file->begin(), "GKOCSR", 6) != 0) {
+        throw GKO_STREAM_ERROR("invalid header magic number '" +
+                               std::string(file->begin(), 8) + "'");
+    }
+    if (header.version != binary_csr_format_version) {
+        throw GKO_STREAM_ERROR("unsupported binary CSR format version " +
+                               std::to_string(header.version));
+    }
+    const auto fits = [&](uint64 offset, uint64 count, uint64 element_size) {
+        return offset % binary_csr_alignment == 0 &&
+               offset <= file->get_size() &&
+               count <= (file->get_size() - offset) / element_size;
+    };
+    const auto check_bounds = [&](uint64 index_size, uint64 value_size) {
+        if (!fits(header.row_ptrs_offset, header.num_rows + 1, index_size) ||
+            !fits(header.col_idxs_offset, header.num_entries, index_size) ||
+            !fits(header.values_offset, header.num_entries, value_size)) {
+            throw GKO_STREAM_ERROR("file is too short or misaligned");
+        }
+    };
+    if (header.magic == binary_csr_format_magic<ValueType, IndexType>()) {
+        check_bounds(sizeof(IndexType), sizeof(ValueType));
+        // the arrays point directly into the mapped file and keep it alive
+        auto master = exec->get_master();
+        auto data = file->get_data();
+        const auto keep_alive = [file](void*) {};
+        array<IndexType> row_ptrs{
+            master, static_cast<size_type>(header.num_rows + 1),
+            reinterpret_cast<IndexType*>(data + header.row_ptrs_offset),
+            keep_alive};
+        array<IndexType> col_idxs{
+            master, static_cast<size_type>(header.num_entries),
+            reinterpret_cast<IndexType*>(data + header.col_idxs_offset),
+            keep_alive};
+        array<ValueType> values{
+            master, static_cast<size_type>(header.num_entries),
+            reinterpret_cast<ValueType*>(data + header.values_offset),
+            keep_alive};
+        return matrix::Csr<ValueType, IndexType>::create(
+            exec,
+            dim<2>{static_cast<size_type>(header.num_rows),
+                   static_cast<size_type>(header.num_cols)},
+            std::move(values), std::move(col_idxs), std::move(row_ptrs));
+    }
+#define DECLARE_OVERLOAD(_vtype, _itype)                                     \
+    else if (header.magic == binary_csr_format_magic<_vtype, _itype>())      \
+    {                                                                        \
+        check_bounds(sizeof(_itype), sizeof(_vtype));                        \
+        return read_binary_csr_convert<_vtype, _itype, ValueType, IndexType>( \
+            exec, file->begin(), header);                                    \
+    }
+    DECLARE_OVERLOAD(double, int32)
+    DECLARE_OVERLOAD(float, int32)
+    DECLARE_OVERLOAD(std::complex<double>, int32)
+    DECLARE_OVERLOAD(std::complex<float>, int32)
+    DECLARE_OVERLOAD(double, int64)
+    DECLARE_OVERLOAD(float, int64)
+    DECLARE_OVERLOAD(std::complex<double>, int64)
+    DECLARE_OVERLOAD(std::complex<float>, int64)
+#undef DECLARE_OVERLOAD
+    else
+    {
+        throw GKO_STREAM_ERROR("invalid header magic number '" +
+                               std::string(file->begin(), 8) + "'");
+    }
+}
+
+
 template <typename ValueType, typename IndexType>
 void write_binary_raw(std::ostream& os,
                       const matrix_data<ValueType, IndexType>& mtx)
@@ -965,11 +1767,45 @@ void write_raw(std::ostream& os, const matrix_data<ValueType, IndexType>& data,
                           const matrix_data<ValueType, IndexType>& data)
 #define GKO_DECLARE_READ_GENERIC_RAW(ValueType, IndexType) \
     matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is)
+#define GKO_DECLARE_READ_RAW_PARALLEL(ValueType, IndexType) \
+    matrix_data<ValueType, IndexType> read_raw_parallel(     \
+        const std::string& filename, size_type num_threads)
+#define GKO_DECLARE_READ_GENERIC_RAW_PARALLEL(ValueType, IndexType) \
+    matrix_data<ValueType, IndexType> read_generic_raw_parallel(     \
+        const std::string& filename, size_type num_threads)
+#define GKO_DECLARE_READ_RAW_CHUNKED(ValueType, IndexType)                   \
+    void read_raw_chunked(                                                   \
+        std::istream& is, std::shared_ptr<const Executor> exec,              \
+        size_type chunk_size,                                                \
+        std::function<void(const device_matrix_data<ValueType, IndexType>&)> \
+            fn)
+#define GKO_DECLARE_READ_DEVICE_RAW(ValueType, IndexType)       \
+    device_matrix_data<ValueType, IndexType> read_device_raw(   \
+        std::shared_ptr<const Executor> exec, std::istream& is, \
+        size_type chunk_size)
+#define GKO_DECLARE_READ_CSR(ValueType, IndexType)               \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_csr( \
+        std::shared_ptr<const Executor> exec, std::istream& is,  \
+        size_type chunk_size)
+#define GKO_DECLARE_READ_BINARY_CSR(ValueType, IndexType)              \
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr( \
+        std::shared_ptr<const Executor> exec, const std::string& filename)
+#define GKO_DECLARE_WRITE_BINARY_CSR(ValueType, IndexType) \
+    void write_binary_csr(std::ostream& os,                 \
+                          const matrix::Csr<ValueType, IndexType>* mtx)
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_RAW);
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_GENERIC_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW_PARALLEL);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_READ_GENERIC_RAW_PARALLEL);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_RAW_CHUNKED);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_DEVICE_RAW);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_CSR);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_READ_BINARY_CSR);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_WRITE_BINARY_CSR);
 
 
 }  // namespace gko
@@ -47,6 +47,7 @@ enum class LinOpFactoryType : int {
     Fcg,
     Cgs,
     Ir,
+    MixedPrecisionIr,
     Idr,
     Gcr,
     Gmres,
@@ -24,6 +24,8 @@ configuration_map generate_config_map()
             {"solver::Fcg", parse<LinOpFactoryType::Fcg>},
             {"solver::Cgs", parse<LinOpFactoryType::Cgs>},
             {"solver::Ir", parse<LinOpFactoryType::Ir>},
+            {"solver::MixedPrecisionIr",
+             parse<LinOpFactoryType::MixedPrecisionIr>},
             {"solver::Idr", parse<LinOpFactoryType::Idr>},
             {"solver::Gcr", parse<LinOpFactoryType::Gcr>},
             {"solver::Gmres", parse<LinOpFactoryType::Gmres>},
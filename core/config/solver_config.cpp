@@ -16,6 +16,7 @@
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/idr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/mixed_precision_ir.hpp>
 #include <ginkgo/core/solver/multigrid.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 
@@ -36,6 +37,7 @@ GKO_PARSE_VALUE_TYPE(Bicgstab, gko::solver::Bicgstab);
 GKO_PARSE_VALUE_TYPE(Cgs, gko::solver::Cgs);
 GKO_PARSE_VALUE_TYPE(Fcg, gko::solver::Fcg);
 GKO_PARSE_VALUE_TYPE(Ir, gko::solver::Ir);
+GKO_PARSE_VALUE_TYPE(MixedPrecisionIr, gko::solver::MixedPrecisionIr);
 GKO_PARSE_VALUE_TYPE(Idr, gko::solver::Idr);
 GKO_PARSE_VALUE_TYPE(Gcr, gko::solver::Gcr);
 GKO_PARSE_VALUE_TYPE(Gmres, gko::solver::Gmres);
@@ -33,6 +33,7 @@
 #include "core/matrix/batch_csr_kernels.hpp"
 #include "core/matrix/batch_dense_kernels.hpp"
 #include "core/matrix/batch_ell_kernels.hpp"
+#include "core/matrix/compressed_csr_kernels.hpp"
 #include "core/matrix/coo_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
 #include "core/matrix/dense_kernels.hpp"
@@ -45,10 +46,13 @@
 #include "core/matrix/scaled_permutation_kernels.hpp"
 #include "core/matrix/sellp_kernels.hpp"
 #include "core/matrix/sparsity_csr_kernels.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
 #include "core/preconditioner/batch_jacobi_kernels.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
+#include "core/reorder/amd_kernels.hpp"
+#include "core/reorder/multi_color_kernels.hpp"
 #include "core/reorder/rcm_kernels.hpp"
 #include "core/solver/batch_bicgstab_kernels.hpp"
 #include "core/solver/batch_cg_kernels.hpp"
@@ -442,6 +446,7 @@ namespace cg {
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_INITIALIZE_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_1_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_AND_DOT_KERNEL);
 
 
 }  // namespace cg
@@ -486,6 +491,7 @@ namespace fcg {
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_FCG_INITIALIZE_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_FCG_STEP_1_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_FCG_STEP_2_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_FCG_STEP_2_AND_DOT_KERNEL);
 
 
 }  // namespace fcg
@@ -498,6 +504,7 @@ GKO_STUB_VALUE_TYPE(GKO_DECLARE_BICGSTAB_INITIALIZE_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_1_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_2_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_3_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_3_AND_DOT_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_BICGSTAB_FINALIZE_KERNEL);
 
 
@@ -534,6 +541,7 @@ namespace gcr {
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GCR_INITIALIZE_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GCR_RESTART_KERNEL);
 GKO_STUB_VALUE_TYPE(GKO_DECLARE_GCR_STEP_1_KERNEL);
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_GCR_STEP_1_AND_NORM_KERNEL);
 
 
 }  // namespace gcr
@@ -611,6 +619,22 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
 }  // namespace sparsity_csr
 
 
+namespace symmetric_csr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NONZEROS_PER_ROW_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_FILL_UPPER_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_NONZEROS_PER_ROW_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+
+
+}  // namespace symmetric_csr
+
+
 namespace csr {
 
 
@@ -683,6 +707,20 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_EXTRACT_DIAGONAL);
 }  // namespace fbcsr
 
 
+namespace compressed_csr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_COMPRESSED_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_COMPRESSED_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_COMPRESSED_CSR_COMPRESS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_COMPRESSED_CSR_DECOMPRESS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_COUNT_INDEX_OUTLIERS_KERNEL);
+
+
+}  // namespace compressed_csr
+
+
 namespace coo {
 
 
@@ -934,6 +972,24 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
 }  // namespace par_ilut_factorization
 
 
+namespace amd {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_AMD_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace amd
+
+
+namespace multi_color {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_MULTI_COLOR_COMPUTE_COLORING_KERNEL);
+
+
+}  // namespace multi_color
+
+
 namespace rcm {
 
 
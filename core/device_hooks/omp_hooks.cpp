@@ -4,6 +4,7 @@
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/memory.hpp>
 #include <ginkgo/core/base/scoped_device_id_guard.hpp>
 #include <ginkgo/core/base/version.hpp>
 
@@ -27,6 +28,20 @@ scoped_device_id_guard::scoped_device_id_guard(const OmpExecutor* exec,
 int OmpExecutor::get_num_omp_threads() { return 1; }
 
 
+void OmpExecutor::set_num_omp_threads(int num_threads) {}
+
+
+NumaCpuAllocator::NumaCpuAllocator(size_type alignment, bool use_huge_pages,
+                                   bool bind_threads)
+    GKO_NOT_COMPILED(omp);
+
+
+void* NumaCpuAllocator::allocate(size_type num_bytes) GKO_NOT_COMPILED(omp);
+
+
+void NumaCpuAllocator::deallocate(void* ptr) GKO_NOT_COMPILED(omp);
+
+
 }  // namespace gko
 
 
@@ -5,16 +5,60 @@
 #include <ginkgo/core/distributed/matrix.hpp>
 
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 
 
 #include "core/distributed/matrix_kernels.hpp"
+#include "core/distributed/progress_thread.hpp"
 
 
 namespace gko {
+namespace detail {
+
+
+/**
+ * The communication and sparsity pattern of a distributed product A * B, which
+ * is kept in the product to recompute its values.
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+struct distributed_spgemm_plan {
+    using csr_type = matrix::Csr<ValueType, LocalIndexType>;
+
+    // position of the entries of the owned rows of B within the concatenated
+    // values of the local and non-local block of B
+    std::vector<int64> owned_src;
+    // entries of the owned rows of B that are sent, ordered by target rank
+    std::vector<int64> send_entries;
+    std::vector<experimental::distributed::comm_index_type> send_sizes;
+    std::vector<experimental::distributed::comm_index_type> send_offsets;
+    std::vector<experimental::distributed::comm_index_type> recv_sizes;
+    std::vector<experimental::distributed::comm_index_type> recv_offsets;
+    // global column index of the compressed columns of the rows of B
+    std::vector<GlobalIndexType> compact_cols;
+    // the owned rows and the received rows of B with compressed columns
+    std::shared_ptr<csr_type> owned_rows;
+    std::shared_ptr<csr_type> ghost_rows;
+    // position of each entry of the product in the values of the local block
+    // of the result, or in the non-local block shifted by local_nnz
+    std::vector<int64> result_pos;
+    size_type local_nnz;
+};
+
+
+}  // namespace detail
+
+
 namespace experimental {
 namespace distributed {
 namespace matrix {
@@ -29,6 +73,326 @@ GKO_REGISTER_OPERATION(separate_local_nonlocal,
 }  // namespace matrix
 
 
+namespace {
+
+
+/**
+ * Sends the entries of rows owned by other processes to their owners and
+ * returns the entries of the owned rows, including the received ones.
+ *
+ * The non-owned entries are summed up locally before they are sent, and every
+ * message carries at most chunk_size entries. While a round of messages is in
+ * flight, the entries received in the previous round are appended to the
+ * result.
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> assemble_on_row_owners(
+    std::shared_ptr<const Executor> exec, mpi::communicator comm,
+    const device_matrix_data<ValueType, GlobalIndexType>& data,
+    const Partition<LocalIndexType, GlobalIndexType>* row_partition,
+    size_type chunk_size)
+{
+    GKO_ASSERT(chunk_size > 0);
+    auto host_exec = exec->get_master();
+    const auto num_ranks = comm.size();
+    const auto rank = comm.rank();
+    auto host_part = make_temporary_clone(host_exec, row_partition);
+    const auto range_bounds = host_part->get_range_bounds();
+    const auto part_ids = host_part->get_part_ids();
+    const auto num_ranges = host_part->get_num_ranges();
+    auto find_owner = [&](GlobalIndexType row) {
+        auto range = std::upper_bound(range_bounds + 1,
+                                      range_bounds + num_ranges + 1, row) -
+                     (range_bounds + 1);
+        return part_ids[range];
+    };
+
+    // bucket the locally summed entries by their owner
+    std::vector<comm_index_type> send_sizes(num_ranks, 0);
+    std::vector<comm_index_type> send_offsets(num_ranks + 1, 0);
+    std::vector<GlobalIndexType> row_idxs;
+    std::vector<GlobalIndexType> col_idxs;
+    std::vector<ValueType> values;
+    {
+        device_matrix_data<ValueType, GlobalIndexType> host_data{host_exec,
+                                                                 data};
+        host_data.sum_duplicates();
+        const auto num_entries = host_data.get_num_stored_elements();
+        const auto rows = host_data.get_const_row_idxs();
+        const auto cols = host_data.get_const_col_idxs();
+        const auto vals = host_data.get_const_values();
+        std::vector<comm_index_type> owners(num_entries);
+        for (size_type i = 0; i < num_entries; i++) {
+            owners[i] = find_owner(rows[i]);
+            send_sizes[owners[i]]++;
+        }
+        std::partial_sum(send_sizes.begin(), send_sizes.end(),
+                         send_offsets.begin() + 1);
+        row_idxs.resize(num_entries);
+        col_idxs.resize(num_entries);
+        values.resize(num_entries);
+        auto fill_offsets = send_offsets;
+        for (size_type i = 0; i < num_entries; i++) {
+            const auto out = fill_offsets[owners[i]]++;
+            row_idxs[out] = rows[i];
+            col_idxs[out] = cols[i];
+            values[out] = vals[i];
+        }
+    }
+    std::vector<comm_index_type> recv_sizes(num_ranks, 0);
+    comm.all_to_all(host_exec, send_sizes.data(), 1, recv_sizes.data(), 1);
+    send_sizes[rank] = 0;
+    recv_sizes[rank] = 0;
+
+    // the owned entries stay in place, the others are replaced by the
+    // received ones
+    std::vector<GlobalIndexType> result_row_idxs(
+        row_idxs.begin() + send_offsets[rank],
+        row_idxs.begin() + send_offsets[rank + 1]);
+    std::vector<GlobalIndexType> result_col_idxs(
+        col_idxs.begin() + send_offsets[rank],
+        col_idxs.begin() + send_offsets[rank + 1]);
+    std::vector<ValueType> result_values(
+        values.begin() + send_offsets[rank],
+        values.begin() + send_offsets[rank + 1]);
+
+    struct chunk_buffer {
+        std::vector<GlobalIndexType> row_idxs;
+        std::vector<GlobalIndexType> col_idxs;
+        std::vector<ValueType> values;
+    };
+    std::vector<chunk_buffer> buffers[2];
+    buffers[0].resize(num_ranks);
+    buffers[1].resize(num_ranks);
+    auto append = [&](std::vector<chunk_buffer>& chunks) {
+        for (auto& chunk : chunks) {
+            result_row_idxs.insert(result_row_idxs.end(),
+                                   chunk.row_idxs.begin(),
+                                   chunk.row_idxs.end());
+            result_col_idxs.insert(result_col_idxs.end(),
+                                   chunk.col_idxs.begin(),
+                                   chunk.col_idxs.end());
+            result_values.insert(result_values.end(), chunk.values.begin(),
+                                 chunk.values.end());
+            chunk.row_idxs.clear();
+            chunk.col_idxs.clear();
+            chunk.values.clear();
+        }
+    };
+    const auto chunk = static_cast<comm_index_type>(
+        std::min<size_type>(chunk_size, std::numeric_limits<int>::max()));
+    comm_index_type num_rounds = 0;
+    for (comm_index_type i = 0; i < num_ranks; i++) {
+        num_rounds = std::max<comm_index_type>(
+            num_rounds,
+            static_cast<comm_index_type>(
+                ceildiv(std::max(send_sizes[i], recv_sizes[i]), chunk)));
+    }
+    // every pair of processes agrees on the number of chunks they exchange,
+    // so the rounds need no global synchronization
+    constexpr int row_tag = 0;
+    constexpr int col_tag = 1;
+    constexpr int value_tag = 2;
+    for (comm_index_type round = 0; round < num_rounds; round++) {
+        auto& current = buffers[round % 2];
+        std::vector<mpi::request> requests;
+        const auto begin = round * chunk;
+        for (comm_index_type i = 0; i < num_ranks; i++) {
+            if (begin < recv_sizes[i]) {
+                const auto size = std::min(chunk, recv_sizes[i] - begin);
+                current[i].row_idxs.resize(size);
+                current[i].col_idxs.resize(size);
+                current[i].values.resize(size);
+                requests.push_back(comm.i_recv(
+                    host_exec, current[i].row_idxs.data(), size, i, row_tag));
+                requests.push_back(comm.i_recv(
+                    host_exec, current[i].col_idxs.data(), size, i, col_tag));
+                requests.push_back(comm.i_recv(
+                    host_exec, current[i].values.data(), size, i, value_tag));
+            }
+            if (begin < send_sizes[i]) {
+                const auto size = std::min(chunk, send_sizes[i] - begin);
+                const auto offset = send_offsets[i] + begin;
+                requests.push_back(comm.i_send(host_exec,
+                                               row_idxs.data() + offset, size,
+                                               i, row_tag));
+                requests.push_back(comm.i_send(host_exec,
+                                               col_idxs.data() + offset, size,
+                                               i, col_tag));
+                requests.push_back(comm.i_send(
+                    host_exec, values.data() + offset, size, i, value_tag));
+            }
+        }
+        if (round > 0) {
+            append(buffers[(round + 1) % 2]);
+        }
+        mpi::wait_all(requests);
+    }
+    if (num_rounds > 0) {
+        append(buffers[(num_rounds + 1) % 2]);
+    }
+    row_idxs = {};
+    col_idxs = {};
+    values = {};
+
+    device_matrix_data<ValueType, GlobalIndexType> result{
+        exec, data.get_size(),
+        array<GlobalIndexType>{exec, result_row_idxs.begin(),
+                               result_row_idxs.end()},
+        array<GlobalIndexType>{exec, result_col_idxs.begin(),
+                               result_col_idxs.end()},
+        array<ValueType>{exec, result_values.begin(), result_values.end()}};
+    result.sum_duplicates();
+    return result;
+}
+
+
+
+/**
+ * Returns the global indices of the indices owned by part, ordered by their
+ * local index.
+ */
+template <typename LocalIndexType, typename GlobalIndexType>
+std::vector<GlobalIndexType> local_to_global_idxs(
+    const Partition<LocalIndexType, GlobalIndexType>* partition,
+    comm_index_type part)
+{
+    auto host_partition =
+        make_temporary_clone(partition->get_executor()->get_master(), partition);
+    const auto range_bounds = host_partition->get_range_bounds();
+    const auto part_ids = host_partition->get_part_ids();
+    const auto starting_idxs =
+        host_partition->get_range_starting_indices();
+    std::vector<GlobalIndexType> result(
+        host_partition->get_part_size(part));
+    for (size_type range = 0; range < host_partition->get_num_ranges();
+         ++range) {
+        if (part_ids[range] != part) {
+            continue;
+        }
+        std::iota(result.begin() + starting_idxs[range],
+                  result.begin() + starting_idxs[range] +
+                      (range_bounds[range + 1] - range_bounds[range]),
+                  range_bounds[range]);
+    }
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<gko::matrix::Csr<ValueType, IndexType>> to_csr(
+    std::shared_ptr<const Executor> exec, const LinOp* op)
+{
+    auto result = gko::matrix::Csr<ValueType, IndexType>::create(exec);
+    as<ConvertibleTo<gko::matrix::Csr<ValueType, IndexType>>>(op)->convert_to(
+        result);
+    return result;
+}
+
+
+/**
+ * Exchanges the values of the rows of B required by the product of the plan
+ * and computes the local rows of A * B with compressed columns.
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::unique_ptr<gko::matrix::Csr<ValueType, LocalIndexType>> compute_product(
+    const gko::detail::distributed_spgemm_plan<ValueType, LocalIndexType,
+                                               GlobalIndexType>& plan,
+    mpi::communicator comm, const LinOp* a_local, const LinOp* a_non_local,
+    const LinOp* b_local, const LinOp* b_non_local)
+{
+    using csr_type = gko::matrix::Csr<ValueType, LocalIndexType>;
+    auto exec = plan.owned_rows->get_executor();
+    auto host_exec = exec->get_master();
+    auto host_b_local = to_csr<ValueType, LocalIndexType>(host_exec, b_local);
+    auto host_b_non_local =
+        to_csr<ValueType, LocalIndexType>(host_exec, b_non_local);
+    const auto b_local_nnz = host_b_local->get_num_stored_elements();
+    GKO_ASSERT_EQ(plan.owned_src.size(),
+                  b_local_nnz + host_b_non_local->get_num_stored_elements());
+
+    std::vector<ValueType> owned_vals(plan.owned_src.size());
+    std::transform(plan.owned_src.begin(), plan.owned_src.end(),
+                   owned_vals.begin(), [&](int64 src) {
+                       return static_cast<size_type>(src) < b_local_nnz
+                                  ? host_b_local->get_const_values()[src]
+                                  : host_b_non_local
+                                        ->get_const_values()[src - b_local_nnz];
+                   });
+    std::vector<ValueType> send_vals(plan.send_entries.size());
+    std::transform(plan.send_entries.begin(), plan.send_entries.end(),
+                   send_vals.begin(),
+                   [&](int64 entry) { return owned_vals[entry]; });
+    std::vector<ValueType> ghost_vals(
+        plan.ghost_rows->get_num_stored_elements());
+    comm.all_to_all_v(host_exec, send_vals.data(), plan.send_sizes.data(),
+                      plan.send_offsets.data(), ghost_vals.data(),
+                      plan.recv_sizes.data(), plan.recv_offsets.data());
+    exec->copy_from(host_exec, owned_vals.size(), owned_vals.data(),
+                    plan.owned_rows->get_values());
+    exec->copy_from(host_exec, ghost_vals.size(), ghost_vals.data(),
+                    plan.ghost_rows->get_values());
+
+    auto product = csr_type::create(
+        exec, dim<2>{a_local->get_size()[0], plan.compact_cols.size()});
+    auto one_op = initialize<gko::matrix::Dense<ValueType>>(
+        {one<ValueType>()}, exec);
+    to_csr<ValueType, LocalIndexType>(exec, a_non_local)
+        ->apply(plan.ghost_rows, product);
+    to_csr<ValueType, LocalIndexType>(exec, a_local)
+        ->apply(one_op, plan.owned_rows, one_op, product);
+    return product;
+}
+
+
+/**
+ * Returns the entries of the local rows of a distributed matrix with swapped
+ * global row and column indices.
+ */
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+device_matrix_data<ValueType, GlobalIndexType> transposed_data(
+    std::shared_ptr<const Executor> exec, comm_index_type rank, dim<2> size,
+    const LinOp* local, const LinOp* non_local,
+    const array<GlobalIndexType>& non_local_to_global,
+    const Partition<LocalIndexType, GlobalIndexType>* row_partition,
+    const Partition<LocalIndexType, GlobalIndexType>* col_partition,
+    bool conjugate)
+{
+    auto host_exec = exec->get_master();
+    const auto row_idxs = local_to_global_idxs(row_partition, rank);
+    const auto local_cols = local_to_global_idxs(col_partition, rank);
+    const auto non_local_cols =
+        make_temporary_clone(host_exec, &non_local_to_global);
+    const auto host_local = to_csr<ValueType, LocalIndexType>(host_exec, local);
+    const auto host_non_local =
+        to_csr<ValueType, LocalIndexType>(host_exec, non_local);
+    const auto nnz = host_local->get_num_stored_elements() +
+                     host_non_local->get_num_stored_elements();
+    device_matrix_data<ValueType, GlobalIndexType> data{host_exec,
+                                                        transpose(size), nnz};
+    size_type out = 0;
+    auto append = [&](const gko::matrix::Csr<ValueType, LocalIndexType>* mtx,
+                      const GlobalIndexType* col_map) {
+        for (size_type row = 0; row < mtx->get_size()[0]; ++row) {
+            for (auto k = mtx->get_const_row_ptrs()[row];
+                 k < mtx->get_const_row_ptrs()[row + 1]; ++k) {
+                const auto val = mtx->get_const_values()[k];
+                data.get_row_idxs()[out] =
+                    col_map[mtx->get_const_col_idxs()[k]];
+                data.get_col_idxs()[out] = row_idxs[row];
+                data.get_values()[out] = conjugate ? conj(val) : val;
+                out++;
+            }
+        }
+    };
+    append(host_local.get(), local_cols.data());
+    append(host_non_local.get(), non_local_cols->get_const_data());
+    return device_matrix_data<ValueType, GlobalIndexType>{exec, data};
+}
+
+}  // namespace
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 Matrix<ValueType, LocalIndexType, GlobalIndexType>::Matrix(
     std::shared_ptr<const Executor> exec, mpi::communicator comm)
@@ -214,6 +578,9 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::convert_to(
     result->recv_sizes_ = this->recv_sizes_;
     result->send_sizes_ = this->send_sizes_;
     result->non_local_to_global_ = this->non_local_to_global_;
+    result->row_partition_ = this->row_partition_;
+    result->col_partition_ = this->col_partition_;
+    result->spgemm_plan_.reset();
     result->set_size(this->get_size());
 }
 
@@ -233,6 +600,10 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::move_to(
     result->recv_sizes_ = std::move(this->recv_sizes_);
     result->send_sizes_ = std::move(this->send_sizes_);
     result->non_local_to_global_ = std::move(this->non_local_to_global_);
+    result->row_partition_ = std::move(this->row_partition_);
+    result->col_partition_ = std::move(this->col_partition_);
+    result->spgemm_plan_.reset();
+    this->spgemm_plan_.reset();
     result->set_size(this->get_size());
     this->set_size({});
 }
@@ -244,15 +615,26 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     std::shared_ptr<const Partition<local_index_type, global_index_type>>
         row_partition,
     std::shared_ptr<const Partition<local_index_type, global_index_type>>
-        col_partition)
+        col_partition,
+    assembly_mode assembly_type, size_type chunk_size)
 {
     const auto comm = this->get_communicator();
+    if (assembly_type == assembly_mode::communicate) {
+        GKO_ASSERT_EQ(comm.size(), row_partition->get_num_parts());
+        return this->read_distributed(
+            assemble_on_row_owners(this->get_executor(), comm, data,
+                                   row_partition.get(), chunk_size),
+            row_partition, col_partition, assembly_mode::local_only);
+    }
     GKO_ASSERT_EQ(data.get_size()[0], row_partition->get_size());
     GKO_ASSERT_EQ(data.get_size()[1], col_partition->get_size());
     GKO_ASSERT_EQ(comm.size(), row_partition->get_num_parts());
     GKO_ASSERT_EQ(comm.size(), col_partition->get_num_parts());
     auto exec = this->get_executor();
     auto local_part = comm.rank();
+    row_partition_ = row_partition;
+    col_partition_ = col_partition;
+    spgemm_plan_.reset();
 
     // set up LinOp sizes
     auto num_parts = static_cast<size_type>(row_partition->get_num_parts());
@@ -359,12 +741,13 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     std::shared_ptr<const Partition<local_index_type, global_index_type>>
         row_partition,
     std::shared_ptr<const Partition<local_index_type, global_index_type>>
-        col_partition)
+        col_partition,
+    assembly_mode assembly_type, size_type chunk_size)
 {
     return this->read_distributed(
         device_matrix_data<value_type, global_index_type>::create_from_host(
             this->get_executor(), data),
-        row_partition, col_partition);
+        row_partition, col_partition, assembly_type, chunk_size);
 }
 
 
@@ -372,12 +755,13 @@ template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     const matrix_data<ValueType, global_index_type>& data,
     std::shared_ptr<const Partition<local_index_type, global_index_type>>
-        partition)
+        partition,
+    assembly_mode assembly_type, size_type chunk_size)
 {
     return this->read_distributed(
         device_matrix_data<value_type, global_index_type>::create_from_host(
             this->get_executor(), data),
-        partition, partition);
+        partition, partition, assembly_type, chunk_size);
 }
 
 
@@ -385,9 +769,11 @@ template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Matrix<ValueType, LocalIndexType, GlobalIndexType>::read_distributed(
     const device_matrix_data<ValueType, GlobalIndexType>& data,
     std::shared_ptr<const Partition<local_index_type, global_index_type>>
-        partition)
+        partition,
+    assembly_mode assembly_type, size_type chunk_size)
 {
-    return this->read_distributed(data, partition, partition);
+    return this->read_distributed(data, partition, partition, assembly_type,
+                                  chunk_size);
 }
 
 
@@ -440,6 +826,353 @@ mpi::request Matrix<ValueType, LocalIndexType, GlobalIndexType>::communicate(
 }
 
 
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::unique_ptr<typename Matrix<ValueType, LocalIndexType,
+                                GlobalIndexType>::local_vector_type>
+Matrix<ValueType, LocalIndexType, GlobalIndexType>::exchange_ghost_rows(
+    ptr_param<const local_vector_type> local_b) const
+{
+    auto exec = this->get_executor();
+    const auto comm = this->get_communicator();
+    auto req =
+        this->communicate(make_temporary_clone(exec, local_b.get()).get());
+    req.wait();
+    auto result = local_vector_type::create(exec);
+    if (mpi::requires_host_buffer(exec, comm)) {
+        result->copy_from(host_recv_buffer_.get());
+    } else {
+        result->copy_from(recv_buffer_.get());
+    }
+    return result;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::set_progress_thread(
+    bool enabled)
+{
+    if (!enabled) {
+        progress_thread_.reset();
+    } else if (!progress_thread_ &&
+               gko::detail::progress_thread::is_supported()) {
+        progress_thread_ = std::make_shared<gko::detail::progress_thread>();
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::unique_ptr<Matrix<ValueType, LocalIndexType, GlobalIndexType>>
+Matrix<ValueType, LocalIndexType, GlobalIndexType>::multiply(
+    ptr_param<const Matrix> b) const
+{
+    using csr_type = gko::matrix::Csr<value_type, local_index_type>;
+    using plan_type =
+        gko::detail::distributed_spgemm_plan<value_type, local_index_type,
+                                             global_index_type>;
+    if (!row_partition_ || !col_partition_ || !b->row_partition_ ||
+        !b->col_partition_) {
+        GKO_NOT_SUPPORTED(this);
+    }
+    GKO_ASSERT_CONFORMANT(this, b);
+    GKO_ASSERT_EQ(local_mtx_->get_size()[1], b->local_mtx_->get_size()[0]);
+    auto exec = this->get_executor();
+    auto host_exec = exec->get_master();
+    const auto comm = this->get_communicator();
+    const auto num_ranks = comm.size();
+    const auto rank = comm.rank();
+    auto plan = std::make_shared<plan_type>();
+
+    // merge the local and non-local block of the owned rows of b, using
+    // global column indices sorted within each row
+    const auto b_local = to_csr<value_type, local_index_type>(
+        host_exec, b->local_mtx_.get());
+    const auto b_non_local = to_csr<value_type, local_index_type>(
+        host_exec, b->non_local_mtx_.get());
+    const auto b_local_cols =
+        local_to_global_idxs(b->col_partition_.get(), rank);
+    const auto b_non_local_cols =
+        make_temporary_clone(host_exec, &b->non_local_to_global_);
+    const auto b_local_nnz = b_local->get_num_stored_elements();
+    const auto num_owned_rows = b_local->get_size()[0];
+    std::vector<int64> owned_row_ptrs(num_owned_rows + 1);
+    std::vector<global_index_type> owned_cols;
+    std::vector<std::pair<global_index_type, int64>> row_entries;
+    for (size_type row = 0; row < num_owned_rows; ++row) {
+        row_entries.clear();
+        for (auto k = b_local->get_const_row_ptrs()[row];
+             k < b_local->get_const_row_ptrs()[row + 1]; ++k) {
+            row_entries.emplace_back(
+                b_local_cols[b_local->get_const_col_idxs()[k]], k);
+        }
+        for (auto k = b_non_local->get_const_row_ptrs()[row];
+             k < b_non_local->get_const_row_ptrs()[row + 1]; ++k) {
+            row_entries.emplace_back(
+                b_non_local_cols
+                    ->get_const_data()[b_non_local->get_const_col_idxs()[k]],
+                b_local_nnz + k);
+        }
+        std::sort(row_entries.begin(), row_entries.end());
+        for (const auto& entry : row_entries) {
+            owned_cols.push_back(entry.first);
+            plan->owned_src.push_back(entry.second);
+        }
+        owned_row_ptrs[row + 1] = owned_cols.size();
+    }
+
+    // send the rows of b that correspond to the non-local columns of other
+    // ranks, using the communication pattern of the SpMV
+    const auto host_gather_idxs = make_temporary_clone(host_exec, &gather_idxs_);
+    std::vector<comm_index_type> send_row_nnz(send_offsets_.back());
+    std::vector<comm_index_type> recv_row_nnz(recv_offsets_.back());
+    plan->send_sizes.assign(num_ranks, 0);
+    plan->send_offsets.assign(num_ranks + 1, 0);
+    plan->recv_sizes.assign(num_ranks, 0);
+    plan->recv_offsets.assign(num_ranks + 1, 0);
+    for (comm_index_type target = 0; target < num_ranks; ++target) {
+        for (auto i = send_offsets_[target]; i < send_offsets_[target + 1];
+             ++i) {
+            const auto row = host_gather_idxs->get_const_data()[i];
+            for (auto k = owned_row_ptrs[row]; k < owned_row_ptrs[row + 1];
+                 ++k) {
+                plan->send_entries.push_back(k);
+            }
+            send_row_nnz[i] = owned_row_ptrs[row + 1] - owned_row_ptrs[row];
+            plan->send_sizes[target] += send_row_nnz[i];
+        }
+    }
+    comm.all_to_all_v(host_exec, send_row_nnz.data(), send_sizes_.data(),
+                      send_offsets_.data(), recv_row_nnz.data(),
+                      recv_sizes_.data(), recv_offsets_.data());
+    for (comm_index_type source = 0; source < num_ranks; ++source) {
+        plan->recv_sizes[source] = std::accumulate(
+            recv_row_nnz.begin() + recv_offsets_[source],
+            recv_row_nnz.begin() + recv_offsets_[source + 1], 0);
+    }
+    std::partial_sum(plan->send_sizes.begin(), plan->send_sizes.end(),
+                     plan->send_offsets.begin() + 1);
+    std::partial_sum(plan->recv_sizes.begin(), plan->recv_sizes.end(),
+                     plan->recv_offsets.begin() + 1);
+    std::vector<global_index_type> send_cols(plan->send_entries.size());
+    std::transform(plan->send_entries.begin(), plan->send_entries.end(),
+                   send_cols.begin(),
+                   [&](int64 entry) { return owned_cols[entry]; });
+    std::vector<global_index_type> ghost_cols(plan->recv_offsets.back());
+    comm.all_to_all_v(host_exec, send_cols.data(), plan->send_sizes.data(),
+                      plan->send_offsets.data(), ghost_cols.data(),
+                      plan->recv_sizes.data(), plan->recv_offsets.data());
+
+    // compress the columns of the owned and received rows
+    plan->compact_cols = owned_cols;
+    plan->compact_cols.insert(plan->compact_cols.end(), ghost_cols.begin(),
+                              ghost_cols.end());
+    std::sort(plan->compact_cols.begin(), plan->compact_cols.end());
+    plan->compact_cols.erase(
+        std::unique(plan->compact_cols.begin(), plan->compact_cols.end()),
+        plan->compact_cols.end());
+    auto build_rows = [&](size_type num_rows, const auto& row_nnz,
+                          const std::vector<global_index_type>& cols) {
+        auto rows = csr_type::create(
+            host_exec, dim<2>{num_rows, plan->compact_cols.size()},
+            cols.size());
+        rows->get_row_ptrs()[0] = 0;
+        for (size_type row = 0; row < num_rows; ++row) {
+            rows->get_row_ptrs()[row + 1] =
+                rows->get_row_ptrs()[row] + row_nnz(row);
+        }
+        for (size_type k = 0; k < cols.size(); ++k) {
+            rows->get_col_idxs()[k] = static_cast<local_index_type>(
+                std::lower_bound(plan->compact_cols.begin(),
+                                 plan->compact_cols.end(), cols[k]) -
+                plan->compact_cols.begin());
+        }
+        return std::shared_ptr<csr_type>{gko::clone(exec, rows)};
+    };
+    plan->owned_rows = build_rows(
+        num_owned_rows,
+        [&](size_type row) {
+            return owned_row_ptrs[row + 1] - owned_row_ptrs[row];
+        },
+        owned_cols);
+    plan->ghost_rows = build_rows(
+        recv_row_nnz.size(), [&](size_type row) { return recv_row_nnz[row]; },
+        ghost_cols);
+
+    // read the product into the result
+    const auto product = make_temporary_clone(
+        host_exec,
+        compute_product(*plan, comm, local_mtx_.get(), non_local_mtx_.get(),
+                        b->local_mtx_.get(), b->non_local_mtx_.get()));
+    const auto row_idxs = local_to_global_idxs(row_partition_.get(), rank);
+    const auto product_nnz = product->get_num_stored_elements();
+    device_matrix_data<value_type, global_index_type> data{
+        host_exec, dim<2>{this->get_size()[0], b->get_size()[1]}, product_nnz};
+    for (size_type row = 0; row < product->get_size()[0]; ++row) {
+        for (auto k = product->get_const_row_ptrs()[row];
+             k < product->get_const_row_ptrs()[row + 1]; ++k) {
+            data.get_row_idxs()[k] = row_idxs[row];
+            data.get_col_idxs()[k] =
+                plan->compact_cols[product->get_const_col_idxs()[k]];
+            data.get_values()[k] = product->get_const_values()[k];
+        }
+    }
+    auto result = Matrix::create(exec, comm, csr_type::create(exec),
+                                 csr_type::create(exec));
+    result->read_distributed(
+        device_matrix_data<value_type, global_index_type>{exec, data},
+        row_partition_, b->col_partition_);
+
+    // find the entries of the product in the local and non-local block
+    const auto result_local = make_temporary_clone(
+        host_exec, as<csr_type>(result->local_mtx_.get()));
+    const auto result_non_local = make_temporary_clone(
+        host_exec, as<csr_type>(result->non_local_mtx_.get()));
+    const auto result_non_local_cols =
+        make_temporary_clone(host_exec, &result->non_local_to_global_);
+    plan->local_nnz = result_local->get_num_stored_elements();
+    plan->result_pos.resize(product_nnz);
+    auto find_entry = [](const csr_type* mtx, size_type row,
+                         local_index_type col) {
+        const auto begin = mtx->get_const_col_idxs() +
+                           mtx->get_const_row_ptrs()[row];
+        const auto end = mtx->get_const_col_idxs() +
+                         mtx->get_const_row_ptrs()[row + 1];
+        const auto it = std::find(begin, end, col);
+        GKO_ASSERT(it != end);
+        return static_cast<int64>(it - mtx->get_const_col_idxs());
+    };
+    for (size_type row = 0; row < product->get_size()[0]; ++row) {
+        for (auto k = product->get_const_row_ptrs()[row];
+             k < product->get_const_row_ptrs()[row + 1]; ++k) {
+            const auto col = data.get_const_col_idxs()[k];
+            const auto local_it =
+                std::lower_bound(b_local_cols.begin(), b_local_cols.end(), col);
+            if (local_it != b_local_cols.end() && *local_it == col) {
+                plan->result_pos[k] = find_entry(
+                    result_local.get(), row,
+                    static_cast<local_index_type>(local_it -
+                                                  b_local_cols.begin()));
+            } else {
+                const auto non_local_begin =
+                    result_non_local_cols->get_const_data();
+                const auto non_local_end =
+                    non_local_begin + result_non_local_cols->get_size();
+                const auto non_local_col = static_cast<local_index_type>(
+                    std::find(non_local_begin, non_local_end, col) -
+                    non_local_begin);
+                plan->result_pos[k] =
+                    plan->local_nnz +
+                    find_entry(result_non_local.get(), row, non_local_col);
+            }
+        }
+    }
+    result->spgemm_plan_ = std::move(plan);
+    return result;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::multiply_numeric(
+    ptr_param<const Matrix> b, ptr_param<Matrix> result) const
+{
+    using csr_type = gko::matrix::Csr<value_type, local_index_type>;
+    const auto plan = result->spgemm_plan_;
+    if (!plan) {
+        GKO_NOT_SUPPORTED(result);
+    }
+    GKO_ASSERT_CONFORMANT(this, b);
+    GKO_ASSERT_EQUAL_DIMENSIONS(
+        result, dim<2>(this->get_size()[0], b->get_size()[1]));
+    auto exec = this->get_executor();
+    auto host_exec = exec->get_master();
+    const auto product = make_temporary_clone(
+        host_exec,
+        compute_product(*plan, this->get_communicator(), local_mtx_.get(),
+                        non_local_mtx_.get(), b->local_mtx_.get(),
+                        b->non_local_mtx_.get()));
+    GKO_ASSERT_EQ(product->get_num_stored_elements(), plan->result_pos.size());
+    auto result_local =
+        make_temporary_clone(host_exec, as<csr_type>(result->local_mtx_.get()));
+    auto result_non_local = make_temporary_clone(
+        host_exec, as<csr_type>(result->non_local_mtx_.get()));
+    GKO_ASSERT_EQ(result_local->get_num_stored_elements(), plan->local_nnz);
+    for (size_type k = 0; k < plan->result_pos.size(); ++k) {
+        const auto pos = plan->result_pos[k];
+        const auto val = product->get_const_values()[k];
+        if (pos < static_cast<int64>(plan->local_nnz)) {
+            result_local->get_values()[pos] = val;
+        } else {
+            result_non_local->get_values()[pos - plan->local_nnz] = val;
+        }
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::unique_ptr<LinOp>
+Matrix<ValueType, LocalIndexType, GlobalIndexType>::transpose() const
+{
+    if (!row_partition_ || !col_partition_) {
+        GKO_NOT_SUPPORTED(this);
+    }
+    auto exec = this->get_executor();
+    const auto comm = this->get_communicator();
+    auto result = Matrix::create(exec, comm,
+                                 as<LinOp>(local_mtx_->create_default()),
+                                 as<LinOp>(non_local_mtx_->create_default()));
+    result->read_distributed(
+        transposed_data<value_type>(
+            exec, comm.rank(), this->get_size(), local_mtx_.get(),
+            non_local_mtx_.get(), non_local_to_global_, row_partition_.get(),
+            col_partition_.get(), false),
+        col_partition_, row_partition_, assembly_mode::communicate);
+    return result;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+std::unique_ptr<LinOp>
+Matrix<ValueType, LocalIndexType, GlobalIndexType>::conj_transpose() const
+{
+    if (!row_partition_ || !col_partition_) {
+        GKO_NOT_SUPPORTED(this);
+    }
+    auto exec = this->get_executor();
+    const auto comm = this->get_communicator();
+    auto result = Matrix::create(exec, comm,
+                                 as<LinOp>(local_mtx_->create_default()),
+                                 as<LinOp>(non_local_mtx_->create_default()));
+    result->read_distributed(
+        transposed_data<value_type>(
+            exec, comm.rank(), this->get_size(), local_mtx_.get(),
+            non_local_mtx_.get(), non_local_to_global_, row_partition_.get(),
+            col_partition_.get(), true),
+        col_partition_, row_partition_, assembly_mode::communicate);
+    return result;
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+template <typename Func>
+void Matrix<ValueType, LocalIndexType, GlobalIndexType>::overlap_communication(
+    mpi::request& req, Func&& local_apply) const
+{
+    auto exec = this->get_executor();
+    if (progress_thread_ &&
+        std::dynamic_pointer_cast<const OmpExecutor>(exec)) {
+        // the progress thread takes the place of one OpenMP thread
+        const auto num_threads = OmpExecutor::get_num_omp_threads();
+        progress_thread_->start(&req);
+        OmpExecutor::set_num_omp_threads(std::max(num_threads - 1, 1));
+        local_apply();
+        OmpExecutor::set_num_omp_threads(num_threads);
+        progress_thread_->finish();
+    } else {
+        local_apply();
+    }
+    req.wait();
+}
+
+
 template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
 void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
     const LinOp* b, LinOp* x) const
@@ -457,8 +1190,9 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
 
             auto comm = this->get_communicator();
             auto req = this->communicate(dense_b->get_local_vector());
-            local_mtx_->apply(dense_b->get_local_vector(), local_x);
-            req.wait();
+            this->overlap_communication(req, [&] {
+                local_mtx_->apply(dense_b->get_local_vector(), local_x);
+            });
 
             auto exec = this->get_executor();
             auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
@@ -490,9 +1224,10 @@ void Matrix<ValueType, LocalIndexType, GlobalIndexType>::apply_impl(
 
             auto comm = this->get_communicator();
             auto req = this->communicate(dense_b->get_local_vector());
-            local_mtx_->apply(local_alpha, dense_b->get_local_vector(),
-                              local_beta, local_x);
-            req.wait();
+            this->overlap_communication(req, [&] {
+                local_mtx_->apply(local_alpha, dense_b->get_local_vector(),
+                                  local_beta, local_x);
+            });
 
             auto exec = this->get_executor();
             auto use_host_buffer = mpi::requires_host_buffer(exec, comm);
@@ -544,6 +1279,10 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::operator=(
         send_sizes_ = other.send_sizes_;
         recv_sizes_ = other.recv_sizes_;
         non_local_to_global_ = other.non_local_to_global_;
+        row_partition_ = other.row_partition_;
+        col_partition_ = other.col_partition_;
+        spgemm_plan_ = other.spgemm_plan_;
+        this->set_progress_thread(other.has_progress_thread());
         one_scalar_.init(this->get_executor(), dim<2>{1, 1});
         one_scalar_->fill(one<value_type>());
     }
@@ -568,6 +1307,10 @@ Matrix<ValueType, LocalIndexType, GlobalIndexType>::operator=(Matrix&& other)
         send_sizes_ = std::move(other.send_sizes_);
         recv_sizes_ = std::move(other.recv_sizes_);
         non_local_to_global_ = std::move(other.non_local_to_global_);
+        row_partition_ = std::move(other.row_partition_);
+        col_partition_ = std::move(other.col_partition_);
+        spgemm_plan_ = std::move(other.spgemm_plan_);
+        progress_thread_ = std::move(other.progress_thread_);
         one_scalar_.init(this->get_executor(), dim<2>{1, 1});
         one_scalar_->fill(one<value_type>());
     }
@@ -5,12 +5,16 @@
 #include <ginkgo/core/distributed/preconditioner/schwarz.hpp>
 
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <vector>
 
 
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/temporary_conversion.hpp>
 #include <ginkgo/core/base/utils.hpp>
@@ -48,10 +52,75 @@ void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::apply_dense_impl(
 {
     using Vector = matrix::Dense<ValueType>;
     auto exec = this->get_executor();
+    if (this->coarse_basis_ != nullptr &&
+        !gko::detail::is_distributed(dense_b)) {
+        GKO_NOT_SUPPORTED(dense_b);
+    }
     if (this->local_solver_ != nullptr) {
         this->local_solver_->apply(gko::detail::get_local(dense_b),
                                    gko::detail::get_local(dense_x));
     }
+    if (this->coarse_basis_ != nullptr) {
+        this->apply_coarse(gko::detail::get_local(dense_b),
+                           gko::detail::get_local(dense_x));
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::apply_coarse(
+    const gko::matrix::Dense<ValueType>* local_b,
+    gko::matrix::Dense<ValueType>* local_x) const
+{
+    constexpr int root = 0;
+    auto exec = this->get_executor();
+    auto host_exec = exec->get_master();
+    const auto& comm = coarse_comm_;
+    const auto num_basis = coarse_basis_->get_size()[1];
+    const auto num_rhs = local_b->get_size()[1];
+
+    // restrict the local residual onto the local coarse basis vectors
+    local_coarse_b_.init(exec, dim<2>{num_basis, num_rhs});
+    host_local_coarse_b_.init(host_exec, dim<2>{num_basis, num_rhs});
+    coarse_restriction_->apply(local_b, local_coarse_b_.get());
+    host_local_coarse_b_->copy_from(local_coarse_b_.get());
+
+    // the coarse vectors are stored row-major, so the blocks of the different
+    // ranks are contiguous and can be gathered directly
+    const auto send_count = static_cast<int>(num_basis * num_rhs);
+    std::vector<int> counts;
+    std::vector<int> displs;
+    ValueType* coarse_values = nullptr;
+    if (comm.rank() == root) {
+        const auto num_ranks = comm.size();
+        counts.resize(num_ranks);
+        displs.resize(num_ranks);
+        for (int i = 0; i < num_ranks; ++i) {
+            counts[i] = static_cast<int>(
+                (coarse_offsets_[i + 1] - coarse_offsets_[i]) * num_rhs);
+            displs[i] = static_cast<int>(coarse_offsets_[i] * num_rhs);
+        }
+        auto coarse_size =
+            dim<2>{static_cast<size_type>(coarse_offsets_.back()), num_rhs};
+        coarse_b_.init(host_exec, coarse_size);
+        coarse_x_.init(exec, coarse_size);
+        coarse_x_->fill(zero<ValueType>());
+        coarse_values = coarse_b_->get_values();
+    }
+    comm.gather_v(host_exec, host_local_coarse_b_->get_const_values(),
+                  send_count, coarse_values, counts.data(), displs.data(),
+                  root);
+    if (comm.rank() == root) {
+        coarse_solver_->apply(coarse_b_.get(), coarse_x_.get());
+        coarse_b_->copy_from(coarse_x_.get());
+    }
+    comm.scatter_v(host_exec, coarse_values, counts.data(), displs.data(),
+                   host_local_coarse_b_->get_values(), send_count, root);
+
+    // prolongate the local coarse solution and add it to the local solution
+    local_coarse_b_->copy_from(host_local_coarse_b_.get());
+    coarse_basis_->apply(coarse_one_, local_coarse_b_.get(), coarse_one_,
+                         local_x);
 }
 
 
@@ -107,6 +176,154 @@ void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::generate(
     } else {
         this->set_solver(parameters_.generated_local_solver);
     }
+
+    if (parameters_.coarse_solver) {
+        this->generate_coarse(
+            as<experimental::distributed::Matrix<ValueType, LocalIndexType,
+                                                 GlobalIndexType>>(
+                system_matrix.get()));
+    }
+}
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+void Schwarz<ValueType, LocalIndexType, GlobalIndexType>::generate_coarse(
+    const Matrix<ValueType, LocalIndexType, GlobalIndexType>* system_matrix)
+{
+    using Vector = gko::matrix::Dense<ValueType>;
+    using Csr = gko::matrix::Csr<ValueType, LocalIndexType>;
+    constexpr int root = 0;
+    auto exec = this->get_executor();
+    auto host_exec = exec->get_master();
+    auto comm = system_matrix->get_communicator();
+    const auto rank = comm.rank();
+    const auto num_ranks = comm.size();
+    const auto num_local_rows =
+        system_matrix->get_local_matrix()->get_size()[0];
+
+    std::shared_ptr<Vector> basis;
+    if (parameters_.coarse_basis) {
+        GKO_ASSERT_EQUAL_ROWS(parameters_.coarse_basis, system_matrix);
+        basis = gko::clone(exec, parameters_.coarse_basis->get_local_vector());
+    } else {
+        basis = Vector::create(exec, dim<2>{num_local_rows, 1});
+        basis->fill(one<ValueType>());
+    }
+    GKO_ASSERT_EQ(basis->get_size()[0], num_local_rows);
+    // empty subdomains don't contribute any basis vectors, since they would
+    // lead to a singular coarse matrix
+    const auto local_num_basis = static_cast<comm_index_type>(
+        num_local_rows > 0 ? basis->get_size()[1] : 0);
+    std::vector<comm_index_type> all_num_basis(num_ranks);
+    comm.all_gather(host_exec, &local_num_basis, 1, all_num_basis.data(), 1);
+    comm_index_type num_basis = 0;
+    for (auto other_num_basis : all_num_basis) {
+        if (other_num_basis != 0 && num_basis != 0 &&
+            other_num_basis != num_basis) {
+            GKO_INVALID_STATE(
+                "The coarse basis needs to have the same number of columns "
+                "on all ranks");
+        }
+        num_basis = std::max(num_basis, other_num_basis);
+    }
+    if (num_basis == 0) {
+        GKO_INVALID_STATE("The coarse basis needs at least one column");
+    }
+    if (local_num_basis == 0) {
+        // the ghost exchange requires the same number of columns everywhere
+        basis = Vector::create(exec,
+                               dim<2>{0, static_cast<size_type>(num_basis)});
+    }
+    std::vector<comm_index_type> offsets(num_ranks + 1, 0);
+    std::partial_sum(all_num_basis.begin(), all_num_basis.end(),
+                     offsets.begin() + 1);
+    auto restriction = share(as<Vector>(basis->conj_transpose()));
+
+    // the row block of this rank in Z^H A Z consists of Z_r^H A_rr Z_r and
+    // Z_r^H A_rs Z_s for each neighbor s, where the local rows of Z_s that are
+    // required are exchanged like the ghost values of an SpMV.
+    std::vector<LocalIndexType> row_idxs;
+    std::vector<LocalIndexType> col_idxs;
+    std::vector<ValueType> values;
+    const auto block_size = static_cast<size_type>(num_basis);
+    auto tmp = Vector::create(exec, dim<2>{num_local_rows, block_size});
+    auto block = Vector::create(exec, dim<2>{block_size, block_size});
+    auto add_block = [&](comm_index_type col_rank) {
+        restriction->apply(tmp, block);
+        auto host_block = make_temporary_clone(host_exec, block);
+        for (size_type i = 0; i < block_size; ++i) {
+            for (size_type j = 0; j < block_size; ++j) {
+                const auto value = host_block->at(i, j);
+                if (is_nonzero(value)) {
+                    row_idxs.push_back(
+                        static_cast<LocalIndexType>(offsets[rank] + i));
+                    col_idxs.push_back(
+                        static_cast<LocalIndexType>(offsets[col_rank] + j));
+                    values.push_back(value);
+                }
+            }
+        }
+    };
+    // the exchange is collective, so it has to happen on empty ranks too
+    auto ghost_basis = system_matrix->exchange_ghost_rows(basis);
+    if (local_num_basis > 0) {
+        system_matrix->get_local_matrix()->apply(basis, tmp);
+        add_block(rank);
+        auto non_local = Csr::create(exec);
+        as<ConvertibleTo<Csr>>(system_matrix->get_non_local_matrix())
+            ->convert_to(non_local);
+        const auto& recv_offsets = system_matrix->get_recv_offsets();
+        for (comm_index_type col_rank = 0; col_rank < num_ranks; ++col_rank) {
+            if (recv_offsets[col_rank + 1] == recv_offsets[col_rank]) {
+                continue;
+            }
+            span ghost_span{static_cast<size_type>(recv_offsets[col_rank]),
+                            static_cast<size_type>(recv_offsets[col_rank + 1])};
+            non_local->create_submatrix(span{0, num_local_rows}, ghost_span)
+                ->apply(ghost_basis->create_submatrix(ghost_span,
+                                                      span{0, block_size}),
+                        tmp);
+            add_block(col_rank);
+        }
+    }
+
+    // gather the coarse matrix on the root rank and generate the solver there
+    const auto num_entries = static_cast<int>(values.size());
+    std::vector<int> recv_counts(num_ranks);
+    std::vector<int> recv_offsets_coarse(num_ranks + 1, 0);
+    comm.gather(host_exec, &num_entries, 1, recv_counts.data(), 1, root);
+    std::partial_sum(recv_counts.begin(), recv_counts.end(),
+                     recv_offsets_coarse.begin() + 1);
+    const auto coarse_size = static_cast<size_type>(offsets.back());
+    matrix_data<ValueType, LocalIndexType> coarse_data{
+        dim<2>{coarse_size, coarse_size}};
+    std::vector<LocalIndexType> all_row_idxs(recv_offsets_coarse.back());
+    std::vector<LocalIndexType> all_col_idxs(recv_offsets_coarse.back());
+    std::vector<ValueType> all_values(recv_offsets_coarse.back());
+    comm.gather_v(host_exec, row_idxs.data(), num_entries, all_row_idxs.data(),
+                  recv_counts.data(), recv_offsets_coarse.data(), root);
+    comm.gather_v(host_exec, col_idxs.data(), num_entries, all_col_idxs.data(),
+                  recv_counts.data(), recv_offsets_coarse.data(), root);
+    comm.gather_v(host_exec, values.data(), num_entries, all_values.data(),
+                  recv_counts.data(), recv_offsets_coarse.data(), root);
+    if (rank == root) {
+        for (size_type i = 0; i < all_values.size(); ++i) {
+            coarse_data.nonzeros.emplace_back(all_row_idxs[i], all_col_idxs[i],
+                                              all_values[i]);
+        }
+        coarse_data.sort_row_major();
+        auto coarse_matrix = share(Csr::create(exec));
+        coarse_matrix->read(coarse_data);
+        coarse_solver_ =
+            share(parameters_.coarse_solver->generate(coarse_matrix));
+    } else {
+        coarse_solver_ = nullptr;
+    }
+    coarse_comm_ = comm;
+    coarse_offsets_ = std::move(offsets);
+    coarse_basis_ = std::move(basis);
+    coarse_restriction_ = std::move(restriction);
+    coarse_one_ = initialize<Vector>({one<ValueType>()}, exec);
 }
 
 
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/distributed/progress_thread.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace detail {
+
+
+progress_thread::progress_thread()
+    : req_{nullptr},
+      active_{false},
+      shutdown_{false},
+      thread_{[this] { this->run(); }}
+{}
+
+
+progress_thread::~progress_thread()
+{
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        shutdown_ = true;
+        active_ = false;
+    }
+    cv_.notify_all();
+    thread_.join();
+}
+
+
+void progress_thread::start(experimental::mpi::request* req)
+{
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        req_ = req;
+        active_ = true;
+    }
+    cv_.notify_all();
+}
+
+
+void progress_thread::finish()
+{
+    std::unique_lock<std::mutex> guard{mutex_};
+    active_ = false;
+    // wait until the thread has stopped testing the request
+    cv_.wait(guard, [this] { return req_ == nullptr; });
+}
+
+
+bool progress_thread::is_supported()
+{
+    int provided = MPI_THREAD_SINGLE;
+    GKO_ASSERT_NO_MPI_ERRORS(MPI_Query_thread(&provided));
+    return provided >= MPI_THREAD_SERIALIZED;
+}
+
+
+void progress_thread::run()
+{
+    std::unique_lock<std::mutex> guard{mutex_};
+    while (true) {
+        cv_.wait(guard, [this] { return shutdown_ || req_ != nullptr; });
+        if (shutdown_) {
+            return;
+        }
+        // test the request without holding the lock, so finish() can
+        // interrupt us
+        auto req = req_;
+        bool completed = false;
+        while (!completed && active_) {
+            guard.unlock();
+            completed = req->test();
+            std::this_thread::yield();
+            guard.lock();
+        }
+        req_ = nullptr;
+        cv_.notify_all();
+    }
+}
+
+
+}  // namespace detail
+}  // namespace gko
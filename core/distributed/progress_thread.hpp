@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_DISTRIBUTED_PROGRESS_THREAD_HPP_
+#define GKO_CORE_DISTRIBUTED_PROGRESS_THREAD_HPP_
+
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+
+#include <ginkgo/config.hpp>
+#include <ginkgo/core/base/mpi.hpp>
+
+
+namespace gko {
+namespace detail {
+
+
+/**
+ * A thread that drives the progress of a non-blocking MPI operation by
+ * repeatedly testing its request while the calling thread computes.
+ *
+ * Only one request is driven at a time. Between start() and finish(), the
+ * calling thread must not use MPI, so MPI_THREAD_SERIALIZED is sufficient.
+ */
+class progress_thread {
+public:
+    progress_thread();
+
+    ~progress_thread();
+
+    progress_thread(const progress_thread&) = delete;
+
+    progress_thread& operator=(const progress_thread&) = delete;
+
+    /**
+     * Starts testing the request until it completes or finish() is called.
+     *
+     * @param req  the request to drive, it must stay valid until finish()
+     *             returns.
+     */
+    void start(experimental::mpi::request* req);
+
+    /**
+     * Stops testing the request. Once this returns, the progress thread no
+     * longer uses MPI, and the request can be waited on.
+     */
+    void finish();
+
+    /**
+     * Checks whether MPI was initialized with enough thread support to use a
+     * progress thread.
+     */
+    static bool is_supported();
+
+private:
+    void run();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    experimental::mpi::request* req_;
+    bool active_;
+    bool shutdown_;
+    std::thread thread_;
+};
+
+
+}  // namespace detail
+}  // namespace gko
+
+
+#endif  // GKO_CORE_DISTRIBUTED_PROGRESS_THREAD_HPP_
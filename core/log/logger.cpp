@@ -51,6 +51,14 @@ constexpr Logger::mask_type Logger::batch_solver_completed_mask;
 
 constexpr Logger::mask_type Logger::iteration_complete_mask;
 
+constexpr Logger::mask_type Logger::multigrid_level_generated_mask;
+
+constexpr Logger::mask_type Logger::cached_allocation_completed_mask;
+
+constexpr Logger::mask_type Logger::operation_work_reported_mask;
+
+constexpr Logger::mask_type Logger::krylov_storage_precision_selected_mask;
+
 
 }  // namespace log
 }  // namespace gko
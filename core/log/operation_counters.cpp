@@ -0,0 +1,397 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/log/operation_counters.hpp>
+
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <thread>
+#include <utility>
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+using steady_clock = std::chrono::steady_clock;
+
+
+// the maximum nesting depth of operations for which we measure times
+constexpr int max_operation_depth = 16;
+
+
+// the number of loggers each thread remembers its counters for
+constexpr int thread_cache_size = 4;
+
+
+std::atomic<uint64> next_logger_id{1};
+
+
+struct atomic_event_counter {
+    std::atomic<uint64> count{};
+    std::atomic<uint64> time_ns{};
+};
+
+
+struct atomic_operation_counter {
+    std::atomic<const char*> name{};
+    std::atomic<uint64> count{};
+    std::atomic<uint64> time_ns{};
+    std::atomic<uint64> flops{};
+    std::atomic<uint64> bytes{};
+};
+
+
+void add(std::atomic<uint64>& counter, uint64 value)
+{
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+
+uint64 read(std::atomic<uint64>& counter, bool reset)
+{
+    return reset ? counter.exchange(0, std::memory_order_relaxed)
+                 : counter.load(std::memory_order_relaxed);
+}
+
+
+uint64 elapsed_ns(steady_clock::time_point begin, steady_clock::time_point end)
+{
+    return static_cast<uint64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+            .count());
+}
+
+
+}  // namespace
+
+
+/**
+ * The counters of a single thread. All atomic members may be read by other
+ * threads at any time, but only the owning thread increments them. The
+ * remaining members are only accessed by the owning thread.
+ */
+struct OperationCounters::thread_counters {
+    thread_counters(std::thread::id thread, size_type max_operations)
+        : thread{thread},
+          max_operations{max_operations},
+          capacity_bits{1},
+          num_operations{}
+    {
+        // keep the hash table at most half full
+        while ((size_type{1} << capacity_bits) < 2 * max_operations) {
+            capacity_bits++;
+        }
+        // the additional last entry collects all other operations
+        operations.reset(new atomic_operation_counter[get_capacity() + 1]);
+        operations[get_capacity()].name.store("other",
+                                              std::memory_order_release);
+    }
+
+    size_type get_capacity() const { return size_type{1} << capacity_bits; }
+
+    atomic_operation_counter& find_operation(const char* name)
+    {
+        // Fibonacci hashing of the name pointer, which is the same for all
+        // instances of an operation
+        const auto hash =
+            (reinterpret_cast<uintptr>(name) * uint64{11400714819323198485u}) >>
+            (64 - capacity_bits);
+        const auto mask = get_capacity() - 1;
+        for (size_type probe = 0; probe <= mask; probe++) {
+            auto& entry = operations[(hash + probe) & mask];
+            const auto entry_name = entry.name.load(std::memory_order_relaxed);
+            if (entry_name == name) {
+                return entry;
+            }
+            if (entry_name == nullptr) {
+                if (num_operations >= max_operations) {
+                    break;
+                }
+                num_operations++;
+                entry.name.store(name, std::memory_order_release);
+                return entry;
+            }
+        }
+        return operations[get_capacity()];
+    }
+
+    void begin(event_class cls, steady_clock::time_point now)
+    {
+        const auto i = static_cast<size_type>(cls);
+        if (depth[i]++ == 0) {
+            start[i] = now;
+        }
+    }
+
+    void end(event_class cls, steady_clock::time_point now)
+    {
+        const auto i = static_cast<size_type>(cls);
+        add(events[i].count, 1);
+        // the logger may have been added in the middle of an event
+        if (depth[i] > 0 && --depth[i] == 0) {
+            add(events[i].time_ns, elapsed_ns(start[i], now));
+        }
+    }
+
+    std::thread::id thread;
+    std::array<atomic_event_counter, num_event_classes> events;
+    std::atomic<uint64> bytes_allocated{};
+    std::atomic<uint64> bytes_copied{};
+    size_type max_operations;
+    int capacity_bits;
+    std::unique_ptr<atomic_operation_counter[]> operations;
+    // only accessed by the owning thread
+    size_type num_operations;
+    std::array<int, num_event_classes> depth{};
+    std::array<steady_clock::time_point, num_event_classes> start{};
+    std::array<std::pair<atomic_operation_counter*, steady_clock::time_point>,
+               max_operation_depth>
+        operation_stack{};
+    int operation_depth{};
+};
+
+
+constexpr size_type OperationCounters::num_event_classes;
+constexpr Logger::mask_type OperationCounters::default_mask;
+
+
+OperationCounters::OperationCounters(const mask_type& enabled_events,
+                                     size_type max_operations)
+    : Logger(enabled_events),
+      id_{next_logger_id.fetch_add(1, std::memory_order_relaxed)},
+      max_operations_{std::max<size_type>(max_operations, 1)}
+{}
+
+
+OperationCounters::~OperationCounters() = default;
+
+
+OperationCounters::thread_counters& OperationCounters::get_thread_counters()
+    const
+{
+    struct cache_entry {
+        uint64 logger_id;
+        thread_counters* counters;
+    };
+    // logger ids are never reused, so entries of destroyed loggers can never
+    // match again
+    thread_local std::array<cache_entry, thread_cache_size> cache{};
+    thread_local int next_cache_entry{};
+    for (const auto& entry : cache) {
+        if (entry.logger_id == id_) {
+            return *entry.counters;
+        }
+    }
+    // first event of this thread for this logger (or evicted from the cache)
+    std::lock_guard<std::mutex> guard{mutex_};
+    const auto thread = std::this_thread::get_id();
+    auto it = std::find_if(threads_.begin(), threads_.end(),
+                           [&](const std::unique_ptr<thread_counters>& ptr) {
+                               return ptr->thread == thread;
+                           });
+    if (it == threads_.end()) {
+        threads_.push_back(
+            std::make_unique<thread_counters>(thread, max_operations_));
+        it = threads_.end() - 1;
+    }
+    cache[next_cache_entry] = cache_entry{id_, it->get()};
+    next_cache_entry = (next_cache_entry + 1) % thread_cache_size;
+    return **it;
+}
+
+
+void OperationCounters::on_allocation_started(const Executor*,
+                                              const size_type&) const
+{
+    get_thread_counters().begin(event_class::allocation, steady_clock::now());
+}
+
+
+void OperationCounters::on_allocation_completed(const Executor*,
+                                                const size_type& num_bytes,
+                                                const uintptr&) const
+{
+    const auto now = steady_clock::now();
+    auto& counters = get_thread_counters();
+    counters.end(event_class::allocation, now);
+    add(counters.bytes_allocated, num_bytes);
+}
+
+
+void OperationCounters::on_free_started(const Executor*, const uintptr&) const
+{
+    get_thread_counters().begin(event_class::free, steady_clock::now());
+}
+
+
+void OperationCounters::on_free_completed(const Executor*,
+                                          const uintptr&) const
+{
+    get_thread_counters().end(event_class::free, steady_clock::now());
+}
+
+
+void OperationCounters::on_copy_started(const Executor*, const Executor*,
+                                        const uintptr&, const uintptr&,
+                                        const size_type&) const
+{
+    get_thread_counters().begin(event_class::copy, steady_clock::now());
+}
+
+
+void OperationCounters::on_copy_completed(const Executor*, const Executor*,
+                                          const uintptr&, const uintptr&,
+                                          const size_type& num_bytes) const
+{
+    const auto now = steady_clock::now();
+    auto& counters = get_thread_counters();
+    counters.end(event_class::copy, now);
+    add(counters.bytes_copied, num_bytes);
+}
+
+
+void OperationCounters::on_operation_launched(const Executor*,
+                                              const Operation* operation) const
+{
+    auto& counters = get_thread_counters();
+    auto& entry = counters.find_operation(operation->get_name());
+    const auto now = steady_clock::now();
+    if (counters.operation_depth < max_operation_depth) {
+        counters.operation_stack[counters.operation_depth] = {&entry, now};
+    }
+    counters.operation_depth++;
+    counters.begin(event_class::operation, now);
+}
+
+
+void OperationCounters::on_operation_completed(const Executor*,
+                                               const Operation*) const
+{
+    const auto now = steady_clock::now();
+    auto& counters = get_thread_counters();
+    counters.end(event_class::operation, now);
+    if (counters.operation_depth == 0) {
+        // the logger was added while the operation was running
+        return;
+    }
+    counters.operation_depth--;
+    if (counters.operation_depth < max_operation_depth) {
+        const auto& top = counters.operation_stack[counters.operation_depth];
+        add(top.first->count, 1);
+        add(top.first->time_ns, elapsed_ns(top.second, now));
+    }
+}
+
+
+void OperationCounters::on_operation_work_reported(
+    const Executor*, const Operation* operation, const size_type& flops,
+    const size_type& bytes) const
+{
+    auto& entry = get_thread_counters().find_operation(operation->get_name());
+    add(entry.flops, flops);
+    add(entry.bytes, bytes);
+}
+
+
+void OperationCounters::on_linop_apply_started(const LinOp*, const LinOp*,
+                                               const LinOp*) const
+{
+    get_thread_counters().begin(event_class::apply, steady_clock::now());
+}
+
+
+void OperationCounters::on_linop_apply_completed(const LinOp*, const LinOp*,
+                                                 const LinOp*) const
+{
+    get_thread_counters().end(event_class::apply, steady_clock::now());
+}
+
+
+void OperationCounters::on_linop_advanced_apply_started(const LinOp*,
+                                                        const LinOp*,
+                                                        const LinOp*,
+                                                        const LinOp*,
+                                                        const LinOp*) const
+{
+    get_thread_counters().begin(event_class::apply, steady_clock::now());
+}
+
+
+void OperationCounters::on_linop_advanced_apply_completed(const LinOp*,
+                                                          const LinOp*,
+                                                          const LinOp*,
+                                                          const LinOp*,
+                                                          const LinOp*) const
+{
+    get_thread_counters().end(event_class::apply, steady_clock::now());
+}
+
+
+void OperationCounters::on_linop_factory_generate_started(
+    const LinOpFactory*, const LinOp*) const
+{
+    get_thread_counters().begin(event_class::generate, steady_clock::now());
+}
+
+
+void OperationCounters::on_linop_factory_generate_completed(
+    const LinOpFactory*, const LinOp*, const LinOp*) const
+{
+    get_thread_counters().end(event_class::generate, steady_clock::now());
+}
+
+
+OperationCounters::snapshot OperationCounters::get_snapshot(bool reset) const
+{
+    snapshot result;
+    std::map<std::string, operation_counter> operations;
+    std::lock_guard<std::mutex> guard{mutex_};
+    for (const auto& counters : threads_) {
+        for (size_type i = 0; i < num_event_classes; i++) {
+            result.events[i].count += read(counters->events[i].count, reset);
+            result.events[i].time += std::chrono::nanoseconds{
+                static_cast<int64>(read(counters->events[i].time_ns, reset))};
+        }
+        result.bytes_allocated += read(counters->bytes_allocated, reset);
+        result.bytes_copied += read(counters->bytes_copied, reset);
+        for (size_type i = 0; i <= counters->get_capacity(); i++) {
+            auto& entry = counters->operations[i];
+            const auto name = entry.name.load(std::memory_order_acquire);
+            if (name == nullptr) {
+                continue;
+            }
+            const auto count = read(entry.count, reset);
+            const auto time_ns = read(entry.time_ns, reset);
+            const auto flops = read(entry.flops, reset);
+            const auto bytes = read(entry.bytes, reset);
+            if (count == 0 && flops == 0 && bytes == 0) {
+                continue;
+            }
+            auto& op = operations[name];
+            op.name = name;
+            op.count += count;
+            op.time += std::chrono::nanoseconds{static_cast<int64>(time_ns)};
+            op.flops += flops;
+            op.bytes += bytes;
+        }
+    }
+    for (auto& pair : operations) {
+        result.operations.push_back(std::move(pair.second));
+    }
+    return result;
+}
+
+
+void OperationCounters::reset() const { get_snapshot(true); }
+
+
+}  // namespace log
+}  // namespace gko
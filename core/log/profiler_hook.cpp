@@ -94,6 +94,17 @@ void ProfilerHook::on_operation_completed(const Executor* exec,
 }
 
 
+void ProfilerHook::on_operation_work_reported(const Executor*,
+                                              const Operation* operation,
+                                              const size_type& flops,
+                                              const size_type& bytes) const
+{
+    if (this->work_hook_) {
+        this->work_hook_(operation->get_name(), flops, bytes);
+    }
+}
+
+
 void ProfilerHook::on_polymorphic_object_copy_started(
     const Executor* exec, const PolymorphicObject* from,
     const PolymorphicObject* to) const
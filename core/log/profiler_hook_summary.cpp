@@ -198,6 +198,24 @@ struct summary : summary_base {
         overhead += (cpu_now4 - cpu_now3) + (cpu_now2 - cpu_now);
     }
 
+    void add_work(const char* name, size_type flops, size_type bytes)
+    {
+        if (broken) {
+            return;
+        }
+        std::lock_guard<std::mutex> guard{mutex};
+        auto it = name_map.find(name);
+        if (it == name_map.end()) {
+            const auto new_id = static_cast<int64>(entries.size());
+            it = name_map.emplace_hint(it, name, new_id);
+            entries.emplace_back();
+            entries.back().name = name;
+        }
+        auto& entry = entries[it->second];
+        entry.flops += flops;
+        entry.bytes += bytes;
+    }
+
     const std::string& get_top_name() const
     {
         return entries[stack.back().first].name;
@@ -212,6 +230,8 @@ struct nested_summary : summary_base {
         int64 parent_id;
         std::chrono::nanoseconds elapsed{};
         int64 count{};
+        size_type flops{};
+        size_type bytes{};
 
         entry(int64 name_id, int64 node_id, int64 parent_id)
             : name_id{name_id}, node_id{node_id}, parent_id{parent_id}
@@ -318,6 +338,20 @@ struct nested_summary : summary_base {
         overhead += (cpu_now4 - cpu_now3) + (cpu_now2 - cpu_now);
     }
 
+    void add_work(const char* name, size_type flops, size_type bytes)
+    {
+        if (broken) {
+            return;
+        }
+        std::lock_guard<std::mutex> guard{mutex};
+        // the work is reported before the range is pushed, so it belongs to
+        // a child of the current top of the stack
+        const auto name_id = get_or_add_name_id(name);
+        auto& node = nodes[get_or_add_node_id(name_id)];
+        node.flops += flops;
+        node.bytes += bytes;
+    }
+
     const std::string& get_top_name() const
     {
         return names[stack.back().name_id];
@@ -357,6 +391,8 @@ ProfilerHook::nested_summary_entry build_tree(const nested_summary& summary)
         entry.name = summary.names[summary_node.name_id];
         entry.elapsed = summary_node.elapsed;
         entry.count = summary_node.count;
+        entry.flops = summary_node.flops;
+        entry.bytes = summary_node.bytes;
         const auto child_range = child_ranges[summary_node.node_id];
         for (auto i = child_range.first; i < child_range.second; i++) {
             entry.children.emplace_back();
@@ -386,9 +422,14 @@ std::shared_ptr<ProfilerHook> ProfilerHook::create_summary(
             delete ptr;
         }};
     data->check_nesting = debug_check_nesting;
-    return std::shared_ptr<ProfilerHook>{new ProfilerHook{
+    std::shared_ptr<ProfilerHook> hook{new ProfilerHook{
         [data](const char* name, profile_event_category) { data->push(name); },
         [data](const char* name, profile_event_category) { data->pop(name); }}};
+    hook->work_hook_ = [data](const char* name, size_type flops,
+                              size_type bytes) {
+        data->add_work(name, flops, bytes);
+    };
+    return hook;
 }
 
 
@@ -408,9 +449,14 @@ std::shared_ptr<ProfilerHook> ProfilerHook::create_nested_summary(
             delete ptr;
         }};
     data->check_nesting = debug_check_nesting;
-    return std::shared_ptr<ProfilerHook>{new ProfilerHook{
+    std::shared_ptr<ProfilerHook> hook{new ProfilerHook{
         [data](const char* name, profile_event_category) { data->push(name); },
         [data](const char* name, profile_event_category) { data->pop(name); }}};
+    hook->work_hook_ = [data](const char* name, size_type flops,
+                              size_type bytes) {
+        data->add_work(name, flops, bytes);
+    };
+    return hook;
 }
 
 
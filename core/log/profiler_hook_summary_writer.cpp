@@ -2,7 +2,9 @@
 //
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <numeric>
 
 
@@ -53,6 +55,16 @@ std::string format_fraction(std::chrono::nanoseconds part,
 }
 
 
+std::string format_rate(double amount, std::chrono::nanoseconds time)
+{
+    std::stringstream ss;
+    ss << std::setprecision(2) << std::fixed;
+    // amount per nanosecond is equal to giga-amount per second
+    ss << amount / std::max<double>(time.count(), 1.0);
+    return ss.str();
+}
+
+
 template <std::size_t size>
 void print_table(const std::array<std::string, size>& headers,
                  const std::vector<std::array<std::string, size>>& table,
@@ -129,6 +141,56 @@ void ProfilerHook::TableSummaryWriter::write(
 }
 
 
+ProfilerHook::RooflineSummaryWriter::RooflineSummaryWriter(
+    std::ostream& output, std::string header, double peak_bandwidth)
+    : output_{&output},
+      header_{std::move(header)},
+      peak_bandwidth_{peak_bandwidth}
+{}
+
+
+void ProfilerHook::RooflineSummaryWriter::write(
+    const std::vector<summary_entry>& entries, std::chrono::nanoseconds)
+{
+    (*output_) << header_ << '\n';
+    std::vector<summary_entry> sorted_entries;
+    std::copy_if(entries.begin(), entries.end(),
+                 std::back_inserter(sorted_entries),
+                 [](const summary_entry& entry) { return entry.bytes > 0; });
+    std::sort(sorted_entries.begin(), sorted_entries.end(),
+              [](const summary_entry& lhs, const summary_entry& rhs) {
+                  // reverse-sort by inclusive total time
+                  return lhs.inclusive > rhs.inclusive;
+              });
+    std::vector<std::array<std::string, 7>> table;
+    std::array<std::string, 7> headers(
+        {" name ", " total ", " count ", " GFLOP/s ", " GB/s ", " FLOP/byte ",
+         " peak bandwidth "});
+    for (const auto& entry : sorted_entries) {
+        std::stringstream intensity;
+        intensity << std::setprecision(3) << std::fixed
+                  << double(entry.flops) / double(entry.bytes);
+        const auto bandwidth =
+            double(entry.bytes) / std::max<double>(entry.inclusive.count(), 1);
+        std::stringstream peak_fraction;
+        if (peak_bandwidth_ > 0.0) {
+            peak_fraction << std::setprecision(1) << std::fixed
+                          << bandwidth / peak_bandwidth_ * 100.0 << " %";
+        } else {
+            peak_fraction << "-";
+        }
+        table.emplace_back(std::array<std::string, 7>{
+            " " + entry.name + " ",
+            " " + format_duration(entry.inclusive) + " ",
+            " " + std::to_string(entry.count) + " ",
+            " " + format_rate(entry.flops, entry.inclusive) + " ",
+            " " + format_rate(entry.bytes, entry.inclusive) + " ",
+            " " + intensity.str() + " ", " " + peak_fraction.str() + " "});
+    }
+    print_table(headers, table, *output_);
+}
+
+
 void ProfilerHook::TableSummaryWriter::write_nested(
     const nested_summary_entry& root, std::chrono::nanoseconds overhead)
 {
@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+#include "core/log/profiler_hook.hpp"
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+using cpu_clock = std::chrono::steady_clock;
+
+
+const char* category_name(profile_event_category category)
+{
+    switch (category) {
+    case profile_event_category::memory:
+        return "memory";
+    case profile_event_category::operation:
+        return "operation";
+    case profile_event_category::object:
+        return "object";
+    case profile_event_category::linop:
+        return "linop";
+    case profile_event_category::factory:
+        return "factory";
+    case profile_event_category::solver:
+        return "solver";
+    case profile_event_category::criterion:
+        return "criterion";
+    case profile_event_category::user:
+        return "user";
+    case profile_event_category::internal:
+    default:
+        return "internal";
+    }
+}
+
+
+void write_json_string(std::ostream& output, const std::string& str)
+{
+    output << '"';
+    for (const auto c : str) {
+        if (c == '"' || c == '\\') {
+            output << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x",
+                          static_cast<unsigned>(c));
+            output << escaped;
+        } else {
+            output << c;
+        }
+    }
+    output << '"';
+}
+
+
+/**
+ * Collects begin and end events and writes them in the Chrome trace event
+ * JSON format, which can be displayed by Perfetto and chrome://tracing.
+ */
+struct trace {
+    struct event {
+        int64 name_id;
+        int64 thread_id;
+        std::chrono::nanoseconds time;
+        profile_event_category category;
+        bool begin;
+    };
+
+    std::unique_ptr<std::ostream> owned_output;
+    std::ostream* output;
+    int process_id;
+    size_type max_buffered_events;
+    cpu_clock::time_point start;
+    std::mutex mutex;
+    std::vector<event> buffer;
+    std::unordered_map<std::string, int64> name_map;
+    std::vector<std::string> names;
+    std::unordered_map<std::thread::id, int64> thread_map;
+    bool first_event{true};
+
+    trace(std::ostream* output, int process_id, size_type max_buffered_events)
+        : output{output},
+          process_id{process_id},
+          max_buffered_events{std::max<size_type>(max_buffered_events, 1)},
+          start{cpu_clock::now()}
+    {
+        buffer.reserve(this->max_buffered_events);
+        *output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    }
+
+    ~trace()
+    {
+        flush();
+        // name the thread tracks
+        for (const auto& pair : thread_map) {
+            write_separator();
+            *output << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":"
+                    << process_id << ",\"tid\":" << pair.second
+                    << ",\"args\":{\"name\":\"thread " << pair.second
+                    << "\"}}";
+        }
+        *output << "]}\n";
+        output->flush();
+    }
+
+    void record(const char* name, profile_event_category category, bool begin)
+    {
+        const auto now = cpu_clock::now();
+        std::lock_guard<std::mutex> guard{mutex};
+        auto name_it = name_map.find(name);
+        if (name_it == name_map.end()) {
+            name_it = name_map.emplace_hint(
+                name_it, name, static_cast<int64>(names.size()));
+            names.push_back(name);
+        }
+        const auto thread_id = std::this_thread::get_id();
+        auto thread_it = thread_map.find(thread_id);
+        if (thread_it == thread_map.end()) {
+            thread_it = thread_map.emplace_hint(
+                thread_it, thread_id, static_cast<int64>(thread_map.size()));
+        }
+        buffer.push_back(
+            event{name_it->second, thread_it->second,
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      now - start),
+                  category, begin});
+        if (buffer.size() >= max_buffered_events) {
+            flush();
+        }
+    }
+
+    void write_separator()
+    {
+        if (!first_event) {
+            *output << ",\n";
+        }
+        first_event = false;
+    }
+
+    void flush()
+    {
+        for (const auto& event : buffer) {
+            const auto time_ns = event.time.count();
+            // Chrome traces use microseconds as their time unit
+            char timestamp[32];
+            std::snprintf(timestamp, sizeof(timestamp), "%lld.%03lld",
+                          static_cast<long long>(time_ns / 1000),
+                          static_cast<long long>(time_ns % 1000));
+            write_separator();
+            *output << "{\"ph\":\"" << (event.begin ? 'B' : 'E')
+                    << "\",\"name\":";
+            write_json_string(*output, names[event.name_id]);
+            *output << ",\"cat\":\"" << category_name(event.category)
+                    << "\",\"pid\":" << process_id
+                    << ",\"tid\":" << event.thread_id
+                    << ",\"ts\":" << timestamp << '}';
+        }
+        buffer.clear();
+    }
+};
+
+
+}  // namespace
+
+
+std::shared_ptr<ProfilerHook> ProfilerHook::create_trace(
+    std::ostream& output, int process_id, size_type max_buffered_events)
+{
+    auto data =
+        std::make_shared<trace>(&output, process_id, max_buffered_events);
+    return std::shared_ptr<ProfilerHook>{new ProfilerHook{
+        [data](const char* name, profile_event_category category) {
+            data->record(name, category, true);
+        },
+        [data](const char* name, profile_event_category category) {
+            data->record(name, category, false);
+        }}};
+}
+
+
+std::shared_ptr<ProfilerHook> ProfilerHook::create_trace(
+    const std::string& filename, int process_id, size_type max_buffered_events)
+{
+    auto output = std::make_unique<std::ofstream>(filename);
+    if (!*output) {
+        throw GKO_STREAM_ERROR("error when opening " + filename);
+    }
+    auto data =
+        std::make_shared<trace>(output.get(), process_id, max_buffered_events);
+    data->owned_output = std::move(output);
+    return std::shared_ptr<ProfilerHook>{new ProfilerHook{
+        [data](const char* name, profile_event_category category) {
+            data->record(name, category, true);
+        },
+        [data](const char* name, profile_event_category category) {
+            data->record(name, category, false);
+        }}};
+}
+
+
+}  // namespace log
+}  // namespace gko
@@ -95,6 +95,17 @@ void Record::on_operation_completed(const Executor* exec,
 }
 
 
+void Record::on_operation_work_reported(const Executor* exec,
+                                        const Operation* operation,
+                                        const size_type& flops,
+                                        const size_type& bytes) const
+{
+    append_deque(data_.operation_work_reported,
+                 (std::unique_ptr<operation_work_data>(
+                     new operation_work_data{exec, operation, flops, bytes})));
+}
+
+
 void Record::on_polymorphic_object_create_started(
     const Executor* exec, const PolymorphicObject* po) const
 {
@@ -298,5 +309,41 @@ void Record::on_iteration_complete(
 }
 
 
+void Record::on_multigrid_level_generated(const LinOp* level,
+                                          const LinOp* coarse,
+                                          const int& num_active_ranks,
+                                          const size_type& send_volume,
+                                          const size_type& recv_volume) const
+{
+    append_deque(data_.multigrid_level_generated,
+                 (std::unique_ptr<multigrid_level_data>(
+                     new multigrid_level_data{level, coarse, num_active_ranks,
+                                              send_volume, recv_volume})));
+}
+
+
+void Record::on_krylov_storage_precision_selected(
+    const LinOp* solver, const size_type& num_iterations,
+    const solver::cb_gmres::storage_precision& precision) const
+{
+    append_deque(data_.krylov_storage_precision_selected,
+                 (std::unique_ptr<krylov_storage_precision_data>(
+                     new krylov_storage_precision_data{solver, num_iterations,
+                                                       precision})));
+}
+
+
+void Record::on_cached_allocation_completed(const Allocator* allocator,
+                                            const size_type& num_bytes,
+                                            const uintptr& location,
+                                            const bool& cache_hit) const
+{
+    append_deque(data_.cached_allocation_completed,
+                 (std::unique_ptr<cached_allocation_data>(
+                     new cached_allocation_data{allocator, num_bytes, location,
+                                                cache_hit})));
+}
+
+
 }  // namespace log
 }  // namespace gko
@@ -10,8 +10,10 @@
 
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/memory.hpp>
 #include <ginkgo/core/base/name_demangling.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/cb_gmres.hpp>
 #include <ginkgo/core/stop/criterion.hpp>
 #include <ginkgo/core/stop/stopping_status.hpp>
 
@@ -66,6 +68,29 @@ std::string location_name(const uintptr& location)
 }
 
 
+std::string storage_precision_name(
+    const solver::cb_gmres::storage_precision& precision)
+{
+    using solver::cb_gmres::storage_precision;
+    switch (precision) {
+    case storage_precision::keep:
+        return "keep";
+    case storage_precision::reduce1:
+        return "reduce1";
+    case storage_precision::reduce2:
+        return "reduce2";
+    case storage_precision::integer:
+        return "integer";
+    case storage_precision::ireduce1:
+        return "ireduce1";
+    case storage_precision::ireduce2:
+        return "ireduce2";
+    default:
+        return "adaptive";
+    }
+}
+
+
 #define GKO_ENABLE_DEMANGLE_NAME(_object_type)                               \
     std::string demangle_name(const _object_type* object)                    \
     {                                                                        \
@@ -88,6 +113,7 @@ GKO_ENABLE_DEMANGLE_NAME(LinOp);
 GKO_ENABLE_DEMANGLE_NAME(LinOpFactory);
 GKO_ENABLE_DEMANGLE_NAME(stop::Criterion);
 GKO_ENABLE_DEMANGLE_NAME(Executor);
+GKO_ENABLE_DEMANGLE_NAME(Allocator);
 GKO_ENABLE_DEMANGLE_NAME(Operation);
 
 
@@ -178,6 +204,19 @@ void Stream<ValueType>::on_operation_completed(const Executor* exec,
 }
 
 
+template <typename ValueType>
+void Stream<ValueType>::on_operation_work_reported(const Executor* exec,
+                                                   const Operation* operation,
+                                                   const size_type& flops,
+                                                   const size_type& bytes) const
+{
+    *os_ << prefix_ << demangle_name(operation) << " on "
+         << demangle_name(exec) << " performs " << flops
+         << " floating point operations and moves " << bytes_name(bytes)
+         << std::endl;
+}
+
+
 template <typename ValueType>
 void Stream<ValueType>::on_polymorphic_object_create_started(
     const Executor* exec, const PolymorphicObject* po) const
@@ -483,6 +522,43 @@ void Stream<ValueType>::on_iteration_complete(
 }
 
 
+template <typename ValueType>
+void Stream<ValueType>::on_multigrid_level_generated(
+    const LinOp* level, const LinOp* coarse, const int& num_active_ranks,
+    const size_type& send_volume, const size_type& recv_volume) const
+{
+    *os_ << prefix_ << "multigrid level " << demangle_name(level)
+         << " generated " << demangle_name(coarse) << " of size "
+         << coarse->get_size() << " on " << num_active_ranks
+         << " ranks, sending " << send_volume << " and receiving "
+         << recv_volume << " entries per application" << std::endl;
+}
+
+
+template <typename ValueType>
+void Stream<ValueType>::on_krylov_storage_precision_selected(
+    const LinOp* solver, const size_type& num_iterations,
+    const solver::cb_gmres::storage_precision& precision) const
+{
+    *os_ << prefix_ << demangle_name(solver)
+         << " stores the Krylov basis in precision "
+         << storage_precision_name(precision) << " after " << num_iterations
+         << " iterations" << std::endl;
+}
+
+
+template <typename ValueType>
+void Stream<ValueType>::on_cached_allocation_completed(
+    const Allocator* allocator, const size_type& num_bytes,
+    const uintptr& location, const bool& cache_hit) const
+{
+    *os_ << prefix_ << "cached allocation completed on "
+         << demangle_name(allocator) << " at " << location_name(location)
+         << " with " << bytes_name(num_bytes)
+         << (cache_hit ? " (cache hit)" : " (cache miss)") << std::endl;
+}
+
+
 #define GKO_DECLARE_STREAM(_type) class Stream<_type>
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STREAM);
 
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_LOG_WORK_ESTIMATE_HPP_
+#define GKO_CORE_LOG_WORK_ESTIMATE_HPP_
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * The nominal amount of work of an operation, as reported to the loggers via
+ * Executor::run(const Operation&, size_type, size_type).
+ */
+struct work_estimate {
+    /** The number of floating point operations. */
+    size_type flops;
+    /** The number of bytes read from and written to memory. */
+    size_type bytes;
+};
+
+
+/**
+ * Returns the work of an operator application x = A * b, or
+ * x = alpha * A * b + beta * x if advanced is set, for an operator storing
+ * num_stored_elements values without any index information, e.g. the blocks
+ * of a block-diagonal matrix. Each stored value is read once, as are b and x.
+ */
+template <typename MatrixValueType, typename InValueType,
+          typename OutValueType>
+work_estimate stored_apply_work(size_type num_rows, size_type num_cols,
+                                size_type num_stored_elements,
+                                size_type num_rhs, bool advanced = false)
+{
+    const auto vector_bytes =
+        num_cols * num_rhs * sizeof(InValueType) +
+        (advanced ? 2 : 1) * num_rows * num_rhs * sizeof(OutValueType);
+    return {2 * num_stored_elements * num_rhs +
+                (advanced ? 3 * num_rows * num_rhs : 0),
+            num_stored_elements * sizeof(MatrixValueType) + vector_bytes};
+}
+
+
+/**
+ * Returns the work of a sparse matrix-vector product x = A * b, or
+ * x = alpha * A * b + beta * x if advanced is set, for a matrix stored in a
+ * compressed row format. This additionally accounts for reading the column
+ * index of each stored entry and the row pointers.
+ *
+ * This also describes a sparse triangular solve with the same matrix.
+ */
+template <typename MatrixValueType, typename IndexType, typename InValueType,
+          typename OutValueType>
+work_estimate sparse_apply_work(size_type num_rows, size_type num_cols,
+                                size_type num_stored_elements,
+                                size_type num_rhs, bool advanced = false)
+{
+    auto work =
+        stored_apply_work<MatrixValueType, InValueType, OutValueType>(
+            num_rows, num_cols, num_stored_elements, num_rhs, advanced);
+    work.bytes += num_stored_elements * sizeof(IndexType) +
+                  (num_rows + 1) * sizeof(IndexType);
+    return work;
+}
+
+
+/**
+ * Returns the work of an element-wise vector operation on num_elements
+ * entries, which reads num_reads and writes num_writes values and performs
+ * flops_per_element floating point operations per entry.
+ */
+template <typename ValueType>
+work_estimate vector_work(size_type num_elements, size_type num_reads,
+                          size_type num_writes, size_type flops_per_element)
+{
+    return {flops_per_element * num_elements,
+            (num_reads + num_writes) * num_elements * sizeof(ValueType)};
+}
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_CORE_LOG_WORK_ESTIMATE_HPP_
@@ -0,0 +1,342 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/compressed_csr.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/array_access.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/log/work_estimate.hpp"
+#include "core/matrix/compressed_csr_kernels.hpp"
+#include "core/matrix/compressed_csr_utils.hpp"
+#include "core/preconditioner/jacobi_utils.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace compressed_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, compressed_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, compressed_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(compress, compressed_csr::compress);
+GKO_REGISTER_OPERATION(decompress, compressed_csr::decompress);
+GKO_REGISTER_OPERATION(count_index_outliers,
+                       compressed_csr::count_index_outliers);
+GKO_REGISTER_OPERATION(prefix_sum_nonnegative,
+                       components::prefix_sum_nonnegative);
+
+
+}  // anonymous namespace
+}  // namespace compressed_csr
+
+
+namespace {
+
+
+template <typename ValueType>
+size_type get_storage_size(precision_reduction storage_precision)
+{
+    if (storage_precision == precision_reduction::autodetect()) {
+        GKO_INVALID_STATE(
+            "CompressedCsr needs an explicit storage precision, autodetect is "
+            "not supported");
+    }
+    size_type size{};
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, storage_precision, size = sizeof(resolved_precision));
+    return size;
+}
+
+
+template <typename ValueType, typename IndexType>
+log::work_estimate get_spmv_work(
+    const CompressedCsr<ValueType, IndexType>* mtx, size_type num_rhs,
+    bool advanced)
+{
+    const auto num_rows = mtx->get_size()[0];
+    const auto nnz = mtx->get_num_stored_elements();
+    auto work =
+        log::sparse_apply_work<ValueType, IndexType, ValueType, ValueType>(
+            num_rows, mtx->get_size()[1], nnz, num_rhs, advanced);
+    // the values are read in their storage precision
+    work.bytes -= nnz * (sizeof(ValueType) - mtx->get_value_size());
+    const auto delta_size =
+        compressed_csr::get_delta_size(mtx->get_index_compression());
+    if (delta_size > 0) {
+        // the column indexes are read as differences and outliers
+        work.bytes -= nnz * (sizeof(IndexType) - delta_size);
+        work.bytes += (mtx->get_num_outliers() + num_rows + 1) *
+                      sizeof(IndexType);
+    }
+    if (mtx->is_row_scaled()) {
+        work.flops += num_rows * num_rhs;
+        work.bytes += num_rows * sizeof(remove_complex<ValueType>);
+    }
+    return work;
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                     LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            const auto work =
+                get_spmv_work(this, dense_b->get_size()[1], false);
+            this->get_executor()->run(
+                compressed_csr::make_spmv(this, dense_b, dense_x), work.flops,
+                work.bytes);
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                     const LinOp* b,
+                                                     const LinOp* beta,
+                                                     LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            const auto work =
+                get_spmv_work(this, dense_b->get_size()[1], true);
+            this->get_executor()->run(
+                compressed_csr::make_advanced_spmv(dense_alpha, this, dense_b,
+                                                   dense_beta, dense_x),
+                work.flops, work.bytes);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+CompressedCsr<ValueType, IndexType>&
+CompressedCsr<ValueType, IndexType>::operator=(const CompressedCsr& other)
+{
+    if (&other != this) {
+        EnableLinOp<CompressedCsr>::operator=(other);
+        storage_precision_ = other.storage_precision_;
+        value_size_ = other.value_size_;
+        row_scaling_ = other.row_scaling_;
+        index_compression_ = other.index_compression_;
+        values_ = other.values_;
+        row_scales_ = other.row_scales_;
+        col_idxs_ = other.col_idxs_;
+        col_deltas_ = other.col_deltas_;
+        outlier_cols_ = other.outlier_cols_;
+        outlier_ptrs_ = other.outlier_ptrs_;
+        row_ptrs_ = other.row_ptrs_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+CompressedCsr<ValueType, IndexType>&
+CompressedCsr<ValueType, IndexType>::operator=(CompressedCsr&& other)
+{
+    if (&other != this) {
+        EnableLinOp<CompressedCsr>::operator=(std::move(other));
+        storage_precision_ = other.storage_precision_;
+        value_size_ = other.value_size_;
+        row_scaling_ = other.row_scaling_;
+        index_compression_ = other.index_compression_;
+        values_ = std::move(other.values_);
+        row_scales_ = std::move(other.row_scales_);
+        col_idxs_ = std::move(other.col_idxs_);
+        col_deltas_ = std::move(other.col_deltas_);
+        outlier_cols_ = std::move(other.outlier_cols_);
+        outlier_ptrs_ = std::move(other.outlier_ptrs_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+CompressedCsr<ValueType, IndexType>::CompressedCsr(const CompressedCsr& other)
+    : CompressedCsr{other.get_executor(), other.storage_precision_,
+                    other.row_scaling_, other.index_compression_}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+CompressedCsr<ValueType, IndexType>::CompressedCsr(CompressedCsr&& other)
+    : CompressedCsr{other.get_executor(), other.storage_precision_,
+                    other.row_scaling_, other.index_compression_}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+CompressedCsr<ValueType, IndexType>::CompressedCsr(
+    std::shared_ptr<const Executor> exec, precision_reduction storage_precision,
+    bool row_scaling, compressed_csr::index_compression index_compression)
+    : EnableLinOp<CompressedCsr>(exec),
+      storage_precision_{storage_precision},
+      value_size_{get_storage_size<ValueType>(storage_precision)},
+      row_scaling_{row_scaling},
+      index_compression_{index_compression},
+      values_{exec},
+      row_scales_{exec},
+      col_idxs_{exec},
+      col_deltas_{exec},
+      outlier_cols_{exec},
+      outlier_ptrs_{exec},
+      row_ptrs_{exec, 1}
+{
+    row_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<CompressedCsr<ValueType, IndexType>>
+CompressedCsr<ValueType, IndexType>::create(
+    std::shared_ptr<const Executor> exec, precision_reduction storage_precision,
+    bool row_scaling, compressed_csr::index_compression index_compression)
+{
+    return std::unique_ptr<CompressedCsr>{new CompressedCsr{
+        exec, storage_precision, row_scaling, index_compression}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<CompressedCsr<ValueType, IndexType>>
+CompressedCsr<ValueType, IndexType>::create(
+    std::shared_ptr<const Executor> exec, const csr_type* source,
+    precision_reduction storage_precision, bool row_scaling,
+    compressed_csr::index_compression index_compression)
+{
+    auto result =
+        create(exec, storage_precision, row_scaling, index_compression);
+    result->compress(source);
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::compress(const csr_type* source)
+{
+    auto exec = this->get_executor();
+    auto local_source = make_temporary_clone(exec, source);
+    const auto num_rows = local_source->get_size()[0];
+    const auto nnz = local_source->get_num_stored_elements();
+    this->set_size(local_source->get_size());
+    row_ptrs_.resize_and_reset(num_rows + 1);
+    values_.resize_and_reset(nnz * value_size_);
+    row_scales_.resize_and_reset(row_scaling_ ? num_rows : 0);
+    exec->copy(num_rows + 1, local_source->get_const_row_ptrs(),
+               row_ptrs_.get_data());
+    if (index_compression_ == compressed_csr::index_compression::none) {
+        col_idxs_.resize_and_reset(nnz);
+        col_deltas_.resize_and_reset(0);
+        outlier_cols_.resize_and_reset(0);
+        outlier_ptrs_.resize_and_reset(0);
+        exec->copy(nnz, local_source->get_const_col_idxs(),
+                   col_idxs_.get_data());
+    } else {
+        col_idxs_.resize_and_reset(0);
+        col_deltas_.resize_and_reset(
+            nnz * compressed_csr::get_delta_size(index_compression_));
+        outlier_ptrs_.resize_and_reset(num_rows + 1);
+        exec->run(compressed_csr::make_count_index_outliers(
+            local_source.get(), this));
+        exec->run(compressed_csr::make_prefix_sum_nonnegative(
+            outlier_ptrs_.get_data(), num_rows + 1));
+        outlier_cols_.resize_and_reset(get_element(outlier_ptrs_, num_rows));
+    }
+    exec->run(compressed_csr::make_compress(local_source.get(), this));
+}
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto nnz = this->get_num_stored_elements();
+    auto tmp = csr_type::create(exec, this->get_size(),
+                                array<ValueType>{exec, nnz},
+                                array<IndexType>{exec, nnz},
+                                array<IndexType>{exec, row_ptrs_},
+                                result->get_strategy());
+    exec->run(compressed_csr::make_decompress(this, tmp.get()));
+    tmp->move_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::move_to(
+    Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    auto tmp = csr_type::create(this->get_executor());
+    tmp->read(data);
+    this->compress(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    auto tmp = csr_type::create(this->get_executor());
+    tmp->read(data);
+    this->compress(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    auto tmp = csr_type::create(this->get_executor());
+    tmp->read(std::move(data));
+    this->compress(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void CompressedCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto tmp = csr_type::create(this->get_executor());
+    this->convert_to(tmp.get());
+    tmp->write(data);
+}
+
+
+#define GKO_DECLARE_COMPRESSED_CSR_MATRIX(ValueType, IndexType) \
+    class CompressedCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_COMPRESSED_CSR_KERNELS_HPP_
+#define GKO_CORE_MATRIX_COMPRESSED_CSR_KERNELS_HPP_
+
+
+#include <ginkgo/core/matrix/compressed_csr.hpp>
+
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_COMPRESSED_CSR_SPMV_KERNEL(ValueType, IndexType) \
+    void spmv(std::shared_ptr<const DefaultExecutor> exec,           \
+              const matrix::CompressedCsr<ValueType, IndexType>* a,  \
+              const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+
+#define GKO_DECLARE_COMPRESSED_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType) \
+    void advanced_spmv(std::shared_ptr<const DefaultExecutor> exec,           \
+                       const matrix::Dense<ValueType>* alpha,                 \
+                       const matrix::CompressedCsr<ValueType, IndexType>* a,  \
+                       const matrix::Dense<ValueType>* b,                     \
+                       const matrix::Dense<ValueType>* beta,                  \
+                       matrix::Dense<ValueType>* c)
+
+#define GKO_DECLARE_COMPRESSED_CSR_COMPRESS_KERNEL(ValueType, IndexType) \
+    void compress(std::shared_ptr<const DefaultExecutor> exec,           \
+                  const matrix::Csr<ValueType, IndexType>* source,       \
+                  matrix::CompressedCsr<ValueType, IndexType>* result)
+
+#define GKO_DECLARE_COMPRESSED_CSR_DECOMPRESS_KERNEL(ValueType, IndexType)     \
+    void decompress(std::shared_ptr<const DefaultExecutor> exec,               \
+                    const matrix::CompressedCsr<ValueType, IndexType>* source, \
+                    matrix::Csr<ValueType, IndexType>* result)
+
+#define GKO_DECLARE_COMPRESSED_CSR_COUNT_INDEX_OUTLIERS_KERNEL(ValueType, \
+                                                              IndexType)  \
+    void count_index_outliers(                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                      \
+        const matrix::Csr<ValueType, IndexType>* source,                  \
+        matrix::CompressedCsr<ValueType, IndexType>* result)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                       \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_COMPRESSED_CSR_SPMV_KERNEL(ValueType, IndexType);          \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_COMPRESSED_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_COMPRESSED_CSR_COMPRESS_KERNEL(ValueType, IndexType);      \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_COMPRESSED_CSR_DECOMPRESS_KERNEL(ValueType, IndexType);    \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_COMPRESSED_CSR_COUNT_INDEX_OUTLIERS_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(compressed_csr,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_COMPRESSED_CSR_KERNELS_HPP_
@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_COMPRESSED_CSR_UTILS_HPP_
+#define GKO_CORE_MATRIX_COMPRESSED_CSR_UTILS_HPP_
+
+
+#include <limits>
+
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/compressed_csr.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace compressed_csr {
+
+
+/**
+ * Returns the size in bytes of a single compressed column index, or 0 if the
+ * column indexes are not compressed.
+ */
+inline size_type get_delta_size(index_compression compression)
+{
+    switch (compression) {
+    case index_compression::delta8:
+        return sizeof(int8);
+    case index_compression::delta16:
+        return sizeof(int16);
+    default:
+        return 0;
+    }
+}
+
+
+/**
+ * Returns the value marking a difference that is stored in the outlier array.
+ */
+template <typename DeltaType>
+constexpr DeltaType escape_delta()
+{
+    return std::numeric_limits<DeltaType>::min();
+}
+
+
+/**
+ * Returns true if the difference between two column indexes can be stored
+ * as a DeltaType.
+ */
+template <typename DeltaType, typename IndexType>
+bool is_representable_delta(IndexType delta)
+{
+    return delta > static_cast<IndexType>(escape_delta<DeltaType>()) &&
+           delta <= static_cast<IndexType>(
+                        std::numeric_limits<DeltaType>::max());
+}
+
+
+/**
+ * Reads the uncompressed column indexes of a row.
+ */
+template <typename IndexType>
+struct plain_row_cols {
+    IndexType operator()(IndexType nz) const { return col_idxs[nz]; }
+
+    const IndexType* col_idxs;
+};
+
+
+/**
+ * Decodes the delta-compressed column indexes of a row. The entries of the
+ * row need to be read in order.
+ */
+template <typename DeltaType, typename IndexType>
+struct delta_row_cols {
+    IndexType operator()(IndexType nz)
+    {
+        const auto delta = deltas[nz];
+        col = delta == escape_delta<DeltaType>() ? *outliers++ : col + delta;
+        return col;
+    }
+
+    const DeltaType* deltas;
+    const IndexType* outliers;
+    IndexType col;
+};
+
+
+/**
+ * Calls fn with a function that returns a reader for the column indexes of a
+ * given row, using the column index storage of the matrix.
+ */
+template <typename ValueType, typename IndexType, typename Function>
+void run_with_col_reader(const CompressedCsr<ValueType, IndexType>* mtx,
+                         Function fn)
+{
+    const auto outlier_ptrs = mtx->get_const_outlier_ptrs();
+    const auto outliers = mtx->get_const_outlier_cols();
+    switch (mtx->get_index_compression()) {
+    case index_compression::delta8: {
+        const auto deltas =
+            reinterpret_cast<const int8*>(mtx->get_const_col_deltas());
+        fn([=](size_type row) {
+            return delta_row_cols<int8, IndexType>{
+                deltas, outliers + outlier_ptrs[row],
+                static_cast<IndexType>(row)};
+        });
+        break;
+    }
+    case index_compression::delta16: {
+        const auto deltas =
+            reinterpret_cast<const int16*>(mtx->get_const_col_deltas());
+        fn([=](size_type row) {
+            return delta_row_cols<int16, IndexType>{
+                deltas, outliers + outlier_ptrs[row],
+                static_cast<IndexType>(row)};
+        });
+        break;
+    }
+    default: {
+        const auto col_idxs = mtx->get_const_col_idxs();
+        fn([=](size_type) { return plain_row_cols<IndexType>{col_idxs}; });
+    }
+    }
+}
+
+
+/**
+ * Calls fn with a value of the type storing the compressed column indexes.
+ * Does nothing if the column indexes are not compressed.
+ */
+template <typename Function>
+void run_with_delta_type(index_compression compression, Function fn)
+{
+    switch (compression) {
+    case index_compression::delta8:
+        fn(int8{});
+        break;
+    case index_compression::delta16:
+        fn(int16{});
+        break;
+    default:
+        break;
+    }
+}
+
+
+/**
+ * Returns the number of column indexes of a row that are not representable
+ * as DeltaType differences.
+ */
+template <typename DeltaType, typename IndexType>
+IndexType count_row_outliers(size_type row, const IndexType* row_ptrs,
+                             const IndexType* col_idxs)
+{
+    IndexType count{};
+    auto prev_col = static_cast<IndexType>(row);
+    for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+        if (!is_representable_delta<DeltaType>(col_idxs[nz] - prev_col)) {
+            count++;
+        }
+        prev_col = col_idxs[nz];
+    }
+    return count;
+}
+
+
+/**
+ * Stores the column indexes of a row as DeltaType differences, writing the
+ * non-representable column indexes to outliers.
+ */
+template <typename DeltaType, typename IndexType>
+void compress_row_cols(size_type row, const IndexType* row_ptrs,
+                       const IndexType* col_idxs, DeltaType* deltas,
+                       IndexType* outliers)
+{
+    auto prev_col = static_cast<IndexType>(row);
+    for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+        const auto delta = col_idxs[nz] - prev_col;
+        if (is_representable_delta<DeltaType>(delta)) {
+            deltas[nz] = static_cast<DeltaType>(delta);
+        } else {
+            deltas[nz] = escape_delta<DeltaType>();
+            *outliers++ = col_idxs[nz];
+        }
+        prev_col = col_idxs[nz];
+    }
+}
+
+
+}  // namespace compressed_csr
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_COMPRESSED_CSR_UTILS_HPP_
@@ -29,6 +29,7 @@
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "core/log/work_estimate.hpp"
 #include "core/matrix/csr_kernels.hpp"
 #include "core/matrix/ell_kernels.hpp"
 #include "core/matrix/hybrid_kernels.hpp"
@@ -259,8 +260,15 @@ void Csr<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
     } else {
         mixed_precision_dispatch_real_complex<ValueType>(
             [this](auto dense_b, auto dense_x) {
+                const auto work = log::sparse_apply_work<
+                    ValueType, IndexType,
+                    typename std::decay_t<decltype(*dense_b)>::value_type,
+                    typename std::decay_t<decltype(*dense_x)>::value_type>(
+                    this->get_size()[0], this->get_size()[1],
+                    this->get_num_stored_elements(), dense_b->get_size()[1]);
                 this->get_executor()->run(
-                    csr::make_spmv(this, dense_b, dense_x));
+                    csr::make_spmv(this, dense_b, dense_x), work.flops,
+                    work.bytes);
             },
             b, x);
     }
@@ -295,9 +303,17 @@ void Csr<ValueType, IndexType>::apply_impl(const LinOp* alpha, const LinOp* b,
                 auto dense_beta = make_temporary_conversion<
                     typename std::decay_t<decltype(*dense_x)>::value_type>(
                     beta);
+                const auto work = log::sparse_apply_work<
+                    ValueType, IndexType,
+                    typename std::decay_t<decltype(*dense_b)>::value_type,
+                    typename std::decay_t<decltype(*dense_x)>::value_type>(
+                    this->get_size()[0], this->get_size()[1],
+                    this->get_num_stored_elements(), dense_b->get_size()[1],
+                    true);
                 this->get_executor()->run(
                     csr::make_advanced_spmv(dense_alpha.get(), this, dense_b,
-                                            dense_beta.get(), dense_x));
+                                            dense_beta.get(), dense_x),
+                    work.flops, work.bytes);
             },
             b, x);
     }
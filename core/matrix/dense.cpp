@@ -32,6 +32,7 @@
 #include "core/base/array_access.hpp"
 #include "core/base/dispatch_helper.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "core/log/work_estimate.hpp"
 #include "core/matrix/dense_kernels.hpp"
 #include "core/matrix/hybrid_kernels.hpp"
 #include "core/matrix/permutation.hpp"
@@ -286,14 +287,19 @@ void Dense<ValueType>::add_scaled_impl(const LinOp* alpha, const LinOp* b)
     }
     GKO_ASSERT_EQUAL_DIMENSIONS(this, b);
     auto exec = this->get_executor();
+    const auto work = log::vector_work<ValueType>(
+        this->get_size()[0] * this->get_size()[1], 2, 1, 2);
 
     // if alpha is real and value type complex
     if (dynamic_cast<const ConvertibleTo<Dense<>>*>(alpha) &&
         is_complex<ValueType>()) {
-        exec->run(dense::make_add_scaled(
-            make_temporary_conversion<remove_complex<ValueType>>(alpha).get(),
-            make_temporary_conversion<to_complex<ValueType>>(b).get(),
-            dynamic_cast<complex_type*>(this)));
+        exec->run(
+            dense::make_add_scaled(
+                make_temporary_conversion<remove_complex<ValueType>>(alpha)
+                    .get(),
+                make_temporary_conversion<to_complex<ValueType>>(b).get(),
+                dynamic_cast<complex_type*>(this)),
+            work.flops, work.bytes);
     } else {
         if (dynamic_cast<const Diagonal<ValueType>*>(b)) {
             exec->run(dense::make_add_scaled_diag(
@@ -301,8 +307,9 @@ void Dense<ValueType>::add_scaled_impl(const LinOp* alpha, const LinOp* b)
                 dynamic_cast<const Diagonal<ValueType>*>(b), this));
         } else {
             exec->run(dense::make_add_scaled(
-                make_temporary_conversion<ValueType>(alpha).get(),
-                make_temporary_conversion<ValueType>(b).get(), this));
+                          make_temporary_conversion<ValueType>(alpha).get(),
+                          make_temporary_conversion<ValueType>(b).get(), this),
+                      work.flops, work.bytes);
         }
     }
 }
@@ -355,8 +362,11 @@ void Dense<ValueType>::compute_dot(ptr_param<const LinOp> b,
     auto local_res = make_temporary_clone(exec, result);
     auto dense_b = make_temporary_conversion<ValueType>(local_b.get());
     auto dense_res = make_temporary_conversion<ValueType>(local_res.get());
+    const auto work = log::vector_work<ValueType>(
+        this->get_size()[0] * this->get_size()[1], 2, 0, 2);
     exec->run(
-        dense::make_compute_dot(this, dense_b.get(), dense_res.get(), tmp));
+        dense::make_compute_dot(this, dense_b.get(), dense_res.get(), tmp),
+        work.flops, work.bytes);
 }
 
 
@@ -369,8 +379,11 @@ void Dense<ValueType>::compute_dot_impl(const LinOp* b, LinOp* result) const
     auto dense_b = make_temporary_conversion<ValueType>(b);
     auto dense_res = make_temporary_conversion<ValueType>(result);
     array<char> tmp{exec};
+    const auto work = log::vector_work<ValueType>(
+        this->get_size()[0] * this->get_size()[1], 2, 0, 2);
     exec->run(
-        dense::make_compute_dot(this, dense_b.get(), dense_res.get(), tmp));
+        dense::make_compute_dot(this, dense_b.get(), dense_res.get(), tmp),
+        work.flops, work.bytes);
 }
 
 
@@ -390,8 +403,11 @@ void Dense<ValueType>::compute_conj_dot(ptr_param<const LinOp> b,
     auto local_res = make_temporary_clone(exec, result);
     auto dense_b = make_temporary_conversion<ValueType>(local_b.get());
     auto dense_res = make_temporary_conversion<ValueType>(local_res.get());
+    const auto work = log::vector_work<ValueType>(
+        this->get_size()[0] * this->get_size()[1], 2, 0, 2);
     exec->run(dense::make_compute_conj_dot(this, dense_b.get(), dense_res.get(),
-                                           tmp));
+                                           tmp),
+              work.flops, work.bytes);
 }
 
 
@@ -405,8 +421,11 @@ void Dense<ValueType>::compute_conj_dot_impl(const LinOp* b,
     auto dense_b = make_temporary_conversion<ValueType>(b);
     auto dense_res = make_temporary_conversion<ValueType>(result);
     array<char> tmp{exec};
+    const auto work = log::vector_work<ValueType>(
+        this->get_size()[0] * this->get_size()[1], 2, 0, 2);
     exec->run(dense::make_compute_conj_dot(this, dense_b.get(), dense_res.get(),
-                                           tmp));
+                                           tmp),
+              work.flops, work.bytes);
 }
 
 
@@ -423,7 +442,10 @@ void Dense<ValueType>::compute_norm2(ptr_param<LinOp> result,
     auto local_result = make_temporary_clone(exec, result);
     auto dense_res = make_temporary_conversion<remove_complex<ValueType>>(
         local_result.get());
-    exec->run(dense::make_compute_norm2(this, dense_res.get(), tmp));
+    const auto work = log::vector_work<ValueType>(
+        this->get_size()[0] * this->get_size()[1], 1, 0, 2);
+    exec->run(dense::make_compute_norm2(this, dense_res.get(), tmp),
+              work.flops, work.bytes);
 }
 
 
@@ -435,7 +457,10 @@ void Dense<ValueType>::compute_norm2_impl(LinOp* result) const
     auto dense_res =
         make_temporary_conversion<remove_complex<ValueType>>(result);
     array<char> tmp{exec};
-    exec->run(dense::make_compute_norm2(this, dense_res.get(), tmp));
+    const auto work = log::vector_work<ValueType>(
+        this->get_size()[0] * this->get_size()[1], 1, 0, 2);
+    exec->run(dense::make_compute_norm2(this, dense_res.get(), tmp),
+              work.flops, work.bytes);
 }
 
 
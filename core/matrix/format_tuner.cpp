@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/format_tuner.hpp>
+
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/timer.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+#include <ginkgo/core/matrix/hybrid.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace {
+
+
+template <typename ValueType, typename IndexType>
+array<IndexType> get_host_row_ptrs(const Csr<ValueType, IndexType>* mtx)
+{
+    const auto exec = mtx->get_executor();
+    const auto size = mtx->get_size()[0] + 1;
+    array<IndexType> result{exec->get_master(), size};
+    exec->get_master()->copy_from(exec, size, mtx->get_const_row_ptrs(),
+                                  result.get_data());
+    return result;
+}
+
+
+template <typename IndexType>
+double get_row_imbalance(const array<IndexType>& row_ptrs)
+{
+    const auto num_rows = row_ptrs.get_size() - 1;
+    const auto ptrs = row_ptrs.get_const_data();
+    if (num_rows == 0 || ptrs[num_rows] == 0) {
+        return 1.0;
+    }
+    IndexType max_length{};
+    for (size_type row = 0; row < num_rows; row++) {
+        max_length = std::max(max_length, ptrs[row + 1] - ptrs[row]);
+    }
+    return max_length / (static_cast<double>(ptrs[num_rows]) / num_rows);
+}
+
+
+template <typename CsrType>
+std::shared_ptr<typename CsrType::strategy_type> create_load_balance(
+    std::shared_ptr<const Executor> exec)
+{
+    using load_balance = typename CsrType::load_balance;
+    if (auto cuda = std::dynamic_pointer_cast<const CudaExecutor>(exec)) {
+        return std::make_shared<load_balance>(cuda);
+    } else if (auto hip = std::dynamic_pointer_cast<const HipExecutor>(exec)) {
+        return std::make_shared<load_balance>(hip);
+    } else if (auto dpcpp =
+                   std::dynamic_pointer_cast<const DpcppExecutor>(exec)) {
+        return std::make_shared<load_balance>(dpcpp);
+    }
+    // on CPUs, load_balance uses the same kernel as classical
+    return nullptr;
+}
+
+
+template <typename MatrixType, typename CsrType>
+std::unique_ptr<LinOp> convert_to_format(std::shared_ptr<const Executor> exec,
+                                         const CsrType* mtx)
+{
+    auto result = MatrixType::create(exec);
+    mtx->convert_to(result);
+    return result;
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+std::vector<std::string>
+FormatTuner<ValueType, IndexType>::get_default_formats()
+{
+    return {"csr_classical", "csr_load_balance", "csr_merge_path",
+            "csr_sparselib", "coo",           "ell",
+            "sellp",         "hybrid"};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::string FormatTuner<ValueType, IndexType>::get_fingerprint(
+    std::shared_ptr<const Executor> exec, const csr_type* mtx)
+{
+    const auto row_ptrs = get_host_row_ptrs(mtx);
+    // 64 bit FNV-1a hash of the row pointers
+    uint64 hash = 14695981039346656037u;
+    for (size_type i = 0; i < row_ptrs.get_size(); i++) {
+        const auto value = static_cast<uint64>(row_ptrs.get_const_data()[i]);
+        for (int byte = 0; byte < 8; byte++) {
+            hash ^= (value >> (8 * byte)) & 0xFF;
+            hash *= 1099511628211u;
+        }
+    }
+    std::stringstream ss;
+    ss << name_demangling::get_dynamic_type(*exec) << ';'
+       << name_demangling::get_type_name(typeid(ValueType)) << ';'
+       << name_demangling::get_type_name(typeid(IndexType)) << ';'
+       << mtx->get_size()[0] << 'x' << mtx->get_size()[1] << ';'
+       << mtx->get_num_stored_elements() << ';' << std::hex
+       << std::setfill('0') << std::setw(16) << hash;
+    return ss.str();
+}
+
+
+template <typename ValueType, typename IndexType>
+FormatTuner<ValueType, IndexType>::FormatTuner(
+    std::shared_ptr<const Executor> exec, std::string cache_file,
+    size_type warmup, size_type repetitions, std::vector<std::string> formats,
+    double ell_imbalance_limit)
+    : exec_{std::move(exec)},
+      cache_file_{std::move(cache_file)},
+      warmup_{warmup},
+      repetitions_{std::max<size_type>(repetitions, 1)},
+      formats_{std::move(formats)},
+      ell_imbalance_limit_{ell_imbalance_limit}
+{
+    const auto supported = get_default_formats();
+    for (const auto& format : formats_) {
+        if (std::find(supported.begin(), supported.end(), format) ==
+            supported.end()) {
+            GKO_INVALID_STATE("unsupported format " + format);
+        }
+    }
+    if (cache_file_.empty()) {
+        return;
+    }
+    std::ifstream stream{cache_file_};
+    if (!stream.is_open()) {
+        // the cache doesn't exist yet
+        return;
+    }
+    std::string line;
+    while (std::getline(stream, line)) {
+        // each line has the form <fingerprint> <format>, later lines
+        // override earlier ones
+        const auto separator = line.find_last_of(' ');
+        if (separator == std::string::npos || separator == 0) {
+            continue;
+        }
+        decisions_[line.substr(0, separator)] = line.substr(separator + 1);
+    }
+    if (stream.bad()) {
+        throw GKO_STREAM_ERROR("error when reading " + cache_file_);
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> FormatTuner<ValueType, IndexType>::convert(
+    const std::string& format, const csr_type* mtx) const
+{
+    if (format == "csr_classical" || format == "csr_load_balance" ||
+        format == "csr_merge_path" || format == "csr_sparselib") {
+        std::shared_ptr<typename csr_type::strategy_type> strategy;
+        if (format == "csr_classical") {
+            strategy = std::make_shared<typename csr_type::classical>();
+        } else if (format == "csr_load_balance") {
+            strategy = create_load_balance<csr_type>(exec_);
+        } else if (format == "csr_merge_path") {
+            strategy = std::make_shared<typename csr_type::merge_path>();
+        } else {
+            strategy = std::make_shared<typename csr_type::sparselib>();
+        }
+        if (!strategy) {
+            return nullptr;
+        }
+        auto result = gko::clone(exec_, mtx);
+        result->set_strategy(strategy);
+        return result;
+    } else if (format == "coo") {
+        return convert_to_format<Coo<ValueType, IndexType>>(exec_, mtx);
+    } else if (format == "ell") {
+        if (get_row_imbalance(get_host_row_ptrs(mtx)) > ell_imbalance_limit_) {
+            return nullptr;
+        }
+        return convert_to_format<Ell<ValueType, IndexType>>(exec_, mtx);
+    } else if (format == "sellp") {
+        return convert_to_format<Sellp<ValueType, IndexType>>(exec_, mtx);
+    } else if (format == "hybrid") {
+        return convert_to_format<Hybrid<ValueType, IndexType>>(exec_, mtx);
+    }
+    GKO_INVALID_STATE("unsupported format " + format);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::string FormatTuner<ValueType, IndexType>::get_cached_format(
+    const std::string& fingerprint) const
+{
+    const auto it = decisions_.find(fingerprint);
+    return it == decisions_.end() ? std::string{} : it->second;
+}
+
+
+template <typename ValueType, typename IndexType>
+typename FormatTuner<ValueType, IndexType>::result
+FormatTuner<ValueType, IndexType>::tune(const csr_type* mtx)
+{
+    const auto fingerprint = get_fingerprint(exec_, mtx);
+    const auto cached_format = get_cached_format(fingerprint);
+    if (!cached_format.empty()) {
+        if (auto converted = convert(cached_format, mtx)) {
+            return {std::move(converted), cached_format, true, {}};
+        }
+    }
+    using Vec = Dense<ValueType>;
+    auto b = Vec::create(exec_, dim<2>{mtx->get_size()[1], 1});
+    auto x = Vec::create(exec_, dim<2>{mtx->get_size()[0], 1});
+    b->fill(one<ValueType>());
+    auto timer = Timer::create_for_executor(exec_);
+    result best{nullptr, {}, false, {}};
+    std::chrono::nanoseconds best_time{};
+    for (const auto& format : formats_) {
+        auto candidate = convert(format, mtx);
+        if (!candidate) {
+            continue;
+        }
+        for (size_type i = 0; i < warmup_; i++) {
+            candidate->apply(b, x);
+        }
+        auto start = timer->create_time_point();
+        auto stop = timer->create_time_point();
+        timer->record(start);
+        for (size_type i = 0; i < repetitions_; i++) {
+            candidate->apply(b, x);
+        }
+        timer->record(stop);
+        const auto time = timer->difference(start, stop) /
+                          static_cast<int64>(repetitions_);
+        best.timings[format] = time;
+        if (!best.matrix || time < best_time) {
+            best.matrix = std::move(candidate);
+            best.format = format;
+            best_time = time;
+        }
+    }
+    if (!best.matrix) {
+        GKO_INVALID_STATE("no candidate format is applicable");
+    }
+    store(fingerprint, best.format);
+    return best;
+}
+
+
+template <typename ValueType, typename IndexType>
+void FormatTuner<ValueType, IndexType>::store(const std::string& fingerprint,
+                                              const std::string& format)
+{
+    decisions_[fingerprint] = format;
+    if (cache_file_.empty()) {
+        return;
+    }
+    std::ofstream stream{cache_file_, std::ios::app};
+    stream << fingerprint << ' ' << format << '\n';
+    if (!stream) {
+        throw GKO_STREAM_ERROR("error when writing " + cache_file_);
+    }
+}
+
+
+#define GKO_DECLARE_FORMAT_TUNER(ValueType, IndexType) \
+    class FormatTuner<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FORMAT_TUNER);
+
+
+}  // namespace matrix
+}  // namespace gko
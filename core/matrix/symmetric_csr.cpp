@@ -0,0 +1,276 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/array_access.hpp"
+#include "core/base/utils.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/log/work_estimate.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace symmetric_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, symmetric_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, symmetric_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(count_upper_nonzeros_per_row,
+                       symmetric_csr::count_upper_nonzeros_per_row);
+GKO_REGISTER_OPERATION(fill_upper, symmetric_csr::fill_upper);
+GKO_REGISTER_OPERATION(count_nonzeros_per_row,
+                       symmetric_csr::count_nonzeros_per_row);
+GKO_REGISTER_OPERATION(fill_in_csr, symmetric_csr::fill_in_csr);
+GKO_REGISTER_OPERATION(prefix_sum_nonnegative,
+                       components::prefix_sum_nonnegative);
+
+
+}  // anonymous namespace
+}  // namespace symmetric_csr
+
+
+namespace {
+
+
+template <typename ValueType, typename IndexType>
+log::work_estimate get_spmv_work(const SymmetricCsr<ValueType, IndexType>* mtx,
+                                 size_type num_rhs, bool advanced)
+{
+    const auto num_rows = mtx->get_size()[0];
+    const auto nnz = mtx->get_num_stored_elements();
+    auto work =
+        log::sparse_apply_work<ValueType, IndexType, ValueType, ValueType>(
+            num_rows, mtx->get_size()[1], nnz, num_rhs, advanced);
+    // every stored off-diagonal entry is also applied as its transpose,
+    // assuming a full diagonal
+    const auto num_off_diagonal = nnz - std::min(nnz, num_rows);
+    work.flops += 2 * num_off_diagonal * num_rhs;
+    return work;
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                    LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            const auto work =
+                get_spmv_work(this, dense_b->get_size()[1], false);
+            this->get_executor()->run(
+                symmetric_csr::make_spmv(this, dense_b, dense_x), work.flops,
+                work.bytes);
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                    const LinOp* b,
+                                                    const LinOp* beta,
+                                                    LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            const auto work = get_spmv_work(this, dense_b->get_size()[1], true);
+            this->get_executor()->run(
+                symmetric_csr::make_advanced_spmv(dense_alpha, this, dense_b,
+                                                  dense_beta, dense_x),
+                work.flops, work.bytes);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>&
+SymmetricCsr<ValueType, IndexType>::operator=(const SymmetricCsr& other)
+{
+    if (&other != this) {
+        EnableLinOp<SymmetricCsr>::operator=(other);
+        values_ = other.values_;
+        col_idxs_ = other.col_idxs_;
+        row_ptrs_ = other.row_ptrs_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>&
+SymmetricCsr<ValueType, IndexType>::operator=(SymmetricCsr&& other)
+{
+    if (&other != this) {
+        EnableLinOp<SymmetricCsr>::operator=(std::move(other));
+        values_ = std::move(other.values_);
+        col_idxs_ = std::move(other.col_idxs_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(const SymmetricCsr& other)
+    : SymmetricCsr{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(SymmetricCsr&& other)
+    : SymmetricCsr{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(
+    std::shared_ptr<const Executor> exec)
+    : EnableLinOp<SymmetricCsr>(exec),
+      values_{exec},
+      col_idxs_{exec},
+      row_ptrs_{exec, 1}
+{
+    row_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<SymmetricCsr<ValueType, IndexType>>
+SymmetricCsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec)
+{
+    return std::unique_ptr<SymmetricCsr>{new SymmetricCsr{exec}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<SymmetricCsr<ValueType, IndexType>>
+SymmetricCsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                           const csr_type* source)
+{
+    auto result = create(exec);
+    result->read_upper(source);
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read_upper(const csr_type* source)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(source);
+    auto exec = this->get_executor();
+    // the SpMV relies on sorted column indexes
+    auto local_source = convert_to_with_sorting<const csr_type>(exec, source,
+                                                                false);
+    const auto num_rows = local_source->get_size()[0];
+    this->set_size(local_source->get_size());
+    row_ptrs_.resize_and_reset(num_rows + 1);
+    exec->run(symmetric_csr::make_count_upper_nonzeros_per_row(
+        local_source.get(), row_ptrs_.get_data()));
+    exec->run(symmetric_csr::make_prefix_sum_nonnegative(row_ptrs_.get_data(),
+                                                         num_rows + 1));
+    const auto nnz = static_cast<size_type>(get_element(row_ptrs_, num_rows));
+    values_.resize_and_reset(nnz);
+    col_idxs_.resize_and_reset(nnz);
+    exec->run(symmetric_csr::make_fill_upper(local_source.get(), this));
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    array<IndexType> row_ptrs{exec, num_rows + 1};
+    exec->run(symmetric_csr::make_count_nonzeros_per_row(this,
+                                                         row_ptrs.get_data()));
+    exec->run(symmetric_csr::make_prefix_sum_nonnegative(row_ptrs.get_data(),
+                                                         num_rows + 1));
+    const auto nnz = static_cast<size_type>(get_element(row_ptrs, num_rows));
+    auto tmp = csr_type::create(exec, this->get_size(),
+                                array<ValueType>{exec, nnz},
+                                array<IndexType>{exec, nnz},
+                                std::move(row_ptrs), result->get_strategy());
+    exec->run(symmetric_csr::make_fill_in_csr(this, tmp.get()));
+    tmp->move_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::move_to(
+    Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    auto tmp = csr_type::create(this->get_executor());
+    tmp->read(data);
+    this->read_upper(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    auto tmp = csr_type::create(this->get_executor());
+    tmp->read(data);
+    this->read_upper(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    auto tmp = csr_type::create(this->get_executor());
+    tmp->read(std::move(data));
+    this->read_upper(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto tmp = csr_type::create(this->get_executor());
+    this->convert_to(tmp.get());
+    tmp->write(data);
+}
+
+
+#define GKO_DECLARE_SYMMETRIC_CSR_MATRIX(ValueType, IndexType) \
+    class SymmetricCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_SYMMETRIC_CSR_KERNELS_HPP_
+#define GKO_CORE_MATRIX_SYMMETRIC_CSR_KERNELS_HPP_
+
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL(ValueType, IndexType) \
+    void spmv(std::shared_ptr<const DefaultExecutor> exec,          \
+              const matrix::SymmetricCsr<ValueType, IndexType>* a,  \
+              const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType) \
+    void advanced_spmv(std::shared_ptr<const DefaultExecutor> exec,          \
+                       const matrix::Dense<ValueType>* alpha,                \
+                       const matrix::SymmetricCsr<ValueType, IndexType>* a,  \
+                       const matrix::Dense<ValueType>* b,                    \
+                       const matrix::Dense<ValueType>* beta,                 \
+                       matrix::Dense<ValueType>* c)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NONZEROS_PER_ROW_KERNEL( \
+    ValueType, IndexType)                                              \
+    void count_upper_nonzeros_per_row(                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                   \
+        const matrix::Csr<ValueType, IndexType>* source, IndexType* result)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_FILL_UPPER_KERNEL(ValueType, IndexType) \
+    void fill_upper(std::shared_ptr<const DefaultExecutor> exec,          \
+                    const matrix::Csr<ValueType, IndexType>* source,      \
+                    matrix::SymmetricCsr<ValueType, IndexType>* result)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_COUNT_NONZEROS_PER_ROW_KERNEL(ValueType, \
+                                                                IndexType) \
+    void count_nonzeros_per_row(                                           \
+        std::shared_ptr<const DefaultExecutor> exec,                       \
+        const matrix::SymmetricCsr<ValueType, IndexType>* source,          \
+        IndexType* result)
+
+#define GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL(ValueType, IndexType)     \
+    void fill_in_csr(std::shared_ptr<const DefaultExecutor> exec,              \
+                     const matrix::SymmetricCsr<ValueType, IndexType>* source, \
+                     matrix::Csr<ValueType, IndexType>* result)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                          \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL(ValueType, IndexType);              \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType);     \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NONZEROS_PER_ROW_KERNEL(ValueType,  \
+                                                                  IndexType); \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_UPPER_KERNEL(ValueType, IndexType);        \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_NONZEROS_PER_ROW_KERNEL(ValueType,        \
+                                                            IndexType);       \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(symmetric_csr,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_SYMMETRIC_CSR_KERNELS_HPP_
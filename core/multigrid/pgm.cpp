@@ -5,16 +5,25 @@
 #include <ginkgo/core/multigrid/pgm.hpp>
 
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/matrix_data.hpp>
 #include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/base/polymorphic_object.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/base/utils.hpp>
 #include <ginkgo/core/distributed/base.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
+#include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
+#include <ginkgo/core/log/logger.hpp>
 #include <ginkgo/core/matrix/coo.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
@@ -160,15 +169,20 @@ Pgm<ValueType, IndexType>::parse(const config::pnode& config,
     if (auto& obj = config.get("skip_sorting")) {
         params.with_skip_sorting(gko::config::get_value<bool>(obj));
     }
+    if (auto& obj = config.get("agglomeration_threshold")) {
+        params.with_agglomeration_threshold(
+            gko::config::get_value<size_type>(obj));
+    }
+    if (auto& obj = config.get("cross_rank_aggregates")) {
+        params.with_cross_rank_aggregates(gko::config::get_value<bool>(obj));
+    }
 
     return params;
 }
 
 
 template <typename ValueType, typename IndexType>
-std::tuple<std::shared_ptr<LinOp>, std::shared_ptr<LinOp>,
-           std::shared_ptr<LinOp>>
-Pgm<ValueType, IndexType>::generate_local(
+IndexType Pgm<ValueType, IndexType>::compute_aggregates(
     std::shared_ptr<const matrix::Csr<ValueType, IndexType>> local_matrix)
 {
     using csr_type = matrix::Csr<ValueType, IndexType>;
@@ -226,6 +240,18 @@ Pgm<ValueType, IndexType>::generate_local(
     IndexType num_agg = 0;
     // Renumber the index
     exec->run(pgm::make_renumber(agg_, &num_agg));
+    return num_agg;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::tuple<std::shared_ptr<LinOp>, std::shared_ptr<LinOp>,
+           std::shared_ptr<LinOp>>
+Pgm<ValueType, IndexType>::generate_local(
+    std::shared_ptr<const matrix::Csr<ValueType, IndexType>> local_matrix)
+{
+    auto exec = this->get_executor();
+    const auto num_agg = this->compute_aggregates(local_matrix);
     gko::dim<2>::dimension_type coarse_dim = num_agg;
     auto fine_dim = local_matrix->get_size()[0];
     // prolong_row_gather is the lightway implementation for prolongation
@@ -384,6 +410,242 @@ void compute_communication(
 #undef GKO_ASSERT_HOST_ARRAY
 
 
+#if GINKGO_BUILD_MPI
+
+
+template <typename ValueType, typename IndexType>
+template <typename GlobalIndexType>
+void Pgm<ValueType, IndexType>::log_coarse_level(
+    std::shared_ptr<const experimental::distributed::Matrix<
+        ValueType, IndexType, GlobalIndexType>>
+        coarse)
+{
+    const auto comm = coarse->get_communicator();
+    auto exec = gko::as<LinOp>(coarse)->get_executor();
+    int num_active_ranks = coarse->get_local_matrix()->get_size()[0] > 0;
+    comm.all_reduce(exec->get_master(), &num_active_ranks, 1, MPI_SUM);
+    const auto send_volume =
+        static_cast<size_type>(coarse->send_offsets_.back());
+    const auto recv_volume =
+        static_cast<size_type>(coarse->recv_offsets_.back());
+    // the level is generated in the constructor, before the factory adds its
+    // loggers to it
+    for (const auto& logger : factory_loggers_) {
+        logger->template on<log::Logger::multigrid_level_generated>(
+            this, coarse.get(), num_active_ranks, send_volume, recv_volume);
+    }
+    this->template log<log::Logger::multigrid_level_generated>(
+        this, coarse.get(), num_active_ranks, send_volume, recv_volume);
+}
+
+
+template <typename ValueType, typename IndexType>
+template <typename GlobalIndexType>
+void Pgm<ValueType, IndexType>::generate_redistributed(
+    std::shared_ptr<const experimental::distributed::Matrix<
+        ValueType, IndexType, GlobalIndexType>>
+        matrix)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    using dist_mtx_type =
+        experimental::distributed::Matrix<ValueType, IndexType,
+                                          GlobalIndexType>;
+    using partition_type =
+        experimental::distributed::Partition<IndexType, GlobalIndexType>;
+    using experimental::distributed::comm_index_type;
+    auto exec = gko::as<LinOp>(matrix)->get_executor();
+    auto host_exec = exec->get_master();
+    const auto comm = matrix->get_communicator();
+    const auto rank = comm.rank();
+    const auto num_ranks = comm.size();
+    const auto& recv_offsets = matrix->recv_offsets_;
+    auto local_csr = make_temporary_clone(
+        host_exec, as<const csr_type>(matrix->get_local_matrix()));
+    auto non_local_csr = make_temporary_clone(
+        host_exec, as<const csr_type>(matrix->get_non_local_matrix()));
+    const auto num_rows = static_cast<IndexType>(local_csr->get_size()[0]);
+    const auto non_local_size = non_local_csr->get_size()[1];
+    auto non_local_owner_rank = [&](IndexType col) {
+        return static_cast<IndexType>(
+            std::distance(recv_offsets.begin(),
+                          std::upper_bound(recv_offsets.begin(),
+                                           recv_offsets.end(), col)) -
+            1);
+    };
+
+    auto num_agg = this->compute_aggregates(
+        as<const csr_type>(matrix->get_local_matrix()));
+    // every local row belongs to the aggregate owner_agg on rank owner
+    array<IndexType> owner(host_exec, num_rows);
+    array<IndexType> owner_agg(host_exec, agg_);
+    std::fill_n(owner.get_data(), num_rows, static_cast<IndexType>(rank));
+    if (parameters_.cross_rank_aggregates) {
+        std::vector<IndexType> agg_size(num_agg, 0);
+        for (IndexType row = 0; row < num_rows; row++) {
+            agg_size[owner_agg.get_const_data()[row]]++;
+        }
+        array<IndexType> is_alone(host_exec, num_rows);
+        for (IndexType row = 0; row < num_rows; row++) {
+            is_alone.get_data()[row] =
+                agg_size[owner_agg.get_const_data()[row]] == 1;
+        }
+        array<IndexType> non_local_alone(exec, non_local_size);
+        communicate(matrix, array<IndexType>(exec, is_alone), non_local_alone);
+        non_local_alone.set_executor(host_exec);
+        // a row aggregated alone joins the aggregate of its strongest
+        // non-local neighbor, unless that one is aggregated alone as well.
+        // Aggregates with more than one row never lose rows, so the target
+        // aggregates stay valid.
+        std::vector<IndexType> partner(num_rows, -1);
+        const auto row_ptrs = non_local_csr->get_const_row_ptrs();
+        const auto col_idxs = non_local_csr->get_const_col_idxs();
+        const auto vals = non_local_csr->get_const_values();
+        for (IndexType row = 0; row < num_rows; row++) {
+            if (!is_alone.get_const_data()[row]) {
+                continue;
+            }
+            remove_complex<ValueType> strongest{};
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto col = col_idxs[nz];
+                if (!non_local_alone.get_const_data()[col] &&
+                    abs(vals[nz]) > strongest) {
+                    strongest = abs(vals[nz]);
+                    partner[row] = col;
+                }
+            }
+            if (partner[row] != -1) {
+                agg_size[owner_agg.get_const_data()[row]] = 0;
+            }
+        }
+        // renumber the local aggregates without the emptied ones
+        std::vector<IndexType> new_agg(num_agg);
+        num_agg = 0;
+        for (size_type agg = 0; agg < agg_size.size(); agg++) {
+            new_agg[agg] = agg_size[agg] > 0 ? num_agg++ : -1;
+        }
+        for (IndexType row = 0; row < num_rows; row++) {
+            owner_agg.get_data()[row] =
+                partner[row] == -1 ? new_agg[owner_agg.get_const_data()[row]]
+                                   : -1;
+        }
+        array<IndexType> non_local_agg(exec, non_local_size);
+        communicate(matrix, array<IndexType>(exec, owner_agg), non_local_agg);
+        non_local_agg.set_executor(host_exec);
+        agg_ = owner_agg;
+        for (IndexType row = 0; row < num_rows; row++) {
+            if (partner[row] != -1) {
+                owner.get_data()[row] = non_local_owner_rank(partner[row]);
+                owner_agg.get_data()[row] =
+                    non_local_agg.get_const_data()[partner[row]];
+            }
+        }
+    }
+
+    // global numbering of the fine rows and of the coarse rows before the
+    // agglomeration
+    std::vector<GlobalIndexType> fine_offsets(num_ranks + 1, 0);
+    std::vector<GlobalIndexType> coarse_offsets(num_ranks + 1, 0);
+    GlobalIndexType local_num_rows = num_rows;
+    GlobalIndexType local_num_agg = num_agg;
+    comm.all_gather(host_exec, &local_num_rows, 1, fine_offsets.data() + 1, 1);
+    comm.all_gather(host_exec, &local_num_agg, 1, coarse_offsets.data() + 1,
+                    1);
+    std::partial_sum(fine_offsets.begin(), fine_offsets.end(),
+                     fine_offsets.begin());
+    std::partial_sum(coarse_offsets.begin(), coarse_offsets.end(),
+                     coarse_offsets.begin());
+    const auto fine_size = static_cast<size_type>(fine_offsets.back());
+    const auto coarse_size = static_cast<size_type>(coarse_offsets.back());
+
+    // the coarse rows of neighboring ranks are merged into groups until every
+    // group owns at least agglomeration_threshold rows on average
+    comm_index_type group_size = 1;
+    const auto threshold = parameters_.agglomeration_threshold;
+    if (threshold > 0 && coarse_size < threshold * num_ranks) {
+        const auto num_groups = std::max<comm_index_type>(
+            1, static_cast<comm_index_type>(coarse_size / threshold));
+        group_size =
+            static_cast<comm_index_type>(ceildiv(num_ranks, num_groups));
+    }
+    std::vector<GlobalIndexType> coarse_ranges(num_ranks + 1);
+    for (comm_index_type part = 0; part <= num_ranks; part++) {
+        coarse_ranges[part] =
+            coarse_offsets[std::min(part * group_size, num_ranks)];
+    }
+    auto fine_part = share(partition_type::build_from_contiguous(
+        exec, array<GlobalIndexType>(host_exec, fine_offsets.begin(),
+                                     fine_offsets.end())));
+    auto coarse_part = share(partition_type::build_from_contiguous(
+        exec, array<GlobalIndexType>(host_exec, coarse_ranges.begin(),
+                                     coarse_ranges.end())));
+
+    // global coarse index of the local and non-local fine rows
+    std::vector<GlobalIndexType> global_agg(num_rows);
+    for (IndexType row = 0; row < num_rows; row++) {
+        global_agg[row] = coarse_offsets[owner.get_const_data()[row]] +
+                          owner_agg.get_const_data()[row];
+    }
+    array<IndexType> non_local_owner(exec, non_local_size);
+    array<IndexType> non_local_owner_agg(exec, non_local_size);
+    communicate(matrix, array<IndexType>(exec, owner), non_local_owner);
+    communicate(matrix, array<IndexType>(exec, owner_agg),
+                non_local_owner_agg);
+    non_local_owner.set_executor(host_exec);
+    non_local_owner_agg.set_executor(host_exec);
+    std::vector<GlobalIndexType> non_local_global_agg(non_local_size);
+    for (size_type col = 0; col < non_local_size; col++) {
+        non_local_global_agg[col] =
+            coarse_offsets[non_local_owner.get_const_data()[col]] +
+            non_local_owner_agg.get_const_data()[col];
+    }
+
+    // Galerkin product and restriction in global indices, the coarse rows
+    // may belong to other ranks and are assembled on their owners
+    matrix_data<ValueType, GlobalIndexType> coarse_data{
+        dim<2>{coarse_size, coarse_size}};
+    matrix_data<ValueType, GlobalIndexType> restrict_data{
+        dim<2>{coarse_size, fine_size}};
+    matrix_data<ValueType, GlobalIndexType> prolong_data{
+        dim<2>{fine_size, coarse_size}};
+    for (IndexType row = 0; row < num_rows; row++) {
+        const auto fine_row = fine_offsets[rank] + row;
+        for (auto nz = local_csr->get_const_row_ptrs()[row];
+             nz < local_csr->get_const_row_ptrs()[row + 1]; nz++) {
+            coarse_data.nonzeros.emplace_back(
+                global_agg[row],
+                global_agg[local_csr->get_const_col_idxs()[nz]],
+                local_csr->get_const_values()[nz]);
+        }
+        for (auto nz = non_local_csr->get_const_row_ptrs()[row];
+             nz < non_local_csr->get_const_row_ptrs()[row + 1]; nz++) {
+            coarse_data.nonzeros.emplace_back(
+                global_agg[row],
+                non_local_global_agg[non_local_csr->get_const_col_idxs()[nz]],
+                non_local_csr->get_const_values()[nz]);
+        }
+        restrict_data.nonzeros.emplace_back(global_agg[row], fine_row,
+                                            one<ValueType>());
+        prolong_data.nonzeros.emplace_back(fine_row, global_agg[row],
+                                           one<ValueType>());
+    }
+    auto coarse = share(dist_mtx_type::create(exec, comm));
+    coarse->read_distributed(
+        coarse_data, coarse_part,
+        experimental::distributed::assembly_mode::communicate);
+    auto restrict_op = share(dist_mtx_type::create(exec, comm));
+    restrict_op->read_distributed(
+        restrict_data, coarse_part, fine_part,
+        experimental::distributed::assembly_mode::communicate);
+    auto prolong_op = share(dist_mtx_type::create(exec, comm));
+    prolong_op->read_distributed(prolong_data, fine_part, coarse_part);
+    this->set_multigrid_level(prolong_op, coarse, restrict_op);
+    this->log_coarse_level(std::shared_ptr<const dist_mtx_type>(coarse));
+}
+
+
+#endif  // GINKGO_BUILD_MPI
+
+
 template <typename ValueType, typename IndexType>
 void Pgm<ValueType, IndexType>::generate()
 {
@@ -442,6 +704,11 @@ void Pgm<ValueType, IndexType>::generate()
         }
 
         auto distributed_setup = [&](auto matrix) {
+            if (parameters_.agglomeration_threshold > 0 ||
+                parameters_.cross_rank_aggregates) {
+                this->generate_redistributed(matrix);
+                return;
+            }
             auto exec = gko::as<LinOp>(matrix)->get_executor();
             auto comm =
                 gko::as<experimental::distributed::DistributedBase>(matrix)
@@ -518,6 +785,8 @@ void Pgm<ValueType, IndexType>::generate()
                                coarse_size),
                         std::get<0>(result)));
             this->set_multigrid_level(prolong_op, coarse, restrict_op);
+            this->log_coarse_level(
+                std::shared_ptr<const std::decay_t<decltype(*coarse)>>(coarse));
         };
 
         // the fine op is using csr with the current ValueType
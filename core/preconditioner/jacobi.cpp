@@ -24,6 +24,7 @@
 #include "core/base/utils.hpp"
 #include "core/config/config_helper.hpp"
 #include "core/config/dispatch.hpp"
+#include "core/log/work_estimate.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
 #include "core/preconditioner/jacobi_utils.hpp"
 
@@ -148,14 +149,25 @@ void Jacobi<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
 {
     precision_dispatch_real_complex<ValueType>(
         [this](auto dense_b, auto dense_x) {
+            using b_value_type =
+                typename std::decay_t<decltype(*dense_b)>::value_type;
+            const auto work =
+                log::stored_apply_work<ValueType, b_value_type, b_value_type>(
+                    this->get_size()[0], this->get_size()[1],
+                    this->get_num_stored_elements(), dense_b->get_size()[1]);
             if (parameters_.max_block_size == 1) {
-                this->get_executor()->run(jacobi::make_simple_scalar_apply(
-                    this->blocks_, dense_b, dense_x));
+                this->get_executor()->run(
+                    jacobi::make_simple_scalar_apply(this->blocks_, dense_b,
+                                                     dense_x),
+                    work.flops, work.bytes);
             } else {
-                this->get_executor()->run(jacobi::make_simple_apply(
-                    num_blocks_, parameters_.max_block_size, storage_scheme_,
-                    parameters_.storage_optimization.block_wise,
-                    parameters_.block_pointers, blocks_, dense_b, dense_x));
+                this->get_executor()->run(
+                    jacobi::make_simple_apply(
+                        num_blocks_, parameters_.max_block_size,
+                        storage_scheme_,
+                        parameters_.storage_optimization.block_wise,
+                        parameters_.block_pointers, blocks_, dense_b, dense_x),
+                    work.flops, work.bytes);
             }
         },
         b, x);
@@ -169,15 +181,27 @@ void Jacobi<ValueType, IndexType>::apply_impl(const LinOp* alpha,
 {
     precision_dispatch_real_complex<ValueType>(
         [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            using b_value_type =
+                typename std::decay_t<decltype(*dense_b)>::value_type;
+            const auto work =
+                log::stored_apply_work<ValueType, b_value_type, b_value_type>(
+                    this->get_size()[0], this->get_size()[1],
+                    this->get_num_stored_elements(), dense_b->get_size()[1],
+                    true);
             if (parameters_.max_block_size == 1) {
-                this->get_executor()->run(jacobi::make_scalar_apply(
-                    this->blocks_, dense_alpha, dense_b, dense_beta, dense_x));
+                this->get_executor()->run(
+                    jacobi::make_scalar_apply(this->blocks_, dense_alpha,
+                                              dense_b, dense_beta, dense_x),
+                    work.flops, work.bytes);
             } else {
-                this->get_executor()->run(jacobi::make_apply(
-                    num_blocks_, parameters_.max_block_size, storage_scheme_,
-                    parameters_.storage_optimization.block_wise,
-                    parameters_.block_pointers, blocks_, dense_alpha, dense_b,
-                    dense_beta, dense_x));
+                this->get_executor()->run(
+                    jacobi::make_apply(
+                        num_blocks_, parameters_.max_block_size,
+                        storage_scheme_,
+                        parameters_.storage_optimization.block_wise,
+                        parameters_.block_pointers, blocks_, dense_alpha,
+                        dense_b, dense_beta, dense_x),
+                    work.flops, work.bytes);
             }
         },
         alpha, b, beta, x);
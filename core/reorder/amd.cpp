@@ -17,11 +17,23 @@
 
 
 #include "core/base/allocator.hpp"
+#include "core/reorder/amd_kernels.hpp"
 
 
 namespace gko {
 namespace experimental {
 namespace reorder {
+namespace amd {
+namespace {
+
+
+GKO_REGISTER_OPERATION(compute_permutation, amd::compute_permutation);
+
+
+}  // anonymous namespace
+}  // namespace amd
+
+
 namespace suitesparse_wrapper {
 
 
@@ -148,6 +160,15 @@ std::unique_ptr<LinOp> Amd<IndexType>::generate_impl(
                              make_array_view(exec, d_nnz, d_col_idxs),
                              make_array_view(exec, num_rows + 1, d_row_ptrs));
     pattern = pattern->to_adjacency_matrix();
+    if (std::dynamic_pointer_cast<const OmpExecutor>(exec) &&
+        !std::dynamic_pointer_cast<const ReferenceExecutor>(exec)) {
+        // use the parallel elimination instead of SuiteSparse
+        array<IndexType> permutation{exec, num_rows};
+        exec->run(amd::make_compute_permutation(
+            static_cast<IndexType>(num_rows), pattern->get_const_row_ptrs(),
+            pattern->get_const_col_idxs(), permutation.get_data()));
+        return permutation_type::create(exec, std::move(permutation));
+    }
     // copy data to the CPU
     array<IndexType> row_ptrs{host_exec, num_rows + 1};
     host_exec->copy_from(exec, num_rows + 1, pattern->get_const_row_ptrs(),
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/multi_color.hpp>
+
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+#include "core/reorder/multi_color_kernels.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace multi_color {
+namespace {
+
+
+GKO_REGISTER_OPERATION(compute_coloring, multi_color::compute_coloring);
+
+
+}  // anonymous namespace
+}  // namespace multi_color
+
+
+template <typename IndexType>
+MultiColor<IndexType>::MultiColor(std::shared_ptr<const Executor> exec,
+                                  const parameters_type& params)
+    : EnablePolymorphicObject<MultiColor, LinOpFactory>(std::move(exec)),
+      parameters_{params}
+{}
+
+
+template <typename IndexType>
+std::unique_ptr<matrix::Permutation<IndexType>> MultiColor<IndexType>::generate(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    auto product =
+        std::unique_ptr<permutation_type>(static_cast<permutation_type*>(
+            this->LinOpFactory::generate(std::move(system_matrix)).release()));
+    return product;
+}
+
+
+template <typename IndexType>
+std::unique_ptr<matrix::Permutation<IndexType>> MultiColor<IndexType>::generate(
+    std::shared_ptr<const LinOp> system_matrix,
+    array<index_type>& color_ptrs) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+    const auto exec = this->get_executor();
+    // the coloring is computed on the host
+    const auto host_exec = exec->get_master();
+    const auto num_rows = system_matrix->get_size()[0];
+    std::unique_ptr<LinOp> converted;
+    // extract row pointers and column indices
+    const IndexType* row_ptrs{};
+    const IndexType* col_idxs{};
+    auto convert = [&](auto op, auto value_type) {
+        using ValueType = std::decay_t<decltype(value_type)>;
+        using Identity = matrix::Identity<ValueType>;
+        using Mtx = matrix::Csr<ValueType, IndexType>;
+        using Scalar = matrix::Dense<ValueType>;
+        auto conv_csr = Mtx::create(exec);
+        as<ConvertibleTo<Mtx>>(op)->convert_to(conv_csr);
+        if (!parameters_.skip_symmetrize) {
+            auto scalar = initialize<Scalar>({one<ValueType>()}, exec);
+            auto id = Identity::create(exec, conv_csr->get_size()[0]);
+            // compute A^T + A
+            conv_csr->transpose()->apply(scalar, id, scalar, conv_csr);
+        }
+        if (exec != host_exec) {
+            conv_csr = gko::clone(host_exec, std::move(conv_csr));
+        }
+        row_ptrs = conv_csr->get_const_row_ptrs();
+        col_idxs = conv_csr->get_const_col_idxs();
+        converted = std::move(conv_csr);
+    };
+    if (dynamic_cast<const ConvertibleTo<matrix::Csr<float, IndexType>>*>(
+            system_matrix.get())) {
+        convert(system_matrix, float{});
+    } else {
+        convert(system_matrix, std::complex<float>{});
+    }
+    array<IndexType> colors{host_exec, num_rows};
+    host_exec->run(multi_color::make_compute_coloring(
+        static_cast<IndexType>(num_rows), row_ptrs, col_idxs,
+        parameters_.distance, colors.get_data()));
+    // sort the rows by color, keeping their order within each color
+    const auto colors_data = colors.get_const_data();
+    const auto max_color =
+        num_rows > 0 ? *std::max_element(colors_data, colors_data + num_rows)
+                     : IndexType{-1};
+    const auto num_colors = static_cast<size_type>(max_color + 1);
+    array<IndexType> host_color_ptrs{host_exec, num_colors + 1};
+    const auto color_ptrs_data = host_color_ptrs.get_data();
+    std::fill_n(color_ptrs_data, num_colors + 1, IndexType{});
+    for (size_type row = 0; row < num_rows; row++) {
+        color_ptrs_data[colors_data[row] + 1]++;
+    }
+    std::partial_sum(color_ptrs_data, color_ptrs_data + num_colors + 1,
+                     color_ptrs_data);
+    array<IndexType> permutation{host_exec, num_rows};
+    array<IndexType> fill_ptrs{host_exec, num_colors};
+    std::copy_n(color_ptrs_data, num_colors, fill_ptrs.get_data());
+    for (size_type row = 0; row < num_rows; row++) {
+        permutation.get_data()[fill_ptrs.get_data()[colors_data[row]]++] =
+            static_cast<IndexType>(row);
+    }
+    color_ptrs = array<index_type>{exec, std::move(host_color_ptrs)};
+    // permutation gets copied to device via gko::array constructor
+    return permutation_type::create(exec, std::move(permutation));
+}
+
+
+template <typename IndexType>
+std::unique_ptr<LinOp> MultiColor<IndexType>::generate_impl(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    array<index_type> color_ptrs{this->get_executor()};
+    return this->generate(std::move(system_matrix), color_ptrs);
+}
+
+
+#define GKO_DECLARE_MULTI_COLOR(IndexType) class MultiColor<IndexType>
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_MULTI_COLOR);
+
+
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
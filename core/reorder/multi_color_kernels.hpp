@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_REORDER_MULTI_COLOR_KERNELS_HPP_
+#define GKO_CORE_REORDER_MULTI_COLOR_KERNELS_HPP_
+
+
+#include <ginkgo/core/reorder/multi_color.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_MULTI_COLOR_COMPUTE_COLORING_KERNEL(IndexType)           \
+    void compute_coloring(                                                   \
+        std::shared_ptr<const DefaultExecutor> exec, IndexType num_vertices, \
+        const IndexType* row_ptrs, const IndexType* col_idxs,                \
+        gko::experimental::reorder::multi_color_distance distance,           \
+        IndexType* colors)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                      \
+    /* the Jones-Plassmann priority of a vertex, a bijection on uint64 */ \
+    inline uint64 coloring_priority(uint64 vertex)                        \
+    {                                                                     \
+        vertex = (vertex ^ (vertex >> 30)) * 0xbf58476d1ce4e5b9ull;       \
+        vertex = (vertex ^ (vertex >> 27)) * 0x94d049bb133111ebull;       \
+        return vertex ^ (vertex >> 31);                                   \
+    }                                                                     \
+    template <typename IndexType>                                         \
+    GKO_DECLARE_MULTI_COLOR_COMPUTE_COLORING_KERNEL(IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(multi_color,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_MULTI_COLOR_KERNELS_HPP_
@@ -30,6 +30,7 @@ GKO_REGISTER_OPERATION(initialize, bicgstab::initialize);
 GKO_REGISTER_OPERATION(step_1, bicgstab::step_1);
 GKO_REGISTER_OPERATION(step_2, bicgstab::step_2);
 GKO_REGISTER_OPERATION(step_3, bicgstab::step_3);
+GKO_REGISTER_OPERATION(step_3_and_dot, bicgstab::step_3_and_dot);
 GKO_REGISTER_OPERATION(finalize, bicgstab::finalize);
 
 
@@ -141,6 +142,13 @@ void Bicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
     // rr = r
     rr->copy_from(r);
 
+    // rho = dot(rr, r) is computed in the same pass that updates r at the end
+    // of the previous iteration
+    const bool fuse_rho = !gko::detail::is_distributed(dense_b);
+    if (fuse_rho) {
+        rr->compute_conj_dot(r, rho, reduction_tmp);
+    }
+
     int iter = -1;
 
     /* Memory movement summary:
@@ -153,10 +161,14 @@ void Bicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
      * 1x step 2 (axpy)        3n
      * 1x step 3 (fused axpys) 7n
      * 2x norm2 residual       2n
+     * Without distributed vectors, 30n * values + 2 * matrix/preconditioner
+     * storage: the first dot is fused into step 3
      */
     while (true) {
         ++iter;
-        rr->compute_conj_dot(r, rho, reduction_tmp);
+        if (!fuse_rho) {
+            rr->compute_conj_dot(r, rho, reduction_tmp);
+        }
 
         bool all_stopped =
             stop_criterion->update()
@@ -221,11 +233,21 @@ void Bicgstab<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // omega = gamma / beta
         // x = x + alpha * y + omega * z
         // r = s - omega * t
-        exec->run(bicgstab::make_step_3(
-            gko::detail::get_local(dense_x), gko::detail::get_local(r),
-            gko::detail::get_local(s), gko::detail::get_local(t),
-            gko::detail::get_local(y), gko::detail::get_local(z), alpha, beta,
-            gamma, omega, &stop_status));
+        if (fuse_rho) {
+            // prev_rho = dot(rr, r), which becomes rho after the swap
+            exec->run(bicgstab::make_step_3_and_dot(
+                gko::detail::get_local(dense_x), gko::detail::get_local(r),
+                gko::detail::get_local(s), gko::detail::get_local(t),
+                gko::detail::get_local(y), gko::detail::get_local(z),
+                gko::detail::get_local(rr), alpha, beta, gamma, omega,
+                prev_rho, reduction_tmp, &stop_status));
+        } else {
+            exec->run(bicgstab::make_step_3(
+                gko::detail::get_local(dense_x), gko::detail::get_local(r),
+                gko::detail::get_local(s), gko::detail::get_local(t),
+                gko::detail::get_local(y), gko::detail::get_local(z), alpha,
+                beta, gamma, omega, &stop_status));
+        }
         swap(prev_rho, rho);
     }
 }
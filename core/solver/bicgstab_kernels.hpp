@@ -67,6 +67,18 @@ namespace bicgstab {
         const array<stopping_status>* stop_status)
 
 
+#define GKO_DECLARE_BICGSTAB_STEP_3_AND_DOT_KERNEL(_type)                     \
+    void step_3_and_dot(                                                      \
+        std::shared_ptr<const DefaultExecutor> exec, matrix::Dense<_type>* x, \
+        matrix::Dense<_type>* r, const matrix::Dense<_type>* s,               \
+        const matrix::Dense<_type>* t, const matrix::Dense<_type>* y,         \
+        const matrix::Dense<_type>* z, const matrix::Dense<_type>* rr,        \
+        const matrix::Dense<_type>* alpha, const matrix::Dense<_type>* beta,  \
+        const matrix::Dense<_type>* gamma, matrix::Dense<_type>* omega,       \
+        matrix::Dense<_type>* new_rho, array<char>& tmp,                      \
+        const array<stopping_status>* stop_status)
+
+
 #define GKO_DECLARE_BICGSTAB_FINALIZE_KERNEL(_type)                       \
     void finalize(std::shared_ptr<const DefaultExecutor> exec,            \
                   matrix::Dense<_type>* x, const matrix::Dense<_type>* y, \
@@ -74,16 +86,18 @@ namespace bicgstab {
                   array<stopping_status>* stop_status)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES                   \
-    template <typename ValueType>                      \
-    GKO_DECLARE_BICGSTAB_INITIALIZE_KERNEL(ValueType); \
-    template <typename ValueType>                      \
-    GKO_DECLARE_BICGSTAB_STEP_1_KERNEL(ValueType);     \
-    template <typename ValueType>                      \
-    GKO_DECLARE_BICGSTAB_STEP_2_KERNEL(ValueType);     \
-    template <typename ValueType>                      \
-    GKO_DECLARE_BICGSTAB_STEP_3_KERNEL(ValueType);     \
-    template <typename ValueType>                      \
+#define GKO_DECLARE_ALL_AS_TEMPLATES                       \
+    template <typename ValueType>                          \
+    GKO_DECLARE_BICGSTAB_INITIALIZE_KERNEL(ValueType);     \
+    template <typename ValueType>                          \
+    GKO_DECLARE_BICGSTAB_STEP_1_KERNEL(ValueType);         \
+    template <typename ValueType>                          \
+    GKO_DECLARE_BICGSTAB_STEP_2_KERNEL(ValueType);         \
+    template <typename ValueType>                          \
+    GKO_DECLARE_BICGSTAB_STEP_3_KERNEL(ValueType);         \
+    template <typename ValueType>                          \
+    GKO_DECLARE_BICGSTAB_STEP_3_AND_DOT_KERNEL(ValueType); \
+    template <typename ValueType>                          \
     GKO_DECLARE_BICGSTAB_FINALIZE_KERNEL(ValueType)
 
 
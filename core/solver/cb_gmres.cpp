@@ -5,7 +5,9 @@
 #include <ginkgo/core/solver/cb_gmres.hpp>
 
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 
 #include <ginkgo/core/base/array.hpp>
@@ -159,6 +161,66 @@ struct helper<std::complex<T>> {
 };
 
 
+/**
+ * Returns the storage precisions an adaptive CB-GMRES solve escalates
+ * through, from the most compressed to the most precise one. Precisions that
+ * do not store the Krylov basis in more bits than the previous one are
+ * skipped.
+ */
+template <typename ValueType>
+std::vector<cb_gmres::storage_precision> get_adaptive_storage_precisions()
+{
+    std::vector<cb_gmres::storage_precision> precisions;
+    size_type last_size{};
+    for (auto precision : {cb_gmres::storage_precision::reduce2,
+                           cb_gmres::storage_precision::reduce1,
+                           cb_gmres::storage_precision::keep}) {
+        size_type size{};
+        helper<ValueType>::call([&](auto value) { size = sizeof(value); },
+                                precision);
+        if (size > last_size) {
+            precisions.push_back(precision);
+            last_size = size;
+        }
+    }
+    return precisions;
+}
+
+
+/**
+ * Returns true if the last restart cycle of an adaptive CB-GMRES solve shows
+ * that the Krylov basis needs to be stored more precisely, i.e. if for any
+ * right-hand side that has not converged yet, the residual norm after the
+ * restart exceeds the residual norm estimated by the Arnoldi process by more
+ * than residual_gap, or a full restart cycle reduced the residual norm by
+ * less than stagnation_ratio. All norms need to be stored on the host.
+ */
+template <typename RealType>
+bool needs_higher_storage_precision(
+    const matrix::Dense<RealType>* implicit_norm,
+    const matrix::Dense<RealType>* residual_norm,
+    const matrix::Dense<RealType>* cycle_start_norm,
+    const array<bool>& fully_converged_rhs, bool full_cycle,
+    double residual_gap, double stagnation_ratio)
+{
+    for (size_type i = 0; i < residual_norm->get_size()[1]; ++i) {
+        if (fully_converged_rhs.get_const_data()[i]) {
+            continue;
+        }
+        const auto norm = residual_norm->at(0, i);
+        if (norm >
+            static_cast<RealType>(residual_gap) * implicit_norm->at(0, i)) {
+            return true;
+        }
+        if (full_cycle && norm > static_cast<RealType>(stagnation_ratio) *
+                                     cycle_start_norm->at(0, i)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
 template <typename ValueType>
 typename CbGmres<ValueType>::parameters_type CbGmres<ValueType>::parse(
     const config::pnode& config, const config::registry& context,
@@ -184,11 +246,20 @@ typename CbGmres<ValueType>::parameters_type CbGmres<ValueType>::parse(
                 return storage_precision::ireduce1;
             } else if (str == "ireduce2") {
                 return storage_precision::ireduce2;
+            } else if (str == "adaptive") {
+                return storage_precision::adaptive;
             }
             GKO_INVALID_CONFIG_VALUE("storage_precision", str);
         };
         params.with_storage_precision(get_storage_precision(obj.get_string()));
     }
+    if (auto& obj = config.get("adaptive_residual_gap")) {
+        params.with_adaptive_residual_gap(gko::config::get_value<double>(obj));
+    }
+    if (auto& obj = config.get("adaptive_stagnation_ratio")) {
+        params.with_adaptive_stagnation_ratio(
+            gko::config::get_value<double>(obj));
+    }
     return params;
 }
 
@@ -212,80 +283,131 @@ void CbGmres<ValueType>::apply_dense_impl(
     const matrix::Dense<ValueType>* dense_b,
     matrix::Dense<ValueType>* dense_x) const
 {
+    using Vector = matrix::Dense<ValueType>;
+    using VectorNorms = matrix::Dense<remove_complex<ValueType>>;
+
+    constexpr uint8 RelativeStoppingId{1};
+
+    auto exec = this->get_executor();
+
+    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
+    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+
+    const auto num_rows = this->get_size()[0];
+    const auto num_rhs = dense_b->get_size()[1];
+    const auto krylov_dim = this->get_krylov_dim();
+    auto residual = Vector::create_with_config_of(dense_b);
+    /* The dimensions {x, y, z} explained for the krylov_bases:
+     * - x: selects the krylov vector (which has krylov_dim + 1 vectors)
+     * - y: selects the (row-)element of said krylov vector
+     * - z: selects which column-element of said krylov vector should be
+     *      used
+     */
+    const dim<3> krylov_bases_dim{krylov_dim + 1, num_rows, num_rhs};
+
+    auto next_krylov_basis = Vector::create_with_config_of(dense_b);
+    std::shared_ptr<matrix::Dense<ValueType>> preconditioned_vector =
+        Vector::create_with_config_of(dense_b);
+    auto hessenberg =
+        Vector::create(exec, dim<2>{krylov_dim + 1, krylov_dim * num_rhs});
+    auto buffer = Vector::create(exec, dim<2>{krylov_dim + 1, num_rhs});
+    auto givens_sin = Vector::create(exec, dim<2>{krylov_dim, num_rhs});
+    auto givens_cos = Vector::create(exec, dim<2>{krylov_dim, num_rhs});
+    auto residual_norm_collection =
+        Vector::create(exec, dim<2>{krylov_dim + 1, num_rhs});
+    auto residual_norm = VectorNorms::create(exec, dim<2>{1, num_rhs});
+    // 1st row of arnoldi_norm: == eta * norm2(old_next_krylov_basis)
+    //                          with eta == 1 / sqrt(2)
+    //                          (computed right before updating
+    //                          next_krylov_basis)
+    // 2nd row of arnoldi_norm: The actual arnoldi norm
+    //                          == norm2(next_krylov_basis)
+    // 3rd row of arnoldi_norm: the infinity norm of next_krylov_basis
+    //                          (ONLY when using a scalar accessor)
+    auto arnoldi_norm = VectorNorms::create(exec, dim<2>{3, num_rhs});
+    array<size_type> final_iter_nums(this->get_executor(), num_rhs);
+    auto y = Vector::create(exec, dim<2>{krylov_dim, num_rhs});
+
+    bool one_changed{};
+    array<char> reduction_tmp{this->get_executor()};
+    array<stopping_status> stop_status(this->get_executor(), num_rhs);
+    // reorth_status and num_reorth are both helper variables for GPU
+    // implementations at the moment.
+    // num_reorth := Number of vectors which require a re-orthogonalization
+    // reorth_status := stopping status for the re-orthogonalization,
+    //                  marking which RHS requires one, and which does not
+    array<stopping_status> reorth_status(this->get_executor(), num_rhs);
+    array<size_type> num_reorth(this->get_executor(), 1);
+
+    std::unique_ptr<stop::Criterion> stop_criterion;
+
+    int total_iter = -1;
+    size_type restart_iter = 0;
+
+    auto before_preconditioner =
+        matrix::Dense<ValueType>::create_with_config_of(dense_x);
+    auto after_preconditioner =
+        matrix::Dense<ValueType>::create_with_config_of(dense_x);
+
+    array<bool> stop_encountered_rhs(exec->get_master(), num_rhs);
+    array<bool> fully_converged_rhs(exec->get_master(), num_rhs);
+    array<stopping_status> host_stop_status(this->get_executor()->get_master(),
+                                            stop_status);
+    for (size_type i = 0; i < stop_encountered_rhs.get_size(); ++i) {
+        stop_encountered_rhs.get_data()[i] = false;
+        fully_converged_rhs.get_data()[i] = false;
+    }
+    // Start only after this value with performing forced iterations after
+    // convergence detection
+    constexpr int start_force_reset{10};
+    bool perform_reset{false};
+    // Fraction of the krylov_dim (or total_iter if it is lower),
+    // determining the number of forced iteration to perform
+    constexpr size_type forced_iteration_fraction{10};
+    const size_type forced_limit{krylov_dim / forced_iteration_fraction};
+    // Counter for the forced iterations. Start at max in order to properly
+    // test convergence at the beginning
+    size_type forced_iterations{forced_limit};
+
+    // With the adaptive storage precision, the solve is split into stages
+    // using increasingly precise Krylov basis storage. A stage ends at a
+    // restart, and the next stage resumes the iteration right after it.
+    const bool adaptive =
+        this->get_storage_precision() == cb_gmres::storage_precision::adaptive;
+    bool can_escalate{false};
+    bool escalate{false};
+    bool resume{false};
+    // Host copies of the residual norms estimated by the Arnoldi process
+    // right before a restart, computed explicitly at the restart, and at the
+    // start of the current restart cycle
+    auto host_implicit_norm =
+        VectorNorms::create(exec->get_master(), dim<2>{1, num_rhs});
+    auto host_residual_norm =
+        VectorNorms::create(exec->get_master(), dim<2>{1, num_rhs});
+    auto host_cycle_start_norm =
+        VectorNorms::create(exec->get_master(), dim<2>{1, num_rhs});
+
     // Current workaround to get a lambda with a template argument (only
     // the type of `value` matters, the content does not)
     auto apply_templated = [&](auto value) {
         using storage_type = decltype(value);
-
-        using Vector = matrix::Dense<ValueType>;
-        using VectorNorms = matrix::Dense<remove_complex<ValueType>>;
         using Range3dHelper =
             gko::cb_gmres::Range3dHelper<ValueType, storage_type>;
 
-
-        constexpr uint8 RelativeStoppingId{1};
-
-        auto exec = this->get_executor();
-
-        auto one_op = initialize<Vector>({one<ValueType>()}, exec);
-        auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
-
-        const auto num_rows = this->get_size()[0];
-        const auto num_rhs = dense_b->get_size()[1];
-        const auto krylov_dim = this->get_krylov_dim();
-        auto residual = Vector::create_with_config_of(dense_b);
-        /* The dimensions {x, y, z} explained for the krylov_bases:
-         * - x: selects the krylov vector (which has krylov_dim + 1 vectors)
-         * - y: selects the (row-)element of said krylov vector
-         * - z: selects which column-element of said krylov vector should be
-         *      used
-         */
-        const dim<3> krylov_bases_dim{krylov_dim + 1, num_rows, num_rhs};
         Range3dHelper helper(exec, krylov_bases_dim);
         auto krylov_bases_range = helper.get_range();
 
-        auto next_krylov_basis = Vector::create_with_config_of(dense_b);
-        std::shared_ptr<matrix::Dense<ValueType>> preconditioned_vector =
-            Vector::create_with_config_of(dense_b);
-        auto hessenberg =
-            Vector::create(exec, dim<2>{krylov_dim + 1, krylov_dim * num_rhs});
-        auto buffer = Vector::create(exec, dim<2>{krylov_dim + 1, num_rhs});
-        auto givens_sin = Vector::create(exec, dim<2>{krylov_dim, num_rhs});
-        auto givens_cos = Vector::create(exec, dim<2>{krylov_dim, num_rhs});
-        auto residual_norm_collection =
-            Vector::create(exec, dim<2>{krylov_dim + 1, num_rhs});
-        auto residual_norm = VectorNorms::create(exec, dim<2>{1, num_rhs});
-        // 1st row of arnoldi_norm: == eta * norm2(old_next_krylov_basis)
-        //                          with eta == 1 / sqrt(2)
-        //                          (computed right before updating
-        //                          next_krylov_basis)
-        // 2nd row of arnoldi_norm: The actual arnoldi norm
-        //                          == norm2(next_krylov_basis)
-        // 3rd row of arnoldi_norm: the infinity norm of next_krylov_basis
-        //                          (ONLY when using a scalar accessor)
-        auto arnoldi_norm = VectorNorms::create(exec, dim<2>{3, num_rhs});
-        array<size_type> final_iter_nums(this->get_executor(), num_rhs);
-        auto y = Vector::create(exec, dim<2>{krylov_dim, num_rhs});
-
-        bool one_changed{};
-        array<char> reduction_tmp{this->get_executor()};
-        array<stopping_status> stop_status(this->get_executor(), num_rhs);
-        // reorth_status and num_reorth are both helper variables for GPU
-        // implementations at the moment.
-        // num_reorth := Number of vectors which require a re-orthogonalization
-        // reorth_status := stopping status for the re-orthogonalization,
-        //                  marking which RHS requires one, and which does not
-        array<stopping_status> reorth_status(this->get_executor(), num_rhs);
-        array<size_type> num_reorth(this->get_executor(), 1);
-
-        // Initialization
-        exec->run(cb_gmres::make_initialize(dense_b, residual.get(),
-                                            givens_sin.get(), givens_cos.get(),
-                                            &stop_status, krylov_dim));
-        // residual = dense_b
-        // givens_sin = givens_cos = 0
-        this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, residual);
-        // residual = residual - Ax
+        if (!resume) {
+            // Initialization
+            exec->run(cb_gmres::make_initialize(
+                dense_b, residual.get(), givens_sin.get(), givens_cos.get(),
+                &stop_status, krylov_dim));
+            // residual = dense_b
+            // givens_sin = givens_cos = 0
+            this->get_system_matrix()->apply(neg_one_op, dense_x, one_op,
+                                             residual);
+            // residual = residual - Ax
+        }
 
         exec->run(cb_gmres::make_restart(
             residual.get(), residual_norm.get(), residual_norm_collection.get(),
@@ -296,139 +418,147 @@ void CbGmres<ValueType>::apply_dense_impl(
         // krylov_bases(:, 1) = residual / residual_norm
         // next_krylov_basis = residual / residual_norm
         // final_iter_nums = {0, ..., 0}
+        if (adaptive) {
+            host_cycle_start_norm->copy_from(residual_norm);
+        }
 
-        auto stop_criterion = this->get_stop_criterion_factory()->generate(
-            this->get_system_matrix(),
-            std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x,
-            residual.get());
-
-        int total_iter = -1;
-        size_type restart_iter = 0;
-
-        auto before_preconditioner =
-            matrix::Dense<ValueType>::create_with_config_of(dense_x);
-        auto after_preconditioner =
-            matrix::Dense<ValueType>::create_with_config_of(dense_x);
-
-        array<bool> stop_encountered_rhs(exec->get_master(), num_rhs);
-        array<bool> fully_converged_rhs(exec->get_master(), num_rhs);
-        array<stopping_status> host_stop_status(
-            this->get_executor()->get_master(), stop_status);
-        for (size_type i = 0; i < stop_encountered_rhs.get_size(); ++i) {
-            stop_encountered_rhs.get_data()[i] = false;
-            fully_converged_rhs.get_data()[i] = false;
+        if (!resume) {
+            stop_criterion = this->get_stop_criterion_factory()->generate(
+                this->get_system_matrix(),
+                std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}),
+                dense_x, residual.get());
         }
-        // Start only after this value with performing forced iterations after
-        // convergence detection
-        constexpr int start_force_reset{10};
-        bool perform_reset{false};
-        // Fraction of the krylov_dim (or total_iter if it is lower),
-        // determining the number of forced iteration to perform
-        constexpr size_type forced_iteration_fraction{10};
-        const size_type forced_limit{krylov_dim / forced_iteration_fraction};
-        // Counter for the forced iterations. Start at max in order to properly
-        // test convergence at the beginning
-        size_type forced_iterations{forced_limit};
 
         while (true) {
-            ++total_iter;
-            // In the beginning, only force a fraction of the total iterations
-            if (forced_iterations < forced_limit &&
-                forced_iterations < total_iter / forced_iteration_fraction) {
-                this->template log<log::Logger::iteration_complete>(
-                    this, dense_b, dense_x, total_iter, residual.get(),
-                    residual_norm.get(), nullptr, &stop_status, false);
-                ++forced_iterations;
-            } else {
-                bool all_changed = stop_criterion->update()
-                                       .num_iterations(total_iter)
-                                       .residual(residual)
-                                       .residual_norm(residual_norm)
-                                       .solution(dense_x)
-                                       .check(RelativeStoppingId, true,
-                                              &stop_status, &one_changed);
-                this->template log<log::Logger::iteration_complete>(
-                    this, dense_b, dense_x, total_iter, residual.get(),
-                    residual_norm.get(), nullptr, &stop_status, all_changed);
-                if (one_changed || all_changed) {
-                    host_stop_status = stop_status;
-                    bool host_array_changed{false};
-                    for (size_type i = 0; i < host_stop_status.get_size();
-                         ++i) {
-                        auto local_status = host_stop_status.get_data() + i;
-                        // Ignore all actually converged ones!
-                        if (fully_converged_rhs.get_data()[i]) {
-                            continue;
-                        }
-                        if (local_status->has_converged()) {
-                            // If convergence was detected earlier, or
-                            // at the very beginning:
-                            if (stop_encountered_rhs.get_data()[i] ||
-                                total_iter < start_force_reset) {
-                                fully_converged_rhs.get_data()[i] = true;
-                            } else {
-                                stop_encountered_rhs.get_data()[i] = true;
-                                local_status->reset();
-                                host_array_changed = true;
+            // A resumed stage continues with the Arnoldi step of the
+            // iteration in which the previous stage stopped
+            if (!resume) {
+                ++total_iter;
+                // In the beginning, only force a fraction of the total
+                // iterations
+                if (forced_iterations < forced_limit &&
+                    forced_iterations <
+                        total_iter / forced_iteration_fraction) {
+                    this->template log<log::Logger::iteration_complete>(
+                        this, dense_b, dense_x, total_iter, residual.get(),
+                        residual_norm.get(), nullptr, &stop_status, false);
+                    ++forced_iterations;
+                } else {
+                    bool all_changed = stop_criterion->update()
+                                           .num_iterations(total_iter)
+                                           .residual(residual)
+                                           .residual_norm(residual_norm)
+                                           .solution(dense_x)
+                                           .check(RelativeStoppingId, true,
+                                                  &stop_status, &one_changed);
+                    this->template log<log::Logger::iteration_complete>(
+                        this, dense_b, dense_x, total_iter, residual.get(),
+                        residual_norm.get(), nullptr, &stop_status,
+                        all_changed);
+                    if (one_changed || all_changed) {
+                        host_stop_status = stop_status;
+                        bool host_array_changed{false};
+                        for (size_type i = 0; i < host_stop_status.get_size();
+                             ++i) {
+                            auto local_status = host_stop_status.get_data() + i;
+                            // Ignore all actually converged ones!
+                            if (fully_converged_rhs.get_data()[i]) {
+                                continue;
+                            }
+                            if (local_status->has_converged()) {
+                                // If convergence was detected earlier, or
+                                // at the very beginning:
+                                if (stop_encountered_rhs.get_data()[i] ||
+                                    total_iter < start_force_reset) {
+                                    fully_converged_rhs.get_data()[i] = true;
+                                } else {
+                                    stop_encountered_rhs.get_data()[i] = true;
+                                    local_status->reset();
+                                    host_array_changed = true;
+                                }
                             }
                         }
-                    }
-                    if (host_array_changed) {
-                        perform_reset = true;
-                        stop_status = host_stop_status;
+                        if (host_array_changed) {
+                            perform_reset = true;
+                            stop_status = host_stop_status;
+                        } else {
+                            // Stop here can happen if all RHS are
+                            // "fully_converged" or if it was stopped for
+                            // non-convergence reason (like time or iteration)
+                            break;
+                        }
+                        forced_iterations = 0;
+
                     } else {
-                        // Stop here can happen if all RHS are "fully_converged"
-                        // or if it was stopped for non-convergence reason
-                        // (like time or iteration)
-                        break;
+                        for (size_type i = 0;
+                             i < stop_encountered_rhs.get_size(); ++i) {
+                            stop_encountered_rhs.get_data()[i] = false;
+                        }
                     }
-                    forced_iterations = 0;
+                }
 
-                } else {
-                    for (size_type i = 0; i < stop_encountered_rhs.get_size();
-                         ++i) {
-                        stop_encountered_rhs.get_data()[i] = false;
+                if (perform_reset || restart_iter == krylov_dim) {
+                    const bool full_cycle = restart_iter == krylov_dim;
+                    perform_reset = false;
+                    // Restart
+                    // use a view in case this is called earlier
+                    auto hessenberg_view = hessenberg->create_submatrix(
+                        span{0, restart_iter},
+                        span{0, num_rhs * (restart_iter)});
+
+                    exec->run(cb_gmres::make_solve_krylov(
+                        residual_norm_collection.get(),
+                        krylov_bases_range.get_accessor().to_const(),
+                        hessenberg_view.get(), y.get(),
+                        before_preconditioner.get(), &final_iter_nums));
+                    // Solve upper triangular.
+                    // y = hessenberg \ residual_norm_collection
+
+                    this->get_preconditioner()->apply(before_preconditioner,
+                                                      after_preconditioner);
+                    dense_x->add_scaled(one_op, after_preconditioner);
+                    // Solve x
+                    // x = x + get_preconditioner() * krylov_bases * y
+                    residual->copy_from(dense_b);
+                    // residual = dense_b
+                    this->get_system_matrix()->apply(neg_one_op, dense_x,
+                                                     one_op, residual);
+                    // residual = residual - Ax
+                    if (can_escalate) {
+                        host_implicit_norm->copy_from(residual_norm);
+                    }
+                    exec->run(cb_gmres::make_restart(
+                        residual.get(), residual_norm.get(),
+                        residual_norm_collection.get(), arnoldi_norm.get(),
+                        krylov_bases_range, next_krylov_basis.get(),
+                        &final_iter_nums, reduction_tmp, krylov_dim));
+                    // residual_norm = norm(residual)
+                    // residual_norm_collection = {residual_norm, 0, ..., 0}
+                    // krylov_bases(:, 1) = residual / residual_norm
+                    // next_krylov_basis = residual / residual_norm
+                    // final_iter_nums = {0, ..., 0}
+                    restart_iter = 0;
+                    if (can_escalate) {
+                        host_residual_norm->copy_from(residual_norm);
+                        if (needs_higher_storage_precision(
+                                host_implicit_norm.get(),
+                                host_residual_norm.get(),
+                                host_cycle_start_norm.get(),
+                                fully_converged_rhs, full_cycle,
+                                parameters_.adaptive_residual_gap,
+                                parameters_.adaptive_stagnation_ratio)) {
+                            // the next stage restarts from the current
+                            // residual with a more precise Krylov basis
+                            escalate = true;
+                            return;
+                        }
+                    }
+                    if (adaptive) {
+                        host_cycle_start_norm->copy_from(residual_norm);
                     }
                 }
             }
-
-            if (perform_reset || restart_iter == krylov_dim) {
-                perform_reset = false;
-                // Restart
-                // use a view in case this is called earlier
-                auto hessenberg_view = hessenberg->create_submatrix(
-                    span{0, restart_iter}, span{0, num_rhs * (restart_iter)});
-
-                exec->run(cb_gmres::make_solve_krylov(
-                    residual_norm_collection.get(),
-                    krylov_bases_range.get_accessor().to_const(),
-                    hessenberg_view.get(), y.get(), before_preconditioner.get(),
-                    &final_iter_nums));
-                // Solve upper triangular.
-                // y = hessenberg \ residual_norm_collection
-
-                this->get_preconditioner()->apply(before_preconditioner,
-                                                  after_preconditioner);
-                dense_x->add_scaled(one_op, after_preconditioner);
-                // Solve x
-                // x = x + get_preconditioner() * krylov_bases * y
-                residual->copy_from(dense_b);
-                // residual = dense_b
-                this->get_system_matrix()->apply(neg_one_op, dense_x, one_op,
-                                                 residual);
-                // residual = residual - Ax
-                exec->run(cb_gmres::make_restart(
-                    residual.get(), residual_norm.get(),
-                    residual_norm_collection.get(), arnoldi_norm.get(),
-                    krylov_bases_range, next_krylov_basis.get(),
-                    &final_iter_nums, reduction_tmp, krylov_dim));
-                // residual_norm = norm(residual)
-                // residual_norm_collection = {residual_norm, 0, ..., 0}
-                // krylov_bases(:, 1) = residual / residual_norm
-                // next_krylov_basis = residual / residual_norm
-                // final_iter_nums = {0, ..., 0}
-                restart_iter = 0;
-            }
+            resume = false;
 
             this->get_preconditioner()->apply(next_krylov_basis,
                                               preconditioned_vector);
@@ -496,8 +626,24 @@ void CbGmres<ValueType>::apply_dense_impl(
         // x = x + get_preconditioner() * krylov_bases * y
     };  // End of apply_lambda
 
-    // Look which precision to use as the storage type
-    helper<ValueType>::call(apply_templated, this->get_storage_precision());
+    if (!adaptive) {
+        // Look which precision to use as the storage type
+        helper<ValueType>::call(apply_templated, this->get_storage_precision());
+        return;
+    }
+    const auto precisions = get_adaptive_storage_precisions<ValueType>();
+    for (size_type stage = 0; stage < precisions.size(); ++stage) {
+        this->template log<log::Logger::krylov_storage_precision_selected>(
+            this, static_cast<size_type>(std::max(total_iter, 0)),
+            precisions[stage]);
+        can_escalate = stage + 1 < precisions.size();
+        resume = stage > 0;
+        escalate = false;
+        helper<ValueType>::call(apply_templated, precisions[stage]);
+        if (!escalate) {
+            break;
+        }
+    }
 }
 
 
@@ -12,6 +12,7 @@
 #include <ginkgo/core/base/name_demangling.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
 
 
 #include "core/config/solver_config.hpp"
@@ -29,6 +30,7 @@ namespace {
 GKO_REGISTER_OPERATION(initialize, cg::initialize);
 GKO_REGISTER_OPERATION(step_1, cg::step_1);
 GKO_REGISTER_OPERATION(step_2, cg::step_2);
+GKO_REGISTER_OPERATION(step_2_and_dot, cg::step_2_and_dot);
 
 
 }  // anonymous namespace
@@ -128,6 +130,18 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         this->get_system_matrix(),
         std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
 
+    // Without preconditioner, z = r, so rho = dot(r, r) can be computed in the
+    // same pass that updates r. This saves the preconditioner copy and one dot
+    // product per iteration.
+    const bool fuse_rho =
+        !gko::detail::is_distributed(dense_b) &&
+        dynamic_cast<const matrix::Identity<ValueType>*>(
+            this->get_preconditioner().get());
+    auto precond_r = fuse_rho ? r : z;
+    if (fuse_rho) {
+        r->compute_conj_dot(r, rho, reduction_tmp);
+    }
+
     int iter = -1;
     /* Memory movement summary:
      * 18n * values + matrix/preconditioner storage
@@ -137,12 +151,16 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
      * 1x step 1 (axpy)   3n
      * 1x step 2 (axpys)  6n
      * 1x norm2 residual   n
+     * Without preconditioner, 14n * values + matrix storage:
+     * the preconditioner and the dot(r, z) are fused into step 2
      */
     while (true) {
-        // z = preconditioner * r
-        this->get_preconditioner()->apply(r, z);
-        // rho = dot(r, z)
-        r->compute_conj_dot(z, rho, reduction_tmp);
+        if (!fuse_rho) {
+            // z = preconditioner * r
+            this->get_preconditioner()->apply(r, z);
+            // rho = dot(r, z)
+            r->compute_conj_dot(z, rho, reduction_tmp);
+        }
 
         ++iter;
         bool all_stopped =
@@ -162,8 +180,8 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // tmp = rho / prev_rho
         // p = z + tmp * p
         exec->run(cg::make_step_1(gko::detail::get_local(p),
-                                  gko::detail::get_local(z), rho, prev_rho,
-                                  &stop_status));
+                                  gko::detail::get_local(precond_r), rho,
+                                  prev_rho, &stop_status));
         // q = A * p
         this->get_system_matrix()->apply(p, q);
         // beta = dot(p, q)
@@ -171,10 +189,18 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // tmp = rho / beta
         // x = x + tmp * p
         // r = r - tmp * q
-        exec->run(cg::make_step_2(
-            gko::detail::get_local(dense_x), gko::detail::get_local(r),
-            gko::detail::get_local(p), gko::detail::get_local(q), beta, rho,
-            &stop_status));
+        if (fuse_rho) {
+            // prev_rho = dot(r, r), which becomes rho after the swap
+            exec->run(cg::make_step_2_and_dot(
+                gko::detail::get_local(dense_x), gko::detail::get_local(r),
+                gko::detail::get_local(p), gko::detail::get_local(q), beta,
+                rho, prev_rho, reduction_tmp, &stop_status));
+        } else {
+            exec->run(cg::make_step_2(
+                gko::detail::get_local(dense_x), gko::detail::get_local(r),
+                gko::detail::get_local(p), gko::detail::get_local(q), beta,
+                rho, &stop_status));
+        }
         swap(prev_rho, rho);
     }
 }
@@ -11,6 +11,7 @@
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
 
 
 #include "core/config/solver_config.hpp"
@@ -28,6 +29,7 @@ namespace {
 GKO_REGISTER_OPERATION(initialize, fcg::initialize);
 GKO_REGISTER_OPERATION(step_1, fcg::step_1);
 GKO_REGISTER_OPERATION(step_2, fcg::step_2);
+GKO_REGISTER_OPERATION(step_2_and_dot, fcg::step_2_and_dot);
 
 
 }  // anonymous namespace
@@ -132,6 +134,17 @@ void Fcg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         this->get_system_matrix(),
         std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x, r);
 
+    // Without preconditioner, z = r, so rho = dot(r, r) can be computed in the
+    // same pass that updates r.
+    const bool fuse_rho =
+        !gko::detail::is_distributed(dense_b) &&
+        dynamic_cast<const matrix::Identity<ValueType>*>(
+            this->get_preconditioner().get());
+    auto precond_r = fuse_rho ? r : z;
+    if (fuse_rho) {
+        r->compute_conj_dot(r, rho, reduction_tmp);
+    }
+
     int iter = -1;
     /* Memory movement summary:
      * 21n * values + matrix/preconditioner storage
@@ -141,11 +154,15 @@ void Fcg<ValueType>::apply_dense_impl(const VectorType* dense_b,
      * 1x step 1 (axpy)        3n
      * 1x step 2 (fused axpys) 7n
      * 1x norm2 residual        n
+     * Without preconditioner, 17n * values + matrix storage:
+     * the preconditioner and the dot(r, z) are fused into step 2
      */
     while (true) {
-        this->get_preconditioner()->apply(r, z);
-        r->compute_conj_dot(z, rho, reduction_tmp);
-        t->compute_conj_dot(z, rho_t, reduction_tmp);
+        if (!fuse_rho) {
+            this->get_preconditioner()->apply(r, z);
+            r->compute_conj_dot(z, rho, reduction_tmp);
+        }
+        t->compute_conj_dot(precond_r, rho_t, reduction_tmp);
 
         ++iter;
         bool all_stopped =
@@ -165,7 +182,7 @@ void Fcg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // tmp = rho_t / prev_rho
         // p = z + tmp * p
         exec->run(fcg::make_step_1(
-            gko::detail::get_local(p), gko::detail::get_local(z),
+            gko::detail::get_local(p), gko::detail::get_local(precond_r),
             gko::detail::get_local(rho_t), prev_rho, &stop_status));
         this->get_system_matrix()->apply(p, q);
         p->compute_conj_dot(q, beta, reduction_tmp);
@@ -174,10 +191,19 @@ void Fcg<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // x = x + tmp * p
         // r = r - tmp * q
         // t = r - [prev_r]
-        exec->run(fcg::make_step_2(
-            gko::detail::get_local(dense_x), gko::detail::get_local(r),
-            gko::detail::get_local(t), gko::detail::get_local(p),
-            gko::detail::get_local(q), beta, rho, &stop_status));
+        if (fuse_rho) {
+            // prev_rho = dot(r, r), which becomes rho after the swap
+            exec->run(fcg::make_step_2_and_dot(
+                gko::detail::get_local(dense_x), gko::detail::get_local(r),
+                gko::detail::get_local(t), gko::detail::get_local(p),
+                gko::detail::get_local(q), beta, rho, prev_rho, reduction_tmp,
+                &stop_status));
+        } else {
+            exec->run(fcg::make_step_2(
+                gko::detail::get_local(dense_x), gko::detail::get_local(r),
+                gko::detail::get_local(t), gko::detail::get_local(p),
+                gko::detail::get_local(q), beta, rho, &stop_status));
+        }
         swap(prev_rho, rho);
     }
 }
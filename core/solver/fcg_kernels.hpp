@@ -50,13 +50,25 @@ namespace fcg {
         const array<stopping_status>* stop_status)
 
 
+#define GKO_DECLARE_FCG_STEP_2_AND_DOT_KERNEL(_type)                          \
+    void step_2_and_dot(                                                      \
+        std::shared_ptr<const DefaultExecutor> exec, matrix::Dense<_type>* x, \
+        matrix::Dense<_type>* r, matrix::Dense<_type>* t,                     \
+        const matrix::Dense<_type>* p, const matrix::Dense<_type>* q,         \
+        const matrix::Dense<_type>* beta, const matrix::Dense<_type>* rho,    \
+        matrix::Dense<_type>* new_rho, array<char>& tmp,                      \
+        const array<stopping_status>* stop_status)
+
+
 #define GKO_DECLARE_ALL_AS_TEMPLATES              \
     template <typename ValueType>                 \
     GKO_DECLARE_FCG_INITIALIZE_KERNEL(ValueType); \
     template <typename ValueType>                 \
     GKO_DECLARE_FCG_STEP_1_KERNEL(ValueType);     \
     template <typename ValueType>                 \
-    GKO_DECLARE_FCG_STEP_2_KERNEL(ValueType)
+    GKO_DECLARE_FCG_STEP_2_KERNEL(ValueType);     \
+    template <typename ValueType>                 \
+    GKO_DECLARE_FCG_STEP_2_AND_DOT_KERNEL(ValueType)
 
 
 }  // namespace fcg
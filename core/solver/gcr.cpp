@@ -31,6 +31,7 @@ namespace {
 GKO_REGISTER_OPERATION(initialize, gcr::initialize);
 GKO_REGISTER_OPERATION(restart, gcr::restart);
 GKO_REGISTER_OPERATION(step_1, gcr::step_1);
+GKO_REGISTER_OPERATION(step_1_and_norm, gcr::step_1_and_norm);
 
 
 }  // anonymous namespace
@@ -169,6 +170,13 @@ void Gcr<ValueType>::apply_dense_impl(const VectorType* dense_b,
         std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x,
         residual);
 
+    // the residual norm is computed in the same pass that updates the
+    // residual at the end of the previous iteration
+    const bool fuse_norm = !::gko::detail::is_distributed(dense_b);
+    if (fuse_norm) {
+        residual->compute_norm2(residual_norm, reduction_tmp);
+    }
+
     int total_iter = -1;
     size_type restart_iter = 0;
 
@@ -188,11 +196,14 @@ void Gcr<ValueType>::apply_dense_impl(const VectorType* dense_b,
      *       2x copy                  4n
      * Restart:                   (4/d)n+1/d (every dth iteration)
      *       (2+1)x copy              4n+1
+     * Without distributed vectors, the norm2 is fused into step 1.
      */
     while (true) {
         ++total_iter;
-        // compute residual norm
-        residual->compute_norm2(residual_norm, reduction_tmp);
+        if (!fuse_norm) {
+            // compute residual norm
+            residual->compute_norm2(residual_norm, reduction_tmp);
+        }
 
         // Should the iteration stop?
         auto all_stopped =
@@ -247,12 +258,22 @@ void Gcr<ValueType>::apply_dense_impl(const VectorType* dense_b,
         // alpha = r*Ap / Ap_norm
         // x = x + alpha * p
         // r = r - alpha * Ap
-        exec->run(gcr::make_step_1(::gko::detail::get_local(dense_x),
-                                   ::gko::detail::get_local(residual),
-                                   ::gko::detail::get_local(p.get()),
-                                   ::gko::detail::get_local(Ap.get()),
-                                   Ap_norm.get(), tmp_rAp,
-                                   stop_status.get_const_data()));
+        if (fuse_norm) {
+            // residual_norm = norm2(r)
+            exec->run(gcr::make_step_1_and_norm(
+                ::gko::detail::get_local(dense_x),
+                ::gko::detail::get_local(residual),
+                ::gko::detail::get_local(p.get()),
+                ::gko::detail::get_local(Ap.get()), Ap_norm.get(), tmp_rAp,
+                residual_norm, reduction_tmp, stop_status.get_const_data()));
+        } else {
+            exec->run(gcr::make_step_1(::gko::detail::get_local(dense_x),
+                                       ::gko::detail::get_local(residual),
+                                       ::gko::detail::get_local(p.get()),
+                                       ::gko::detail::get_local(Ap.get()),
+                                       Ap_norm.get(), tmp_rAp,
+                                       stop_status.get_const_data()));
+        }
 
         // apply preconditioner to residual
         this->get_preconditioner()->apply(residual, precon_residual);
@@ -45,13 +45,26 @@ namespace gcr {
                 const stopping_status* stop_status)
 
 
+#define GKO_DECLARE_GCR_STEP_1_AND_NORM_KERNEL(_type)                         \
+    void step_1_and_norm(                                                     \
+        std::shared_ptr<const DefaultExecutor> exec, matrix::Dense<_type>* x, \
+        matrix::Dense<_type>* residual, const matrix::Dense<_type>* p,        \
+        const matrix::Dense<_type>* Ap,                                       \
+        const matrix::Dense<remove_complex<_type>>* Ap_norm,                  \
+        const matrix::Dense<_type>* rAp,                                      \
+        matrix::Dense<remove_complex<_type>>* residual_norm,                  \
+        array<char>& tmp, const stopping_status* stop_status)
+
+
 #define GKO_DECLARE_ALL_AS_TEMPLATES              \
     template <typename ValueType>                 \
     GKO_DECLARE_GCR_INITIALIZE_KERNEL(ValueType); \
     template <typename ValueType>                 \
     GKO_DECLARE_GCR_RESTART_KERNEL(ValueType);    \
     template <typename ValueType>                 \
-    GKO_DECLARE_GCR_STEP_1_KERNEL(ValueType)
+    GKO_DECLARE_GCR_STEP_1_KERNEL(ValueType);     \
+    template <typename ValueType>                 \
+    GKO_DECLARE_GCR_STEP_1_AND_NORM_KERNEL(ValueType)
 
 
 }  // namespace gcr
@@ -16,6 +16,7 @@
 
 #include "core/config/config_helper.hpp"
 #include "core/config/trisolver_config.hpp"
+#include "core/log/work_estimate.hpp"
 #include "core/solver/lower_trs_kernels.hpp"
 
 
@@ -162,10 +163,19 @@ void LowerTrs<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
                 trans_x = this->template create_workspace_op<Vector>(
                     ws::transposed_x, gko::transpose(dense_x->get_size()));
             }
+            const auto system_matrix = this->get_system_matrix();
+            const auto work =
+                log::sparse_apply_work<ValueType, IndexType, ValueType,
+                                       ValueType>(
+                    system_matrix->get_size()[0], system_matrix->get_size()[1],
+                    system_matrix->get_num_stored_elements(),
+                    dense_b->get_size()[1]);
             exec->run(lower_trs::make_solve(
-                this->get_system_matrix().get(), this->solve_struct_.get(),
-                this->get_parameters().unit_diagonal, parameters_.algorithm,
-                trans_b, trans_x, dense_b, dense_x));
+                          system_matrix.get(), this->solve_struct_.get(),
+                          this->get_parameters().unit_diagonal,
+                          parameters_.algorithm, trans_b, trans_x, dense_b,
+                          dense_x),
+                      work.flops, work.bytes);
         },
         b, x);
 }
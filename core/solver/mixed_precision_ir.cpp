@@ -0,0 +1,368 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/mixed_precision_ir.hpp>
+
+
+#include <algorithm>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/gmres.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/config/config_helper.hpp"
+#include "core/solver/ir_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace mixed_precision_ir {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize, ir::initialize);
+
+
+}  // anonymous namespace
+}  // namespace mixed_precision_ir
+
+
+namespace {
+
+
+/**
+ * Converts the source to a Csr matrix in the given precision, if the source
+ * supports this conversion. Returns nullptr otherwise.
+ */
+template <typename TargetValueType, typename IndexType>
+std::shared_ptr<const LinOp> try_convert_to_csr(const LinOp* source)
+{
+    using csr_type = matrix::Csr<TargetValueType, IndexType>;
+    if (auto convertible =
+            dynamic_cast<const ConvertibleTo<csr_type>*>(source)) {
+        auto result = csr_type::create(source->get_executor());
+        convertible->convert_to(result);
+        return result;
+    }
+    return nullptr;
+}
+
+
+/**
+ * Converts the system matrix to InnerValueType. Dense matrices stay dense,
+ * all other matrices are converted to Csr, either directly or via a Csr
+ * matrix in ValueType.
+ */
+template <typename InnerValueType, typename ValueType>
+std::shared_ptr<const LinOp> convert_to_inner_precision(
+    std::shared_ptr<const LinOp> system_matrix)
+{
+    if (std::is_same<InnerValueType, ValueType>::value) {
+        return system_matrix;
+    }
+    using inner_dense = matrix::Dense<InnerValueType>;
+    auto exec = system_matrix->get_executor();
+    if (auto dense = dynamic_cast<const ConvertibleTo<inner_dense>*>(
+            system_matrix.get())) {
+        auto result = inner_dense::create(exec);
+        dense->convert_to(result);
+        return result;
+    }
+    if (auto result =
+            try_convert_to_csr<InnerValueType, int32>(system_matrix.get())) {
+        return result;
+    }
+    if (auto result =
+            try_convert_to_csr<InnerValueType, int64>(system_matrix.get())) {
+        return result;
+    }
+    if (auto csr = try_convert_to_csr<ValueType, int32>(system_matrix.get())) {
+        return try_convert_to_csr<InnerValueType, int32>(csr.get());
+    }
+    if (auto csr = try_convert_to_csr<ValueType, int64>(system_matrix.get())) {
+        return try_convert_to_csr<InnerValueType, int64>(csr.get());
+    }
+    GKO_NOT_SUPPORTED(system_matrix);
+}
+
+
+/**
+ * Returns the solver factory used if none is provided: an unpreconditioned
+ * Gmres in the given precision. Its stopping criteria are replaced before
+ * every solve.
+ */
+template <typename SolverValueType>
+std::shared_ptr<const LinOpFactory> default_solver_factory(
+    std::shared_ptr<const Executor> exec, size_type max_iters)
+{
+    return Gmres<SolverValueType>::build()
+        .with_criteria(stop::Iteration::build().with_max_iters(max_iters))
+        .on(exec);
+}
+
+
+/**
+ * Replaces the stopping criteria of an iterative solver by a residual norm
+ * reduction relative to the right-hand side and an iteration limit. Other
+ * solvers are left unchanged.
+ */
+template <typename SolverValueType>
+void set_solve_criteria(LinOp* solver, double reduction_factor,
+                        size_type max_iters)
+{
+    if (auto iterative = dynamic_cast<IterativeBase*>(solver)) {
+        auto exec = solver->get_executor();
+        iterative->set_stop_criterion_factory(stop::combine(
+            std::vector<std::shared_ptr<const stop::CriterionFactory>>{
+                stop::Iteration::build().with_max_iters(max_iters).on(exec),
+                stop::ResidualNorm<SolverValueType>::build()
+                    .with_baseline(stop::mode::rhs_norm)
+                    .with_reduction_factor(
+                        static_cast<remove_complex<SolverValueType>>(
+                            reduction_factor))
+                    .on(exec)}));
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType>
+typename MixedPrecisionIr<ValueType>::parameters_type
+MixedPrecisionIr<ValueType>::parse(const config::pnode& config,
+                                   const config::registry& context,
+                                   const config::type_descriptor& td_for_child)
+{
+    auto params = solver::MixedPrecisionIr<ValueType>::build();
+    if (auto& obj = config.get("criteria")) {
+        params.with_criteria(
+            gko::config::parse_or_get_factory_vector<
+                const stop::CriterionFactory>(obj, context, td_for_child));
+    }
+    if (auto& obj = config.get("solver")) {
+        // the inner solver operates in the inner precision
+        const config::type_descriptor td_for_inner{
+            config::make_type_descriptor<inner_value_type>()
+                .get_value_typestr(),
+            td_for_child.get_index_typestr()};
+        params.with_solver(
+            gko::config::parse_or_get_factory<const LinOpFactory>(
+                obj, context, td_for_inner));
+    }
+    if (auto& obj = config.get("fallback_solver")) {
+        params.with_fallback_solver(
+            gko::config::parse_or_get_factory<const LinOpFactory>(
+                obj, context, td_for_child));
+    }
+    if (auto& obj = config.get("max_inner_iterations")) {
+        params.with_max_inner_iterations(
+            gko::config::get_value<size_type>(obj));
+    }
+    if (auto& obj = config.get("inner_reduction_factor")) {
+        params.with_inner_reduction_factor(
+            gko::config::get_value<double>(obj));
+    }
+    if (auto& obj = config.get("min_inner_reduction_factor")) {
+        params.with_min_inner_reduction_factor(
+            gko::config::get_value<double>(obj));
+    }
+    if (auto& obj = config.get("stagnation_ratio")) {
+        params.with_stagnation_ratio(gko::config::get_value<double>(obj));
+    }
+    return params;
+}
+
+
+template <typename ValueType>
+MixedPrecisionIr<ValueType>::MixedPrecisionIr(
+    const Factory* factory, std::shared_ptr<const LinOp> system_matrix)
+    : EnableLinOp<MixedPrecisionIr>(factory->get_executor(),
+                                    gko::transpose(system_matrix->get_size())),
+      EnableSolverBase<MixedPrecisionIr>{std::move(system_matrix)},
+      EnableIterativeBase<MixedPrecisionIr>{
+          stop::combine(factory->get_parameters().criteria)},
+      parameters_{factory->get_parameters()}
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(this->get_system_matrix());
+    auto exec = this->get_executor();
+    inner_system_matrix_ =
+        convert_to_inner_precision<inner_value_type, ValueType>(
+            this->get_system_matrix());
+    auto inner_factory =
+        parameters_.solver
+            ? parameters_.solver
+            : default_solver_factory<inner_value_type>(
+                  exec, parameters_.max_inner_iterations);
+    inner_solver_ = inner_factory->generate(inner_system_matrix_);
+    GKO_ASSERT_EQUAL_DIMENSIONS(inner_solver_, this);
+}
+
+
+template <typename ValueType>
+void MixedPrecisionIr<ValueType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_dense_impl(dense_b, dense_x);
+        },
+        b, x);
+}
+
+
+template <typename ValueType>
+void MixedPrecisionIr<ValueType>::apply_dense_impl(
+    const matrix::Dense<ValueType>* dense_b,
+    matrix::Dense<ValueType>* dense_x) const
+{
+    using Vector = matrix::Dense<ValueType>;
+    using InnerVector = matrix::Dense<inner_value_type>;
+    using NormVector = matrix::Dense<remove_complex<ValueType>>;
+    constexpr uint8 relative_stopping_id{1};
+
+    auto exec = this->get_executor();
+    const auto num_rhs = dense_b->get_size()[1];
+
+    auto one_op = initialize<Vector>({one<ValueType>()}, exec);
+    auto neg_one_op = initialize<Vector>({-one<ValueType>()}, exec);
+    auto residual = Vector::create_with_config_of(dense_b);
+    auto correction = Vector::create_with_config_of(dense_b);
+    auto inner_residual = InnerVector::create(exec, dense_b->get_size());
+    auto inner_solution = InnerVector::create(exec, dense_b->get_size());
+    auto residual_norm = NormVector::create(exec, dim<2>{1, num_rhs});
+    auto host_residual_norm =
+        NormVector::create(exec->get_master(), dim<2>{1, num_rhs});
+    auto host_previous_norm =
+        NormVector::create(exec->get_master(), dim<2>{1, num_rhs});
+
+    bool one_changed{};
+    array<stopping_status> stop_status(exec, num_rhs);
+    array<stopping_status> host_stop_status(exec->get_master(), num_rhs);
+    exec->run(mixed_precision_ir::make_initialize(&stop_status));
+
+    residual->copy_from(dense_b);
+    this->get_system_matrix()->apply(neg_one_op, dense_x, one_op, residual);
+
+    auto stop_criterion = this->get_stop_criterion_factory()->generate(
+        this->get_system_matrix(),
+        std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x,
+        residual.get());
+
+    auto inner_reduction = parameters_.inner_reduction_factor;
+    bool stagnated{false};
+    int iter = -1;
+    while (true) {
+        ++iter;
+        if (iter > 0) {
+            // residual = b - A * x
+            residual->copy_from(dense_b);
+            this->get_system_matrix()->apply(neg_one_op, dense_x, one_op,
+                                             residual);
+        }
+        residual->compute_norm2(residual_norm);
+        bool all_stopped = stop_criterion->update()
+                               .num_iterations(iter)
+                               .residual(residual)
+                               .residual_norm(residual_norm)
+                               .solution(dense_x)
+                               .check(relative_stopping_id, true,
+                                      &stop_status, &one_changed);
+        this->template log<log::Logger::iteration_complete>(
+            this, dense_b, dense_x, iter, residual.get(), residual_norm.get(),
+            nullptr, &stop_status, all_stopped);
+        if (all_stopped) {
+            break;
+        }
+
+        host_residual_norm->copy_from(residual_norm);
+        if (iter > 0) {
+            // the slowest converging right-hand side determines the rate
+            host_stop_status = stop_status;
+            double rate{};
+            for (size_type i = 0; i < num_rhs; ++i) {
+                const auto previous = host_previous_norm->at(0, i);
+                if (!host_stop_status.get_const_data()[i].has_stopped() &&
+                    previous > zero<remove_complex<ValueType>>()) {
+                    const auto ratio = host_residual_norm->at(0, i) / previous;
+                    rate = std::max(rate, static_cast<double>(ratio));
+                }
+            }
+            if (rate > parameters_.stagnation_ratio) {
+                stagnated = true;
+            }
+            inner_reduction = std::min(
+                std::max(0.9 * rate * rate,
+                         parameters_.min_inner_reduction_factor),
+                parameters_.inner_reduction_factor);
+        }
+        std::swap(host_residual_norm, host_previous_norm);
+
+        if (stagnated) {
+            // the inner precision does not suffice anymore, continue in
+            // ValueType
+            if (!fallback_solver_) {
+                auto fallback_factory =
+                    parameters_.fallback_solver
+                        ? parameters_.fallback_solver
+                        : default_solver_factory<ValueType>(
+                              exec, parameters_.max_inner_iterations);
+                fallback_solver_ =
+                    fallback_factory->generate(this->get_system_matrix());
+            }
+            set_solve_criteria<ValueType>(fallback_solver_.get(),
+                                          inner_reduction,
+                                          parameters_.max_inner_iterations);
+            correction->fill(zero<ValueType>());
+            fallback_solver_->apply(residual, correction);
+        } else {
+            set_solve_criteria<inner_value_type>(
+                inner_solver_.get(), inner_reduction,
+                parameters_.max_inner_iterations);
+            residual->convert_to(inner_residual);
+            inner_solution->fill(zero<inner_value_type>());
+            inner_solver_->apply(inner_residual, inner_solution);
+            inner_solution->convert_to(correction);
+        }
+        // x = x + correction
+        dense_x->add_scaled(one_op, correction);
+    }
+}
+
+
+template <typename ValueType>
+void MixedPrecisionIr<ValueType>::apply_impl(const LinOp* alpha,
+                                             const LinOp* b,
+                                             const LinOp* beta,
+                                             LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_dense_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+#define GKO_DECLARE_MIXED_PRECISION_IR(_type) class MixedPrecisionIr<_type>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_MIXED_PRECISION_IR);
+
+
+}  // namespace solver
+}  // namespace gko
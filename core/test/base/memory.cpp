@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/base/memory.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/record.hpp>
+
+
+namespace {
+
+
+struct CountingAllocator : gko::CpuAllocator {
+    void* allocate(gko::size_type num_bytes) override
+    {
+        num_allocations++;
+        return CpuAllocator::allocate(num_bytes);
+    }
+
+    void deallocate(void* ptr) override
+    {
+        num_deallocations++;
+        CpuAllocator::deallocate(ptr);
+    }
+
+    int num_allocations = 0;
+    int num_deallocations = 0;
+};
+
+
+class CachingCpuAllocator : public ::testing::Test {
+protected:
+    CachingCpuAllocator()
+        : upstream{std::make_shared<CountingAllocator>()},
+          alloc{std::make_shared<gko::CachingCpuAllocator>(
+              4096, 1024, upstream)}
+    {}
+
+    std::shared_ptr<CountingAllocator> upstream;
+    std::shared_ptr<gko::CachingCpuAllocator> alloc;
+};
+
+
+TEST_F(CachingCpuAllocator, ReusesFreedBlock)
+{
+    auto ptr = alloc->allocate(100);
+    alloc->deallocate(ptr);
+
+    auto ptr2 = alloc->allocate(200);
+
+    ASSERT_EQ(ptr, ptr2);
+    ASSERT_EQ(upstream->num_allocations, 1);
+    auto stats = alloc->get_statistics();
+    ASSERT_EQ(stats.num_hits, 1);
+    ASSERT_EQ(stats.num_misses, 1);
+    ASSERT_EQ(stats.used_bytes, 256);
+    ASSERT_EQ(stats.cached_bytes, 0);
+    alloc->deallocate(ptr2);
+}
+
+
+TEST_F(CachingCpuAllocator, SeparatesSizeClasses)
+{
+    auto ptr = alloc->allocate(100);
+    alloc->deallocate(ptr);
+
+    auto ptr2 = alloc->allocate(300);
+
+    ASSERT_NE(ptr, ptr2);
+    ASSERT_EQ(upstream->num_allocations, 2);
+    ASSERT_EQ(alloc->get_statistics().cached_bytes, 256);
+    alloc->deallocate(ptr2);
+}
+
+
+TEST_F(CachingCpuAllocator, DoesNotCacheLargeBlocks)
+{
+    auto ptr = alloc->allocate(2000);
+    alloc->deallocate(ptr);
+
+    ASSERT_EQ(upstream->num_deallocations, 1);
+    ASSERT_EQ(alloc->get_statistics().cached_bytes, 0);
+}
+
+
+TEST_F(CachingCpuAllocator, RespectsRetentionLimit)
+{
+    void* ptrs[5];
+    for (auto& ptr : ptrs) {
+        ptr = alloc->allocate(1024);
+    }
+
+    for (auto ptr : ptrs) {
+        alloc->deallocate(ptr);
+    }
+
+    ASSERT_EQ(alloc->get_statistics().cached_bytes, 4096);
+    ASSERT_EQ(upstream->num_deallocations, 1);
+}
+
+
+TEST_F(CachingCpuAllocator, TrimsCache)
+{
+    auto ptr = alloc->allocate(1024);
+    auto ptr2 = alloc->allocate(256);
+    alloc->deallocate(ptr);
+    alloc->deallocate(ptr2);
+
+    alloc->trim(256);
+
+    ASSERT_EQ(alloc->get_statistics().cached_bytes, 256);
+    ASSERT_EQ(upstream->num_deallocations, 1);
+    alloc->trim();
+    ASSERT_EQ(alloc->get_statistics().cached_bytes, 0);
+    ASSERT_EQ(upstream->num_deallocations, 2);
+}
+
+
+TEST_F(CachingCpuAllocator, LogsAllocations)
+{
+    auto logger = gko::share(gko::log::Record::create());
+    alloc->add_logger(logger);
+
+    alloc->deallocate(alloc->allocate(100));
+    alloc->deallocate(alloc->allocate(100));
+
+    auto& data = logger->get().cached_allocation_completed;
+    ASSERT_EQ(data.size(), 2);
+    ASSERT_EQ(data[0]->allocator, alloc.get());
+    ASSERT_EQ(data[0]->num_bytes, 100);
+    ASSERT_FALSE(data[0]->cache_hit);
+    ASSERT_TRUE(data[1]->cache_hit);
+}
+
+
+TEST_F(CachingCpuAllocator, WorksWithExecutor)
+{
+    auto exec = gko::ReferenceExecutor::create(alloc);
+
+    { gko::array<double> array(exec, 100); }
+    { gko::array<double> array(exec, 120); }
+
+    ASSERT_EQ(upstream->num_allocations, 1);
+    ASSERT_EQ(alloc->get_statistics().num_hits, 1);
+}
+
+
+}  // namespace
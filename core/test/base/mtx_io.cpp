@@ -5,16 +5,22 @@
 #include <ginkgo/core/base/mtx_io.hpp>
 
 
+#include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <sstream>
+#include <string>
+#include <vector>
 
 
 #include <gtest/gtest.h>
 
 
+#include <ginkgo/core/base/device_matrix_data.hpp>
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
 #include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
 
@@ -648,6 +654,351 @@ TEST(MtxReader, FailsWhenReadingSparseComplexMtxToRealMtx)
 }
 
 
+class TemporaryFile {
+public:
+    TemporaryFile(const std::string& contents)
+        : filename_{"mtx_io_test_file"}
+    {
+        std::ofstream os(filename_, std::ios::binary);
+        os << contents;
+    }
+
+    ~TemporaryFile() { std::remove(filename_.c_str()); }
+
+    const std::string& get_name() const { return filename_; }
+
+private:
+    std::string filename_;
+};
+
+
+std::string generate_coordinate_mtx(int size)
+{
+    std::ostringstream oss;
+    oss << "%%MatrixMarket matrix coordinate real general\n"
+        << "% a comment\n"
+        << size << ' ' << size << ' ' << 3 * size - 2 << '\n';
+    // write the entries in reverse order to test the sorting
+    for (int row = size; row > 0; row--) {
+        for (int col = std::min(row + 1, size); col >= std::max(row - 1, 1);
+             col--) {
+            oss << row << ' ' << col << "  " << row * 0.5 - col << '\n';
+        }
+    }
+    return oss.str();
+}
+
+
+TEST(MtxReader, ReadsMtxInParallel)
+{
+    TemporaryFile file(generate_coordinate_mtx(5000));
+    std::ifstream is(file.get_name());
+    auto expected = gko::read_raw<double, gko::int32>(is);
+
+    auto data = gko::read_raw_parallel<double, gko::int32>(file.get_name(), 3);
+
+    ASSERT_EQ(data.size, expected.size);
+    ASSERT_EQ(data.nonzeros, expected.nonzeros);
+}
+
+
+TEST(MtxReader, ReadsSymmetricComplexMtxInParallel)
+{
+    using cpx = std::complex<double>;
+    using tpl = gko::matrix_data<cpx, gko::int64>::nonzero_type;
+    TemporaryFile file(
+        "%%MatrixMarket matrix coordinate complex symmetric\n"
+        "3 3 4\n"
+        "1 1 1.0 2.0\n"
+        "\n"
+        "3 1 5.0 3.0\n"
+        "% a comment\n"
+        "2 2 3.0 1.0\n"
+        "3 3 2.0 4.0\n");
+
+    auto data = gko::read_raw_parallel<cpx, gko::int64>(file.get_name(), 2);
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 3));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v.size(), 5);
+    ASSERT_EQ(v[0], tpl(0, 0, cpx(1.0, 2.0)));
+    ASSERT_EQ(v[1], tpl(0, 2, cpx(5.0, 3.0)));
+    ASSERT_EQ(v[2], tpl(1, 1, cpx(3.0, 1.0)));
+    ASSERT_EQ(v[3], tpl(2, 0, cpx(5.0, 3.0)));
+    ASSERT_EQ(v[4], tpl(2, 2, cpx(2.0, 4.0)));
+}
+
+
+TEST(MtxReader, ReadsArrayMtxInParallel)
+{
+    using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
+    TemporaryFile file(
+        "%%MatrixMarket matrix array real general\n"
+        "2 2\n"
+        "1.0\n"
+        "0.0\n"
+        "3.0\n"
+        "5.0\n");
+
+    auto data =
+        gko::read_generic_raw_parallel<double, gko::int32>(file.get_name(), 2);
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 2));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v[0], tpl(0, 0, 1.0));
+    ASSERT_EQ(v[1], tpl(0, 1, 3.0));
+    ASSERT_EQ(v[2], tpl(1, 0, 0.0));
+    ASSERT_EQ(v[3], tpl(1, 1, 5.0));
+}
+
+
+TEST(MtxReader, FailsWhenParallelReadFindsWrongEntryCount)
+{
+    TemporaryFile file(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 2 3\n"
+        "1 1 1.0\n"
+        "2 2 5.0\n");
+
+    ASSERT_THROW((gko::read_raw_parallel<double, gko::int32>(file.get_name(),
+                                                             2)),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenParallelReadingComplexMtxToRealMtx)
+{
+    TemporaryFile file(
+        "%%MatrixMarket matrix coordinate complex general\n"
+        "1 1 1\n"
+        "1 1 1.0 2.0\n");
+
+    ASSERT_THROW((gko::read_raw_parallel<double, gko::int32>(file.get_name())),
+                 gko::StreamError);
+}
+
+
+const char* symmetric_coordinate_mtx =
+    "%%MatrixMarket matrix coordinate real symmetric\n"
+    "3 3 4\n"
+    "3 1 5.0\n"
+    "1 1 1.0\n"
+    "3 3 2.0\n"
+    "2 1 3.0\n";
+
+
+TEST(MtxReader, ReadsMtxInChunks)
+{
+    std::istringstream iss(symmetric_coordinate_mtx);
+    std::vector<gko::size_type> chunk_sizes;
+    gko::matrix_data<double, gko::int32> data;
+
+    gko::read_raw_chunked<double, gko::int32>(
+        iss, gko::ReferenceExecutor::create(), 3,
+        [&](const gko::device_matrix_data<double, gko::int32>& chunk) {
+            ASSERT_EQ(chunk.get_size(), gko::dim<2>(3, 3));
+            chunk_sizes.push_back(chunk.get_num_stored_elements());
+            auto host_chunk = chunk.copy_to_host();
+            data.nonzeros.insert(data.nonzeros.end(),
+                                 host_chunk.nonzeros.begin(),
+                                 host_chunk.nonzeros.end());
+        });
+
+    iss.clear();
+    iss.str(symmetric_coordinate_mtx);
+    auto expected = gko::read_raw<double, gko::int32>(iss);
+    data.sort_row_major();
+    ASSERT_EQ(chunk_sizes, std::vector<gko::size_type>({2, 2, 2}));
+    ASSERT_EQ(data.nonzeros, expected.nonzeros);
+}
+
+
+TEST(MtxReader, ReadsDeviceMatrixData)
+{
+    std::istringstream iss(symmetric_coordinate_mtx);
+
+    auto data = gko::read_device_raw<double, gko::int32>(
+        gko::ReferenceExecutor::create(), iss, 2);
+
+    iss.clear();
+    iss.str(symmetric_coordinate_mtx);
+    auto expected = gko::read_raw<double, gko::int32>(iss);
+    ASSERT_EQ(data.get_size(), expected.size);
+    ASSERT_EQ(data.copy_to_host().nonzeros, expected.nonzeros);
+}
+
+
+TEST(MtxReader, ReadsArrayMtxAsDeviceMatrixData)
+{
+    using tpl = gko::matrix_data<double, gko::int32>::nonzero_type;
+    std::istringstream iss(
+        "%%MatrixMarket matrix array real general\n"
+        "2 2\n"
+        "1.0\n"
+        "0.0\n"
+        "3.0\n"
+        "5.0\n");
+
+    auto data = gko::read_device_raw<double, gko::int32>(
+                    gko::ReferenceExecutor::create(), iss, 3)
+                    .copy_to_host();
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 2));
+    auto& v = data.nonzeros;
+    ASSERT_EQ(v[0], tpl(0, 0, 1.0));
+    ASSERT_EQ(v[1], tpl(0, 1, 3.0));
+    ASSERT_EQ(v[2], tpl(1, 0, 0.0));
+    ASSERT_EQ(v[3], tpl(1, 1, 5.0));
+}
+
+
+TEST(MtxReader, ReadsCsrInTwoPasses)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    std::istringstream iss(symmetric_coordinate_mtx);
+
+    auto mtx = gko::read_csr<double, gko::int32>(exec, iss, 2);
+
+    iss.clear();
+    iss.str(symmetric_coordinate_mtx);
+    auto expected = gko::read<gko::matrix::Csr<double, gko::int32>>(iss, exec);
+    GKO_ASSERT_MTX_NEAR(mtx, expected, 0.0);
+    ASSERT_TRUE(mtx->is_sorted_by_column_index());
+}
+
+
+TEST(MtxReader, FailsWhenReadingCsrWithRowOutOfBounds)
+{
+    std::istringstream iss(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "2 2 1\n"
+        "3 1 1.0\n");
+
+    ASSERT_THROW((gko::read_csr<double, gko::int32>(
+                     gko::ReferenceExecutor::create(), iss)),
+                 gko::StreamError);
+}
+
+
+std::string write_binary_csr_to_string(
+    const gko::matrix::Csr<double, gko::int32>* mtx)
+{
+    std::ostringstream oss;
+    gko::write_binary_csr(oss, mtx);
+    return oss.str();
+}
+
+
+std::unique_ptr<gko::matrix::Csr<double, gko::int32>> create_csr_example()
+{
+    // clang-format off
+    return gko::initialize<gko::matrix::Csr<double, gko::int32>>(
+        {{1.0, 0.0, 2.0},
+         {0.0, 0.0, 0.0},
+         {0.0, 3.5, -1.0}},
+        gko::ReferenceExecutor::create());
+    // clang-format on
+}
+
+
+TEST(MtxReader, WritesAlignedBinaryCsr)
+{
+    auto mtx = create_csr_example();
+
+    auto data = write_binary_csr_to_string(mtx.get());
+
+    // header, row pointers, column indices and values aligned to 64 bytes
+    ASSERT_EQ(data.size(), 64 + 64 + 64 + 4 * sizeof(double));
+    ASSERT_EQ(data.substr(0, 6), "GKOCSR");
+    gko::int32 row_ptrs[4];
+    gko::int32 col_idxs[4];
+    double values[4];
+    std::memcpy(row_ptrs, &data[64], sizeof(row_ptrs));
+    std::memcpy(col_idxs, &data[128], sizeof(col_idxs));
+    std::memcpy(values, &data[192], sizeof(values));
+    ASSERT_EQ(row_ptrs[2], 2);
+    ASSERT_EQ(col_idxs[2], 1);
+    ASSERT_EQ(values[3], -1.0);
+}
+
+
+TEST(MtxReader, ReadsBinaryCsr)
+{
+    auto mtx = create_csr_example();
+    TemporaryFile file(write_binary_csr_to_string(mtx.get()));
+
+    auto result = gko::read_binary_csr<double, gko::int32>(
+        gko::ReferenceExecutor::create(), file.get_name());
+
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+}
+
+
+TEST(MtxReader, ModifyingReadBinaryCsrKeepsFile)
+{
+    auto mtx = create_csr_example();
+    TemporaryFile file(write_binary_csr_to_string(mtx.get()));
+    auto result = gko::read_binary_csr<double, gko::int32>(
+        gko::ReferenceExecutor::create(), file.get_name());
+
+    result->get_values()[0] = 5.0;
+
+    auto result2 = gko::read_binary_csr<double, gko::int32>(
+        gko::ReferenceExecutor::create(), file.get_name());
+    GKO_ASSERT_MTX_NEAR(result2, mtx, 0.0);
+}
+
+
+TEST(MtxReader, ReadsBinaryCsrWithConversion)
+{
+    auto mtx = create_csr_example();
+    TemporaryFile file(write_binary_csr_to_string(mtx.get()));
+
+    auto result = gko::read_binary_csr<std::complex<float>, gko::int64>(
+        gko::ReferenceExecutor::create(), file.get_name());
+
+    GKO_ASSERT_MTX_NEAR(result, mtx, 0.0);
+}
+
+
+TEST(MtxReader, FailsWhenReadingComplexBinaryCsrToRealCsr)
+{
+    auto mtx = gko::matrix::Csr<std::complex<double>, gko::int32>::create(
+        gko::ReferenceExecutor::create());
+    std::ostringstream oss;
+    gko::write_binary_csr(oss, mtx.get());
+    TemporaryFile file(oss.str());
+
+    ASSERT_THROW((gko::read_binary_csr<double, gko::int32>(
+                     gko::ReferenceExecutor::create(), file.get_name())),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingTruncatedBinaryCsr)
+{
+    auto mtx = create_csr_example();
+    TemporaryFile file(write_binary_csr_to_string(mtx.get()).substr(0, 200));
+
+    ASSERT_THROW((gko::read_binary_csr<double, gko::int32>(
+                     gko::ReferenceExecutor::create(), file.get_name())),
+                 gko::StreamError);
+}
+
+
+TEST(MtxReader, FailsWhenReadingCooBinaryAsBinaryCsr)
+{
+    gko::matrix_data<double, gko::int32> data{{1.0, 2.0}, {3.0, 4.0}};
+    std::ostringstream oss;
+    gko::write_binary_raw(oss, data);
+    TemporaryFile file(oss.str() + std::string(64, '\0'));
+
+    ASSERT_THROW((gko::read_binary_csr<double, gko::int32>(
+                     gko::ReferenceExecutor::create(), file.get_name())),
+                 gko::StreamError);
+}
+
+
 TEST(MatrixData, WritesDoubleRealMatrixToMatrixMarketArray)
 {
     // clang-format off
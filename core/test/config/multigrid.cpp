@@ -57,6 +57,10 @@ struct Pgm : MultigridLevelConfigTest<gko::multigrid::Pgm<float, int>,
         param.with_deterministic(true);
         config_map["skip_sorting"] = pnode{true};
         param.with_skip_sorting(true);
+        config_map["agglomeration_threshold"] = pnode{16};
+        param.with_agglomeration_threshold(16u);
+        config_map["cross_rank_aggregates"] = pnode{true};
+        param.with_cross_rank_aggregates(true);
     }
 
     template <typename AnswerType>
@@ -70,6 +74,10 @@ struct Pgm : MultigridLevelConfigTest<gko::multigrid::Pgm<float, int>,
                   ans_param.max_unassigned_ratio);
         ASSERT_EQ(res_param.deterministic, ans_param.deterministic);
         ASSERT_EQ(res_param.skip_sorting, ans_param.skip_sorting);
+        ASSERT_EQ(res_param.agglomeration_threshold,
+                  ans_param.agglomeration_threshold);
+        ASSERT_EQ(res_param.cross_rank_aggregates,
+                  ans_param.cross_rank_aggregates);
     }
 };
 
@@ -22,6 +22,7 @@
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/idr.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/mixed_precision_ir.hpp>
 #include <ginkgo/core/solver/triangular.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 
@@ -208,6 +209,87 @@ struct Ir : SolverConfigTest<gko::solver::Ir<float>, gko::solver::Ir<double>> {
 };
 
 
+struct MixedPrecisionIr
+    : SolverConfigTest<gko::solver::MixedPrecisionIr<float>,
+                       gko::solver::MixedPrecisionIr<double>> {
+    static pnode::map_type setup_base()
+    {
+        return {{"type", pnode{"solver::MixedPrecisionIr"}}};
+    }
+
+    template <bool from_reg, typename ParamType>
+    static void set(pnode::map_type& config_map, ParamType& param, registry reg,
+                    std::shared_ptr<const gko::Executor> exec)
+    {
+        config_map["max_inner_iterations"] = pnode{20};
+        param.with_max_inner_iterations(20u);
+        config_map["inner_reduction_factor"] = pnode{1e-3};
+        param.with_inner_reduction_factor(1e-3);
+        config_map["min_inner_reduction_factor"] = pnode{1e-5};
+        param.with_min_inner_reduction_factor(1e-5);
+        config_map["stagnation_ratio"] = pnode{0.25};
+        param.with_stagnation_ratio(0.25);
+        if (from_reg) {
+            config_map["criteria"] = pnode{"criterion_factory"};
+            param.with_criteria(
+                detail::registry_accessor::get_data<
+                    gko::stop::CriterionFactory>(reg, "criterion_factory"));
+            config_map["solver"] = pnode{"linop_factory"};
+            param.with_solver(
+                detail::registry_accessor::get_data<gko::LinOpFactory>(
+                    reg, "linop_factory"));
+            config_map["fallback_solver"] = pnode{"linop_factory"};
+            param.with_fallback_solver(
+                detail::registry_accessor::get_data<gko::LinOpFactory>(
+                    reg, "linop_factory"));
+        } else {
+            config_map["criteria"] = pnode{{{"type", pnode{"Iteration"}}}};
+            param.with_criteria(DummyStop::build().on(exec));
+            config_map["solver"] = pnode{{{"type", pnode{"solver::Cg"}},
+                                          {"value_type", pnode{"float64"}}}};
+            param.with_solver(DummySolver::build().on(exec));
+            config_map["fallback_solver"] =
+                pnode{{{"type", pnode{"solver::Cg"}},
+                       {"value_type", pnode{"float64"}}}};
+            param.with_fallback_solver(DummySolver::build().on(exec));
+        }
+    }
+
+    template <bool from_reg, typename AnswerType>
+    static void validate(gko::LinOpFactory* result, AnswerType* answer)
+    {
+        auto res_param = gko::as<AnswerType>(result)->get_parameters();
+        auto ans_param = answer->get_parameters();
+
+        ASSERT_EQ(res_param.max_inner_iterations,
+                  ans_param.max_inner_iterations);
+        ASSERT_EQ(res_param.inner_reduction_factor,
+                  ans_param.inner_reduction_factor);
+        ASSERT_EQ(res_param.min_inner_reduction_factor,
+                  ans_param.min_inner_reduction_factor);
+        ASSERT_EQ(res_param.stagnation_ratio, ans_param.stagnation_ratio);
+        if (from_reg) {
+            ASSERT_EQ(res_param.criteria, ans_param.criteria);
+            ASSERT_EQ(res_param.solver, ans_param.solver);
+            ASSERT_EQ(res_param.fallback_solver, ans_param.fallback_solver);
+        } else {
+            ASSERT_NE(
+                std::dynamic_pointer_cast<const typename DummyStop::Factory>(
+                    res_param.criteria.at(0)),
+                nullptr);
+            ASSERT_NE(
+                std::dynamic_pointer_cast<const typename DummySolver::Factory>(
+                    res_param.solver),
+                nullptr);
+            ASSERT_NE(
+                std::dynamic_pointer_cast<const typename DummySolver::Factory>(
+                    res_param.fallback_solver),
+                nullptr);
+        }
+    }
+};
+
+
 struct Idr
     : SolverConfigTest<gko::solver::Idr<float>, gko::solver::Idr<double>> {
     static pnode::map_type setup_base()
@@ -325,6 +407,10 @@ struct CbGmres : SolverConfigTest<gko::solver::CbGmres<float>,
         config_map["storage_precision"] = pnode{"reduce2"};
         param.with_storage_precision(
             gko::solver::cb_gmres::storage_precision::reduce2);
+        config_map["adaptive_residual_gap"] = pnode{100.0};
+        param.with_adaptive_residual_gap(100.0);
+        config_map["adaptive_stagnation_ratio"] = pnode{0.5};
+        param.with_adaptive_stagnation_ratio(0.5);
     }
 
     template <bool from_reg, typename AnswerType>
@@ -336,6 +422,10 @@ struct CbGmres : SolverConfigTest<gko::solver::CbGmres<float>,
         solver_config_test::template validate<from_reg>(result, answer);
         ASSERT_EQ(res_param.krylov_dim, ans_param.krylov_dim);
         ASSERT_EQ(res_param.storage_precision, ans_param.storage_precision);
+        ASSERT_EQ(res_param.adaptive_residual_gap,
+                  ans_param.adaptive_residual_gap);
+        ASSERT_EQ(res_param.adaptive_stagnation_ratio,
+                  ans_param.adaptive_stagnation_ratio);
     }
 };
 
@@ -467,8 +557,9 @@ protected:
 
 
 using SolverTypes =
-    ::testing::Types<::Cg, ::Fcg, ::Cgs, ::Bicg, ::Bicgstab, ::Ir, ::Idr, ::Gcr,
-                     ::Gmres, ::CbGmres, ::Direct, ::LowerTrs, ::UpperTrs>;
+    ::testing::Types<::Cg, ::Fcg, ::Cgs, ::Bicg, ::Bicgstab, ::Ir,
+                     ::MixedPrecisionIr, ::Idr, ::Gcr, ::Gmres, ::CbGmres,
+                     ::Direct, ::LowerTrs, ::UpperTrs>;
 
 
 TYPED_TEST_SUITE(Solver, SolverTypes, TypenameNameGenerator);
@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/log/operation_counters.hpp>
+
+
+#include <thread>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+using event_class = gko::log::OperationCounters::event_class;
+
+
+template <const char* Name>
+class DummyOperation : public gko::Operation {
+public:
+    void run(std::shared_ptr<const gko::OmpExecutor>) const override {}
+
+    void run(std::shared_ptr<const gko::ReferenceExecutor>) const override {}
+
+    void run(std::shared_ptr<const gko::HipExecutor>) const override {}
+
+    void run(std::shared_ptr<const gko::DpcppExecutor>) const override {}
+
+    void run(std::shared_ptr<const gko::CudaExecutor>) const override {}
+
+    const char* get_name() const noexcept override { return Name; }
+};
+
+
+constexpr char foo_name[] = "foo";
+constexpr char bar_name[] = "bar";
+using FooOperation = DummyOperation<foo_name>;
+using BarOperation = DummyOperation<bar_name>;
+
+
+TEST(OperationCounters, CountsAllocations)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::OperationCounters::create();
+    exec->add_logger(logger);
+
+    {
+        gko::array<char> a{exec, 25};
+        gko::array<char> b{exec, 7};
+    }
+
+    auto snapshot = logger->get_snapshot();
+    ASSERT_EQ(snapshot[event_class::allocation].count, 2);
+    ASSERT_EQ(snapshot[event_class::free].count, 2);
+    ASSERT_EQ(snapshot.bytes_allocated, 32);
+    ASSERT_EQ(snapshot[event_class::copy].count, 0);
+}
+
+
+TEST(OperationCounters, CountsCopies)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    gko::array<char> a{exec, 25};
+    auto logger = gko::log::OperationCounters::create();
+    exec->add_logger(logger);
+
+    gko::array<char> b{a};
+
+    auto snapshot = logger->get_snapshot();
+    ASSERT_EQ(snapshot[event_class::copy].count, 1);
+    ASSERT_EQ(snapshot.bytes_copied, 25);
+}
+
+
+TEST(OperationCounters, CountsOperations)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::OperationCounters::create();
+    exec->add_logger(logger);
+
+    exec->run(FooOperation{}, 10, 100);
+    exec->run(FooOperation{}, 10, 100);
+    exec->run(BarOperation{});
+
+    auto snapshot = logger->get_snapshot();
+    ASSERT_EQ(snapshot[event_class::operation].count, 3);
+    ASSERT_EQ(snapshot.operations.size(), 2);
+    ASSERT_EQ(snapshot.operations[0].name, "bar");
+    ASSERT_EQ(snapshot.operations[0].count, 1);
+    ASSERT_EQ(snapshot.operations[0].flops, 0);
+    ASSERT_EQ(snapshot.operations[0].bytes, 0);
+    ASSERT_EQ(snapshot.operations[1].name, "foo");
+    ASSERT_EQ(snapshot.operations[1].count, 2);
+    ASSERT_EQ(snapshot.operations[1].flops, 20);
+    ASSERT_EQ(snapshot.operations[1].bytes, 200);
+    ASSERT_LE(snapshot.operations[0].time + snapshot.operations[1].time,
+              snapshot[event_class::operation].time);
+}
+
+
+TEST(OperationCounters, CombinesOperationsBeyondLimit)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::OperationCounters::create(
+        gko::log::OperationCounters::default_mask, 1);
+    exec->add_logger(logger);
+
+    exec->run(FooOperation{});
+    exec->run(BarOperation{});
+    exec->run(BarOperation{});
+
+    auto snapshot = logger->get_snapshot();
+    ASSERT_EQ(snapshot.operations.size(), 2);
+    ASSERT_EQ(snapshot.operations[0].name, "foo");
+    ASSERT_EQ(snapshot.operations[0].count, 1);
+    ASSERT_EQ(snapshot.operations[1].name, "other");
+    ASSERT_EQ(snapshot.operations[1].count, 2);
+}
+
+
+TEST(OperationCounters, CountsApplyAndIgnoresMaskedEvents)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::initialize<gko::matrix::Dense<>>({{1.0, 2.0}}, exec);
+    auto b = gko::initialize<gko::matrix::Dense<>>({1.0, 2.0}, exec);
+    auto x = gko::initialize<gko::matrix::Dense<>>({0.0}, exec);
+    auto logger = gko::log::OperationCounters::create(
+        gko::log::Logger::linop_events_mask);
+    exec->add_logger(logger);
+
+    mtx->apply(b, x);
+
+    auto snapshot = logger->get_snapshot();
+    ASSERT_EQ(snapshot[event_class::apply].count, 1);
+    ASSERT_EQ(snapshot[event_class::operation].count, 0);
+    ASSERT_EQ(snapshot[event_class::allocation].count, 0);
+    ASSERT_TRUE(snapshot.operations.empty());
+}
+
+
+TEST(OperationCounters, SumsCountersOverThreads)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::OperationCounters::create();
+    exec->add_logger(logger);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([exec] {
+            for (int j = 0; j < 100; j++) {
+                exec->run(FooOperation{}, 1, 2);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto snapshot = logger->get_snapshot();
+    ASSERT_EQ(snapshot[event_class::operation].count, 400);
+    ASSERT_EQ(snapshot.operations.size(), 1);
+    ASSERT_EQ(snapshot.operations[0].count, 400);
+    ASSERT_EQ(snapshot.operations[0].flops, 400);
+    ASSERT_EQ(snapshot.operations[0].bytes, 800);
+}
+
+
+TEST(OperationCounters, ResetsCountersWhenReading)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::OperationCounters::create();
+    exec->add_logger(logger);
+    exec->run(FooOperation{});
+    { gko::array<char> a{exec, 25}; }
+
+    auto snapshot = logger->get_snapshot(true);
+    exec->run(FooOperation{});
+    auto snapshot2 = logger->get_snapshot();
+    logger->reset();
+    auto snapshot3 = logger->get_snapshot();
+
+    ASSERT_EQ(snapshot[event_class::operation].count, 1);
+    ASSERT_EQ(snapshot.bytes_allocated, 25);
+    ASSERT_EQ(snapshot2[event_class::operation].count, 1);
+    ASSERT_EQ(snapshot2.bytes_allocated, 0);
+    ASSERT_EQ(snapshot2.operations.size(), 1);
+    ASSERT_EQ(snapshot3[event_class::operation].count, 0);
+    ASSERT_TRUE(snapshot3.operations.empty());
+}
+
+
+}  // namespace
@@ -6,7 +6,9 @@
 
 
 #include <chrono>
+#include <sstream>
 #include <string>
+#include <thread>
 
 
 #include <gtest/gtest.h>
@@ -378,6 +380,138 @@ TEST(ProfilerHook, NestedSummaryWorks)
 }
 
 
+int count_occurrences(const std::string& str, const std::string& pattern)
+{
+    int count{};
+    for (auto pos = str.find(pattern); pos != std::string::npos;
+         pos = str.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+
+struct TestWorkSummaryWriter : gko::log::ProfilerHook::SummaryWriter {
+    void write(const std::vector<gko::log::ProfilerHook::summary_entry>& e,
+               std::chrono::nanoseconds overhead) override
+    {
+        ASSERT_EQ(e.size(), 2);
+        ASSERT_EQ(e[0].name, "total");
+        ASSERT_EQ(e[0].flops, 0);
+        ASSERT_EQ(e[0].bytes, 0);
+        ASSERT_EQ(e[1].name, "op");
+        ASSERT_EQ(e[1].count, 3);
+        ASSERT_EQ(e[1].flops, 30);
+        ASSERT_EQ(e[1].bytes, 300);
+    }
+};
+
+TEST(ProfilerHook, SummaryAccumulatesReportedWork)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::ProfilerHook::create_summary(
+        std::make_unique<gko::CpuTimer>(),
+        std::make_unique<TestWorkSummaryWriter>());
+    exec->add_logger(logger);
+
+    exec->run(DummyOperation{}, 10, 100);
+    exec->run(DummyOperation{}, 20, 200);
+    exec->run(DummyOperation{});
+
+    exec->remove_logger(logger);
+    // The assertions happen in the destructor of `logger`
+}
+
+
+struct TestNestedWorkSummaryWriter
+    : gko::log::ProfilerHook::NestedSummaryWriter {
+    void write_nested(const gko::log::ProfilerHook::nested_summary_entry& e,
+                      std::chrono::nanoseconds overhead) override
+    {
+        ASSERT_EQ(e.name, "total");
+        ASSERT_EQ(e.children.size(), 2);
+        ASSERT_EQ(e.children[0].name, "op");
+        ASSERT_EQ(e.children[0].count, 1);
+        ASSERT_EQ(e.children[0].flops, 10);
+        ASSERT_EQ(e.children[0].bytes, 100);
+        auto& f = e.children[1];
+        ASSERT_EQ(f.name, "foo");
+        ASSERT_EQ(f.flops, 0);
+        ASSERT_EQ(f.bytes, 0);
+        ASSERT_EQ(f.children.size(), 1);
+        ASSERT_EQ(f.children[0].name, "op");
+        ASSERT_EQ(f.children[0].count, 2);
+        ASSERT_EQ(f.children[0].flops, 40);
+        ASSERT_EQ(f.children[0].bytes, 400);
+    }
+};
+
+TEST(ProfilerHook, NestedSummaryAccumulatesReportedWork)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::ProfilerHook::create_nested_summary(
+        std::make_unique<gko::CpuTimer>(),
+        std::make_unique<TestNestedWorkSummaryWriter>());
+    exec->add_logger(logger);
+
+    exec->run(DummyOperation{}, 10, 100);
+    {
+        auto range = logger->user_range("foo");
+        exec->run(DummyOperation{}, 20, 200);
+        exec->run(DummyOperation{}, 20, 200);
+    }
+
+    exec->remove_logger(logger);
+    // The assertions happen in the destructor of `logger`
+}
+
+
+TEST(ProfilerHook, TraceWorks)
+{
+    std::stringstream ss;
+    {
+        // flush the buffer every other event
+        auto logger = gko::log::ProfilerHook::create_trace(ss, 3, 2);
+
+        call_ranges(logger);
+        auto range = logger->user_range("quote\"d");
+    }
+
+    const auto str = ss.str();
+    ASSERT_EQ(str.substr(0, 39), R"({"displayTimeUnit":"ns","traceEvents":[)");
+    ASSERT_EQ(str.substr(str.size() - 3), "]}\n");
+    ASSERT_EQ(count_occurrences(str, R"("ph":"B")"), 8);
+    ASSERT_EQ(count_occurrences(str, R"("ph":"E")"), 8);
+    ASSERT_EQ(count_occurrences(str, R"("ph":"B","name":"foo","cat":"user")"),
+              3);
+    ASSERT_EQ(count_occurrences(str, R"("name":"quote\"d")"), 2);
+    ASSERT_EQ(count_occurrences(str, R"("pid":3,"tid":0)"), 17);
+    ASSERT_EQ(count_occurrences(str, R"("name":"thread_name")"), 1);
+}
+
+
+TEST(ProfilerHook, TraceUsesOneTrackPerThread)
+{
+    std::stringstream ss;
+    {
+        auto logger = gko::log::ProfilerHook::create_trace(ss);
+
+        auto range = logger->user_range("main");
+        std::thread thread{[&] { auto range = logger->user_range("thread"); }};
+        thread.join();
+    }
+
+    const auto str = ss.str();
+    ASSERT_EQ(count_occurrences(
+                  str, R"("name":"main","cat":"user","pid":0,"tid":0)"),
+              2);
+    ASSERT_EQ(count_occurrences(
+                  str, R"("name":"thread","cat":"user","pid":0,"tid":1)"),
+              2);
+    ASSERT_EQ(count_occurrences(str, R"("name":"thread_name")"), 2);
+}
+
+
 TEST(ProfilerHookTableSummaryWriter, SummaryWorks)
 {
     using gko::log::ProfilerHook;
@@ -443,3 +577,26 @@ Overhead estimate 1.0 ns
 
     ASSERT_EQ(ss.str(), expected);
 }
+
+
+TEST(ProfilerHookRooflineSummaryWriter, SummaryWorks)
+{
+    using gko::log::ProfilerHook;
+    using namespace std::chrono_literals;
+    std::stringstream ss;
+    ProfilerHook::RooflineSummaryWriter writer(ss, "Test header", 100.0);
+    std::vector<ProfilerHook::summary_entry> entries;
+    entries.push_back({"total", 3s, 1s, 1});  // no work reported
+    entries.push_back({"dot", 500ms, 500ms, 1, 1000000000, 8000000000});
+    entries.push_back({"spmv", 1s, 1s, 2, 4000000000, 10000000000});
+    const auto expected = R"(Test header
+| name |  total   | count | GFLOP/s | GB/s  | FLOP/byte | peak bandwidth |
+|------|---------:|------:|--------:|------:|----------:|---------------:|
+| spmv |   1.0 s  |     2 |    4.00 | 10.00 |     0.400 |         10.0 % |
+| dot  | 500.0 ms |     1 |    2.00 | 16.00 |     0.125 |         16.0 % |
+)";
+
+    writer.write(entries, 1s);
+
+    ASSERT_EQ(ss.str(), expected);
+}
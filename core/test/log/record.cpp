@@ -10,7 +10,9 @@
 
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/solver/bicgstab.hpp>
+#include <ginkgo/core/solver/cb_gmres.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 
 
@@ -178,6 +180,46 @@ TEST(Record, CatchesOperationCompleted)
 }
 
 
+TEST(Record, CatchesOperationWorkReported)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Record::create(
+        gko::log::Logger::operation_work_reported_mask);
+    gko::Operation op;
+
+    logger->on<gko::log::Logger::operation_work_reported>(exec.get(), &op,
+                                                           10, 20);
+
+    auto& data = logger->get().operation_work_reported.back();
+    ASSERT_EQ(data->exec, exec.get());
+    ASSERT_EQ(data->operation, &op);
+    ASSERT_EQ(data->flops, 10);
+    ASSERT_EQ(data->bytes, 20);
+}
+
+
+TEST(Record, CatchesKrylovStoragePrecisionSelected)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Record::create(
+        gko::log::Logger::krylov_storage_precision_selected_mask);
+    auto factory =
+        gko::solver::CbGmres<>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(exec);
+    auto solver = factory->generate(gko::matrix::Dense<>::create(exec));
+
+    logger->on<gko::log::Logger::krylov_storage_precision_selected>(
+        solver.get(), 10, gko::solver::cb_gmres::storage_precision::reduce1);
+
+    auto& data = logger->get().krylov_storage_precision_selected.back();
+    ASSERT_EQ(data->solver, solver.get());
+    ASSERT_EQ(data->num_iterations, 10);
+    ASSERT_EQ(data->precision,
+              gko::solver::cb_gmres::storage_precision::reduce1);
+}
+
+
 TEST(Record, CatchesPolymorphicObjectCreateStarted)
 {
     using Dense = gko::matrix::Dense<>;
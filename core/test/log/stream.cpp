@@ -16,6 +16,7 @@
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/solver/bicgstab.hpp>
+#include <ginkgo/core/solver/cb_gmres.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 
 
@@ -197,6 +198,49 @@ TYPED_TEST(Stream, CatchesOperationCompleted)
 }
 
 
+TYPED_TEST(Stream, CatchesOperationWorkReported)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    std::stringstream out;
+    auto logger = gko::log::Stream<TypeParam>::create(
+        gko::log::Logger::operation_work_reported_mask, out);
+    gko::Operation op;
+    std::stringstream ptrstream;
+    ptrstream << &op;
+
+    logger->template on<gko::log::Logger::operation_work_reported>(
+        exec.get(), &op, 10, 20);
+
+    auto os = out.str();
+    GKO_ASSERT_STR_CONTAINS(os, ptrstream.str());
+    GKO_ASSERT_STR_CONTAINS(os, "performs 10 floating point operations");
+}
+
+
+TYPED_TEST(Stream, CatchesKrylovStoragePrecisionSelected)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    std::stringstream out;
+    auto logger = gko::log::Stream<TypeParam>::create(
+        gko::log::Logger::krylov_storage_precision_selected_mask, out);
+    auto factory =
+        gko::solver::CbGmres<TypeParam>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(exec);
+    auto solver =
+        factory->generate(gko::matrix::Dense<TypeParam>::create(exec));
+    std::stringstream ptrstream;
+    ptrstream << solver.get();
+
+    logger->template on<gko::log::Logger::krylov_storage_precision_selected>(
+        solver.get(), 10, gko::solver::cb_gmres::storage_precision::reduce1);
+
+    auto os = out.str();
+    GKO_ASSERT_STR_CONTAINS(os, ptrstream.str());
+    GKO_ASSERT_STR_CONTAINS(os, "precision reduce1 after 10 iterations");
+}
+
+
 TYPED_TEST(Stream, CatchesPolymorphicObjectCreateStarted)
 {
     auto exec = gko::ReferenceExecutor::create();
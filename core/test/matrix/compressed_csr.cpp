@@ -0,0 +1,253 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/compressed_csr.hpp>
+
+
+#include <limits>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class CompressedCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::CompressedCsr<value_type, index_type>;
+
+    CompressedCsr() : exec(gko::ReferenceExecutor::create()) {}
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_const_values(), nullptr);
+        ASSERT_EQ(m->get_const_col_idxs(), nullptr);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        ASSERT_EQ(m->get_const_row_ptrs()[0], 0);
+        ASSERT_EQ(m->get_const_row_scales(), nullptr);
+        ASSERT_EQ(m->get_const_col_deltas(), nullptr);
+        ASSERT_EQ(m->get_const_outlier_cols(), nullptr);
+        ASSERT_EQ(m->get_num_outliers(), 0);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+};
+
+TYPED_TEST_SUITE(CompressedCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(CompressedCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+    ASSERT_EQ(mtx->get_storage_precision(), gko::precision_reduction(0, 1));
+    ASSERT_EQ(mtx->get_value_size(),
+              sizeof(gko::reduce_precision<value_type>));
+    ASSERT_FALSE(mtx->is_row_scaled());
+    ASSERT_EQ(mtx->get_index_compression(),
+              gko::matrix::compressed_csr::index_compression::none);
+}
+
+
+TYPED_TEST(CompressedCsr, KnowsStorageSize)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+
+    auto keep = Mtx::create(this->exec, gko::precision_reduction(0, 0));
+    auto truncated = Mtx::create(this->exec, gko::precision_reduction(1, 0));
+
+    ASSERT_EQ(keep->get_value_size(), sizeof(value_type));
+    ASSERT_EQ(truncated->get_value_size(), sizeof(value_type) / 2);
+}
+
+
+TYPED_TEST(CompressedCsr, RejectsAutodetectedStoragePrecision)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    ASSERT_THROW(
+        Mtx::create(this->exec, gko::precision_reduction::autodetect()),
+        gko::InvalidStateError);
+}
+
+
+TYPED_TEST(CompressedCsr, CanBeRead)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = Mtx::create(this->exec, gko::precision_reduction(0, 1), true);
+
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        {2, 3}, {{0, 0, 1.0}, {0, 1, 3.0}, {0, 2, 2.0}, {1, 1, 5.0}}});
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(mtx->get_num_stored_elements(), 4);
+    auto r = mtx->get_const_row_ptrs();
+    auto c = mtx->get_const_col_idxs();
+    auto s = mtx->get_const_row_scales();
+    EXPECT_EQ(r[0], 0);
+    EXPECT_EQ(r[1], 3);
+    EXPECT_EQ(r[2], 4);
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 1);
+    EXPECT_EQ(c[2], 2);
+    EXPECT_EQ(c[3], 1);
+    ASSERT_NE(s, nullptr);
+    EXPECT_EQ(s[0], 3.0);
+    EXPECT_EQ(s[1], 5.0);
+}
+
+
+TYPED_TEST(CompressedCsr, CanBeReadWithDeltaCompressedIndexes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx =
+        Mtx::create(this->exec, gko::precision_reduction(0, 1), false,
+                    gko::matrix::compressed_csr::index_compression::delta8);
+
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        {2, 300},
+        {{0, 0, 1.0},
+         {0, 1, 3.0},
+         {0, 200, 2.0},
+         {1, 128, 5.0},
+         {1, 299, 4.0}}});
+
+    ASSERT_EQ(mtx->get_num_stored_elements(), 5);
+    ASSERT_EQ(mtx->get_const_col_idxs(), nullptr);
+    auto d = reinterpret_cast<const gko::int8*>(mtx->get_const_col_deltas());
+    auto o = mtx->get_const_outlier_cols();
+    auto p = mtx->get_const_outlier_ptrs();
+    ASSERT_EQ(mtx->get_num_outliers(), 2);
+    EXPECT_EQ(d[0], 0);
+    EXPECT_EQ(d[1], 1);
+    EXPECT_EQ(d[2], std::numeric_limits<gko::int8>::min());
+    EXPECT_EQ(d[3], 127);
+    EXPECT_EQ(d[4], std::numeric_limits<gko::int8>::min());
+    EXPECT_EQ(o[0], 200);
+    EXPECT_EQ(o[1], 299);
+    EXPECT_EQ(p[0], 0);
+    EXPECT_EQ(p[1], 1);
+    EXPECT_EQ(p[2], 2);
+}
+
+
+TYPED_TEST(CompressedCsr, StoresWideDeltasWithoutOutliers)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx =
+        Mtx::create(this->exec, gko::precision_reduction(0, 1), false,
+                    gko::matrix::compressed_csr::index_compression::delta16);
+
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        {2, 300},
+        {{0, 0, 1.0},
+         {0, 1, 3.0},
+         {0, 200, 2.0},
+         {1, 128, 5.0},
+         {1, 299, 4.0}}});
+
+    auto d = reinterpret_cast<const gko::int16*>(mtx->get_const_col_deltas());
+    ASSERT_EQ(mtx->get_num_outliers(), 0);
+    EXPECT_EQ(d[0], 0);
+    EXPECT_EQ(d[1], 1);
+    EXPECT_EQ(d[2], 199);
+    EXPECT_EQ(d[3], 127);
+    EXPECT_EQ(d[4], 171);
+}
+
+
+TYPED_TEST(CompressedCsr, CanBeWritten)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = Mtx::create(this->exec, gko::precision_reduction(0, 1), true);
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        {2, 3}, {{0, 0, 1.0}, {0, 1, 3.0}, {0, 2, 2.0}, {1, 1, 5.0}}});
+
+    gko::matrix_data<value_type, index_type> data;
+    mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(2, 3));
+    ASSERT_EQ(data.nonzeros.size(), 4);
+    EXPECT_EQ(data.nonzeros[0], (gko::matrix_data_entry<value_type, index_type>{
+                                    0, 0, value_type{1.0}}));
+    EXPECT_EQ(data.nonzeros[1], (gko::matrix_data_entry<value_type, index_type>{
+                                    0, 1, value_type{3.0}}));
+    EXPECT_EQ(data.nonzeros[2], (gko::matrix_data_entry<value_type, index_type>{
+                                    0, 2, value_type{2.0}}));
+    EXPECT_EQ(data.nonzeros[3], (gko::matrix_data_entry<value_type, index_type>{
+                                    1, 1, value_type{5.0}}));
+}
+
+
+TYPED_TEST(CompressedCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = Mtx::create(this->exec, gko::precision_reduction(0, 2));
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        {2, 2}, {{0, 0, 1.0}, {1, 1, 2.0}}});
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(mtx);
+
+    ASSERT_EQ(copy->get_storage_precision(), gko::precision_reduction(0, 2));
+    ASSERT_EQ(copy->get_value_size(), mtx->get_value_size());
+    ASSERT_EQ(copy->get_num_stored_elements(), 2);
+    ASSERT_NE(copy->get_const_values(), mtx->get_const_values());
+    GKO_ASSERT_MTX_NEAR(copy, mtx, 0.0);
+}
+
+
+TYPED_TEST(CompressedCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = Mtx::create(this->exec, gko::precision_reduction(0, 1), true);
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        {2, 2}, {{0, 0, 1.0}, {1, 1, 2.0}}});
+    auto moved = Mtx::create(this->exec);
+
+    moved->move_from(mtx);
+
+    ASSERT_EQ(moved->get_size(), gko::dim<2>(2, 2));
+    ASSERT_EQ(moved->get_num_stored_elements(), 2);
+    ASSERT_TRUE(moved->is_row_scaled());
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(0, 0));
+    ASSERT_EQ(mtx->get_num_stored_elements(), 0);
+    ASSERT_EQ(mtx->get_const_row_ptrs()[0], 0);
+}
+
+
+}  // namespace
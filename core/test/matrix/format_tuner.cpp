@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/format_tuner.hpp>
+
+
+#include <cstdio>
+#include <fstream>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+class FormatTuner : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = gko::int32;
+    using Coo = gko::matrix::Coo<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Ell = gko::matrix::Ell<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using Tuner = gko::matrix::FormatTuner<value_type, index_type>;
+
+    FormatTuner()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Csr>(
+              {{1.0, 2.0, 0.0}, {0.0, 3.0, 0.0}, {4.0, 0.0, 5.0}}, exec)),
+          cache_file{"format_tuner_test_cache"}
+    {
+        std::remove(cache_file.c_str());
+    }
+
+    ~FormatTuner() { std::remove(cache_file.c_str()); }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> mtx;
+    std::string cache_file;
+};
+
+
+TEST_F(FormatTuner, ReturnsEquivalentMatrix)
+{
+    Tuner tuner{exec};
+    auto b = gko::initialize<Vec>({1.0, 2.0, 3.0}, exec);
+    auto x = Vec::create(exec, gko::dim<2>{3, 1});
+    auto expected = Vec::create(exec, gko::dim<2>{3, 1});
+
+    auto result = tuner.tune(mtx.get());
+    result.matrix->apply(b, x);
+    mtx->apply(b, expected);
+
+    ASSERT_FALSE(result.cached);
+    ASSERT_EQ(result.timings.count(result.format), 1);
+    // load_balance is not considered on CPU executors
+    ASSERT_EQ(result.timings.size(), Tuner::get_default_formats().size() - 1);
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+TEST_F(FormatTuner, OnlyTimesCandidateFormats)
+{
+    Tuner tuner{exec, "", 1, 1, {"coo"}};
+
+    auto result = tuner.tune(mtx.get());
+
+    ASSERT_EQ(result.format, "coo");
+    ASSERT_NE(dynamic_cast<Coo*>(result.matrix.get()), nullptr);
+    ASSERT_EQ(result.timings.size(), 1);
+}
+
+
+TEST_F(FormatTuner, SkipsImbalancedEll)
+{
+    auto imbalanced = gko::initialize<Csr>(
+        {{1.0, 2.0, 3.0, 4.0}, {0.0, 1.0, 0.0, 0.0}, {0.0, 0.0, 1.0, 0.0},
+         {0.0, 0.0, 0.0, 1.0}},
+        exec);
+    Tuner tuner{exec, "", 1, 1, {"ell", "coo"}, 2.0};
+
+    auto result = tuner.tune(imbalanced.get());
+
+    ASSERT_EQ(result.format, "coo");
+    ASSERT_EQ(tuner.convert("ell", imbalanced.get()), nullptr);
+    ASSERT_NE(tuner.convert("ell", mtx.get()), nullptr);
+}
+
+
+TEST_F(FormatTuner, ReusesDecisionFromCacheFile)
+{
+    std::string format;
+    {
+        Tuner tuner{exec, cache_file};
+        format = tuner.tune(mtx.get()).format;
+    }
+    Tuner tuner{exec, cache_file};
+
+    auto result = tuner.tune(mtx.get());
+
+    ASSERT_TRUE(result.cached);
+    ASSERT_EQ(result.format, format);
+    ASSERT_TRUE(result.timings.empty());
+    ASSERT_EQ(tuner.get_cached_format(Tuner::get_fingerprint(exec, mtx.get())),
+              format);
+}
+
+
+TEST_F(FormatTuner, ReadsDecisionFromCacheFile)
+{
+    {
+        std::ofstream stream{cache_file};
+        stream << "invalid line\n"
+               << Tuner::get_fingerprint(exec, mtx.get()) << " sellp\n"
+               << Tuner::get_fingerprint(exec, mtx.get()) << " ell\n";
+    }
+    Tuner tuner{exec, cache_file};
+
+    auto result = tuner.tune(mtx.get());
+
+    ASSERT_TRUE(result.cached);
+    ASSERT_EQ(result.format, "ell");
+    ASSERT_NE(dynamic_cast<Ell*>(result.matrix.get()), nullptr);
+}
+
+
+TEST_F(FormatTuner, FingerprintDependsOnSparsityPattern)
+{
+    auto other = gko::initialize<Csr>(
+        {{1.0, 0.0, 0.0}, {2.0, 3.0, 0.0}, {4.0, 0.0, 5.0}}, exec);
+    auto scaled = gko::initialize<Csr>(
+        {{2.0, 4.0, 0.0}, {0.0, 6.0, 0.0}, {8.0, 0.0, 10.0}}, exec);
+
+    ASSERT_NE(Tuner::get_fingerprint(exec, mtx.get()),
+              Tuner::get_fingerprint(exec, other.get()));
+    ASSERT_EQ(Tuner::get_fingerprint(exec, mtx.get()),
+              Tuner::get_fingerprint(exec, scaled.get()));
+}
+
+
+TEST_F(FormatTuner, ThrowsOnUnknownFormat)
+{
+    ASSERT_THROW(Tuner(exec, "", 1, 1, {"csr", "dense"}),
+                 gko::InvalidStateError);
+}
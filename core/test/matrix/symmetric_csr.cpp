@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+
+    SymmetricCsr()
+        : exec(gko::ReferenceExecutor::create()), mtx(Mtx::create(exec))
+    {
+        mtx->read(gko::matrix_data<value_type, index_type>{
+            {3, 3},
+            {{0, 0, 2.0},
+             {0, 1, 1.0},
+             {1, 0, 1.0},
+             {1, 1, 3.0},
+             {1, 2, -1.0},
+             {2, 1, -1.0},
+             {2, 2, 4.0}}});
+    }
+
+    void assert_equal_to_original_mtx(const Mtx* m)
+    {
+        auto v = m->get_const_values();
+        auto c = m->get_const_col_idxs();
+        auto r = m->get_const_row_ptrs();
+        ASSERT_EQ(m->get_size(), gko::dim<2>(3, 3));
+        ASSERT_EQ(m->get_num_stored_elements(), 5);
+        EXPECT_EQ(r[0], 0);
+        EXPECT_EQ(r[1], 2);
+        EXPECT_EQ(r[2], 4);
+        EXPECT_EQ(r[3], 5);
+        EXPECT_EQ(c[0], 0);
+        EXPECT_EQ(c[1], 1);
+        EXPECT_EQ(c[2], 1);
+        EXPECT_EQ(c[3], 2);
+        EXPECT_EQ(c[4], 2);
+        EXPECT_EQ(v[0], value_type{2.0});
+        EXPECT_EQ(v[1], value_type{1.0});
+        EXPECT_EQ(v[2], value_type{3.0});
+        EXPECT_EQ(v[3], value_type{-1.0});
+        EXPECT_EQ(v[4], value_type{4.0});
+    }
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_const_values(), nullptr);
+        ASSERT_EQ(m->get_const_col_idxs(), nullptr);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        ASSERT_EQ(m->get_const_row_ptrs()[0], 0);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(SymmetricCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, StoresOnlyUpperTriangle)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCreatedFromUnsortedCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::array<value_type> values{this->exec,
+                                  {1.0, 2.0, 3.0, 1.0, -1.0, 4.0, -1.0}};
+    gko::array<index_type> col_idxs{this->exec, {1, 0, 1, 0, 2, 2, 1}};
+    gko::array<index_type> row_ptrs{this->exec, {0, 2, 5, 7}};
+    auto csr = Csr::create(this->exec, gko::dim<2>{3, 3}, std::move(values),
+                           std::move(col_idxs), std::move(row_ptrs));
+
+    auto mtx = Mtx::create(this->exec, csr.get());
+
+    this->assert_equal_to_original_mtx(mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, ThrowsOnRectangularMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Csr = typename TestFixture::Csr;
+    auto csr = Csr::create(this->exec, gko::dim<2>{2, 3});
+
+    ASSERT_THROW(Mtx::create(this->exec, csr.get()), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeWritten)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using entry = gko::matrix_data_entry<value_type, index_type>;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 3));
+    ASSERT_EQ(data.nonzeros.size(), 7);
+    EXPECT_EQ(data.nonzeros[0], (entry{0, 0, value_type{2.0}}));
+    EXPECT_EQ(data.nonzeros[1], (entry{0, 1, value_type{1.0}}));
+    EXPECT_EQ(data.nonzeros[2], (entry{1, 0, value_type{1.0}}));
+    EXPECT_EQ(data.nonzeros[3], (entry{1, 1, value_type{3.0}}));
+    EXPECT_EQ(data.nonzeros[4], (entry{1, 2, value_type{-1.0}}));
+    EXPECT_EQ(data.nonzeros[5], (entry{2, 1, value_type{-1.0}}));
+    EXPECT_EQ(data.nonzeros[6], (entry{2, 2, value_type{4.0}}));
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(this->mtx.get());
+    this->assert_equal_to_original_mtx(copy.get());
+    ASSERT_NE(copy->get_const_values(), this->mtx->get_const_values());
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto moved = Mtx::create(this->exec);
+
+    moved->move_from(this->mtx);
+
+    this->assert_equal_to_original_mtx(moved.get());
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCloned)
+{
+    auto clone = gko::clone(this->mtx);
+
+    this->assert_equal_to_original_mtx(clone.get());
+}
+
+
+}  // namespace
@@ -64,6 +64,8 @@ TYPED_TEST(PgmFactory, DefaultSetting)
     ASSERT_EQ(factory->get_parameters().max_unassigned_ratio, 0.05);
     ASSERT_EQ(factory->get_parameters().deterministic, false);
     ASSERT_EQ(factory->get_parameters().skip_sorting, false);
+    ASSERT_EQ(factory->get_parameters().agglomeration_threshold, 0u);
+    ASSERT_EQ(factory->get_parameters().cross_rank_aggregates, false);
 }
 
 
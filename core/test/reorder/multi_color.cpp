@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/multi_color.hpp>
+
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "matrices/config.hpp"
+
+
+template <typename ValueIndexType>
+class MultiColor : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    using reorder_type = gko::experimental::reorder::MultiColor<index_type>;
+    using distance = gko::experimental::reorder::multi_color_distance;
+
+    MultiColor()
+        : ref(gko::ReferenceExecutor::create()),
+          mtx(gko::read<matrix_type>(
+              std::ifstream{gko::matrices::location_ani1_nonsymm_mtx}, ref)),
+          color_ptrs{ref}
+    {}
+
+    // checks that the color offsets partition the permutation, and that no
+    // two rows of the same color are connected in A + A^T within the given
+    // distance
+    void assert_valid_coloring(const matrix_type* mtx,
+                               const gko::matrix::Permutation<index_type>* perm,
+                               bool distance_two)
+    {
+        const auto num_rows = static_cast<index_type>(mtx->get_size()[0]);
+        const auto perm_data = perm->get_const_permutation();
+        const auto color_ptrs_data = color_ptrs.get_const_data();
+        const auto num_colors = color_ptrs.get_size() - 1;
+        ASSERT_EQ(color_ptrs_data[0], 0);
+        ASSERT_EQ(color_ptrs_data[num_colors], num_rows);
+        std::vector<index_type> colors(num_rows, -1);
+        for (gko::size_type color = 0; color < num_colors; color++) {
+            ASSERT_LT(color_ptrs_data[color], color_ptrs_data[color + 1]);
+            for (auto i = color_ptrs_data[color];
+                 i < color_ptrs_data[color + 1]; i++) {
+                ASSERT_EQ(colors[perm_data[i]], -1);
+                colors[perm_data[i]] = color;
+            }
+        }
+        std::vector<std::vector<index_type>> neighbors(num_rows);
+        const auto row_ptrs = mtx->get_const_row_ptrs();
+        const auto col_idxs = mtx->get_const_col_idxs();
+        for (index_type row = 0; row < num_rows; row++) {
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                const auto col = col_idxs[nz];
+                if (col != row) {
+                    neighbors[row].push_back(col);
+                    neighbors[col].push_back(row);
+                }
+            }
+        }
+        for (index_type row = 0; row < num_rows; row++) {
+            for (auto neighbor : neighbors[row]) {
+                ASSERT_NE(colors[row], colors[neighbor]);
+                if (distance_two) {
+                    for (auto neighbor2 : neighbors[neighbor]) {
+                        if (neighbor2 != row) {
+                            ASSERT_NE(colors[row], colors[neighbor2]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<matrix_type> mtx;
+    gko::array<index_type> color_ptrs;
+};
+
+TYPED_TEST_SUITE(MultiColor, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(MultiColor, ComputesDistanceOneColoring)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    auto factory = reorder_type::build().on(this->ref);
+
+    auto perm = factory->generate(this->mtx, this->color_ptrs);
+
+    ASSERT_EQ(perm->get_size(), this->mtx->get_size());
+    this->assert_valid_coloring(this->mtx.get(), perm.get(), false);
+}
+
+
+TYPED_TEST(MultiColor, ComputesDistanceTwoColoring)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    using distance = typename TestFixture::distance;
+    auto factory =
+        reorder_type::build().with_distance(distance::two).on(this->ref);
+
+    auto perm = factory->generate(this->mtx, this->color_ptrs);
+
+    this->assert_valid_coloring(this->mtx.get(), perm.get(), true);
+}
+
+
+TYPED_TEST(MultiColor, DistanceTwoNeedsMoreColors)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    using distance = typename TestFixture::distance;
+    using index_type = typename TestFixture::index_type;
+    gko::array<index_type> color_ptrs2{this->ref};
+
+    reorder_type::build().on(this->ref)->generate(this->mtx, this->color_ptrs);
+    reorder_type::build()
+        .with_distance(distance::two)
+        .on(this->ref)
+        ->generate(this->mtx, color_ptrs2);
+
+    ASSERT_GT(color_ptrs2.get_size(), this->color_ptrs.get_size());
+}
+
+
+TYPED_TEST(MultiColor, SymmetrizesMatrix)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    auto mtx = gko::share(gko::initialize<matrix_type>(
+        {{1.0, 1.0, 0.0}, {0.0, 1.0, 1.0}, {0.0, 0.0, 1.0}}, this->ref));
+    auto factory = reorder_type::build().on(this->ref);
+
+    auto perm = factory->generate(mtx, this->color_ptrs);
+
+    ASSERT_GE(this->color_ptrs.get_size(), 3);
+    this->assert_valid_coloring(mtx.get(), perm.get(), false);
+}
+
+
+TYPED_TEST(MultiColor, DiagonalMatrixHasOneColor)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = gko::share(gko::initialize<matrix_type>(
+        {{1.0, 0.0, 0.0}, {0.0, 2.0, 0.0}, {0.0, 0.0, 3.0}}, this->ref));
+    auto factory = reorder_type::build().on(this->ref);
+
+    auto perm = factory->generate(mtx, this->color_ptrs);
+
+    GKO_ASSERT_ARRAY_EQ(this->color_ptrs, I<index_type>({0, 3}));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_array_view(this->ref, 3, perm->get_permutation()),
+        I<index_type>({0, 1, 2}));
+}
+
+
+TYPED_TEST(MultiColor, ColorsEmptyMatrix)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = gko::share(matrix_type::create(this->ref));
+    auto factory = reorder_type::build().on(this->ref);
+
+    auto perm = factory->generate(mtx, this->color_ptrs);
+
+    ASSERT_EQ(perm->get_size(), gko::dim<2>{});
+    GKO_ASSERT_ARRAY_EQ(this->color_ptrs, I<index_type>({0}));
+}
+
+
+TYPED_TEST(MultiColor, GenerateWithoutColorsReturnsSamePermutation)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    auto factory = reorder_type::build().on(this->ref);
+    const auto num_rows = this->mtx->get_size()[0];
+
+    auto perm = factory->generate(this->mtx);
+    auto perm2 = factory->generate(this->mtx, this->color_ptrs);
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_array_view(this->ref, num_rows, perm->get_permutation()),
+        gko::make_array_view(this->ref, num_rows, perm2->get_permutation()));
+}
+
+
+TYPED_TEST(MultiColor, ThrowsOnRectangularMatrix)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    auto mtx = gko::share(matrix_type::create(this->ref, gko::dim<2>{2, 3}));
+    auto factory = reorder_type::build().on(this->ref);
+
+    ASSERT_THROW(factory->generate(mtx, this->color_ptrs),
+                 gko::DimensionMismatch);
+}
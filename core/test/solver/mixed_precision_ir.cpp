@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/mixed_precision_ir.hpp>
+
+
+#include <type_traits>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/solver/gmres.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename T>
+class MixedPrecisionIr : public ::testing::Test {
+protected:
+    using value_type = T;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Solver = gko::solver::MixedPrecisionIr<value_type>;
+    using inner_value_type = typename Solver::inner_value_type;
+
+    MixedPrecisionIr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{2, -1.0, 0.0}, {-1.0, 2, -1.0}, {0.0, -1.0, 2}}, exec)),
+          ir_factory(Solver::build()
+                         .with_criteria(
+                             gko::stop::Iteration::build().with_max_iters(3u))
+                         .on(exec)),
+          solver(ir_factory->generate(mtx))
+    {}
+
+    std::shared_ptr<gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::shared_ptr<typename Solver::Factory> ir_factory;
+    std::unique_ptr<gko::LinOp> solver;
+};
+
+TYPED_TEST_SUITE(MixedPrecisionIr, gko::test::ValueTypes,
+                 TypenameNameGenerator);
+
+
+TYPED_TEST(MixedPrecisionIr, FactoryKnowsItsExecutor)
+{
+    ASSERT_EQ(this->ir_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, InnerPrecisionIsSinglePrecision)
+{
+    using inner_value_type = typename TestFixture::inner_value_type;
+
+    ASSERT_TRUE((std::is_same<gko::remove_complex<inner_value_type>,
+                              float>::value));
+    ASSERT_EQ(gko::is_complex<inner_value_type>(),
+              gko::is_complex<TypeParam>());
+}
+
+
+TYPED_TEST(MixedPrecisionIr, FactoryCreatesCorrectSolver)
+{
+    using Solver = typename TestFixture::Solver;
+    using inner_value_type = typename TestFixture::inner_value_type;
+    auto ir_solver = static_cast<Solver*>(this->solver.get());
+
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(ir_solver->get_system_matrix(), this->mtx);
+    auto inner_mtx = gko::as<gko::matrix::Dense<inner_value_type>>(
+        ir_solver->get_inner_system_matrix());
+    GKO_ASSERT_MTX_NEAR(inner_mtx, this->mtx, 0.0);
+    ASSERT_NE(std::dynamic_pointer_cast<
+                  const gko::solver::Gmres<inner_value_type>>(
+                  ir_solver->get_inner_solver()),
+              nullptr);
+    ASSERT_EQ(ir_solver->get_fallback_solver(), nullptr);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, ConvertsSparseSystemMatrixToInnerPrecision)
+{
+    using value_type = typename TestFixture::value_type;
+    using inner_value_type = typename TestFixture::inner_value_type;
+    auto csr = gko::share(gko::matrix::Csr<value_type, gko::int64>::create(
+        this->exec));
+    this->mtx->convert_to(csr);
+
+    auto solver = this->ir_factory->generate(csr);
+
+    auto inner_mtx = gko::as<gko::matrix::Csr<inner_value_type, gko::int64>>(
+        solver->get_inner_system_matrix());
+    GKO_ASSERT_MTX_NEAR(inner_mtx, this->mtx, 0.0);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, CanSetInnerSolverInFactory)
+{
+    using Solver = typename TestFixture::Solver;
+    using inner_value_type = typename TestFixture::inner_value_type;
+    using InnerSolver = gko::solver::Cg<inner_value_type>;
+    auto ir_factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_solver(InnerSolver::build().with_criteria(
+                gko::stop::Iteration::build().with_max_iters(3u)))
+            .on(this->exec);
+
+    auto solver = ir_factory->generate(this->mtx);
+
+    auto inner_solver = gko::as<InnerSolver>(solver->get_inner_solver());
+    ASSERT_EQ(inner_solver->get_system_matrix(),
+              solver->get_inner_system_matrix());
+}
+
+
+TYPED_TEST(MixedPrecisionIr, CanBeCloned)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Solver = typename TestFixture::Solver;
+
+    auto clone = this->solver->clone();
+
+    ASSERT_EQ(clone->get_size(), gko::dim<2>(3, 3));
+    auto clone_solver = static_cast<Solver*>(clone.get());
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(clone_solver->get_system_matrix()),
+                        this->mtx, 0.0);
+    ASSERT_NE(clone_solver->get_inner_solver(), nullptr);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, CanBeCleared)
+{
+    using Solver = typename TestFixture::Solver;
+
+    this->solver->clear();
+
+    ASSERT_EQ(this->solver->get_size(), gko::dim<2>(0, 0));
+    auto ir_solver = static_cast<Solver*>(this->solver.get());
+    ASSERT_EQ(ir_solver->get_system_matrix(), nullptr);
+    ASSERT_EQ(ir_solver->get_inner_solver(), nullptr);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, ThrowsOnRectangularMatrixInFactory)
+{
+    using Mtx = typename TestFixture::Mtx;
+    std::shared_ptr<Mtx> rectangular_mtx =
+        Mtx::create(this->exec, gko::dim<2>{1, 2});
+
+    ASSERT_THROW(this->ir_factory->generate(rectangular_mtx),
+                 gko::DimensionMismatch);
+}
+
+
+}  // namespace
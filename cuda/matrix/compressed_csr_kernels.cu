@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/compressed_csr_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace cuda {
+/**
+ * @brief The compressed-value CSR matrix format namespace.
+ *
+ * @ingroup compressed_csr
+ */
+namespace compressed_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const CudaExecutor> exec,
+          const matrix::CompressedCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b,
+          matrix::Dense<ValueType>* c) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const CudaExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::CompressedCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compress(std::shared_ptr<const CudaExecutor> exec,
+              const matrix::Csr<ValueType, IndexType>* source,
+              matrix::CompressedCsr<ValueType, IndexType>* result)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_COMPRESS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void decompress(std::shared_ptr<const CudaExecutor> exec,
+                const matrix::CompressedCsr<ValueType, IndexType>* source,
+                matrix::Csr<ValueType, IndexType>* result)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_DECOMPRESS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_index_outliers(std::shared_ptr<const CudaExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType>* source,
+                          matrix::CompressedCsr<ValueType, IndexType>* result)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_COUNT_INDEX_OUTLIERS_KERNEL);
+
+
+}  // namespace compressed_csr
+}  // namespace cuda
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/multi_color_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace dpcpp {
+/**
+ * @brief The multi-color reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace multi_color {
+
+
+template <typename IndexType>
+void compute_coloring(std::shared_ptr<const DpcppExecutor> exec,
+                      IndexType num_vertices, const IndexType* row_ptrs,
+                      const IndexType* col_idxs,
+                      gko::experimental::reorder::multi_color_distance distance,
+                      IndexType* colors) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_MULTI_COLOR_COMPUTE_COLORING_KERNEL);
+
+
+}  // namespace multi_color
+}  // namespace dpcpp
+}  // namespace kernels
+}  // namespace gko
@@ -660,6 +660,21 @@ public:
         this->run(op);
     }
 
+    /**
+     * Runs the specified Operation using this Executor, after reporting its
+     * nominal amount of work to the loggers.
+     *
+     * @param op  the operation to run
+     * @param flops  the number of floating point operations performed by op
+     * @param bytes  the number of bytes op reads from and writes to memory
+     */
+    void run(const Operation& op, size_type flops, size_type bytes) const
+    {
+        this->template log<log::Logger::operation_work_reported>(this, &op,
+                                                                 flops, bytes);
+        this->run(op);
+    }
+
     /**
      * Allocates memory in this Executor.
      *
@@ -1367,6 +1382,14 @@ public:
 
     static int get_num_omp_threads();
 
+    /**
+     * Sets the number of OpenMP threads used by the parallel regions the
+     * calling thread starts afterwards.
+     *
+     * @param num_threads  the number of threads
+     */
+    static void set_num_omp_threads(int num_threads);
+
     scoped_device_id_guard get_scoped_device_id_guard() const override;
 
 protected:
@@ -1414,6 +1437,8 @@ using DefaultExecutor = OmpExecutor;
  */
 class ReferenceExecutor : public OmpExecutor {
 public:
+    using Executor::run;
+
     static std::shared_ptr<ReferenceExecutor> create(
         std::shared_ptr<CpuAllocatorBase> alloc =
             std::make_shared<CpuAllocator>())
@@ -6,8 +6,16 @@
 #define GKO_PUBLIC_CORE_BASE_MEMORY_HPP_
 
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
 #include <ginkgo/core/base/fwd_decls.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
 
 
 namespace gko {
@@ -96,6 +104,128 @@ public:
 };
 
 
+/**
+ * Allocator for OmpExecutor that returns aligned memory whose pages are first
+ * touched in parallel by the OpenMP threads.
+ *
+ * Each thread touches a contiguous chunk of the allocation, which matches the
+ * static schedule of the OpenMP kernels, so on first-touch systems the pages
+ * are placed on the NUMA node of the thread that later accesses them.
+ * Optionally, the OpenMP threads can be bound to the cores reported by
+ * machine_topology to keep them from migrating between NUMA nodes, and the
+ * allocation can use transparent huge pages.
+ *
+ * @note The allocation is filled with zero bytes by the first touch.
+ */
+class NumaCpuAllocator : public CpuAllocatorBase {
+public:
+    /** The alignment used for huge pages. */
+    static constexpr size_type huge_page_size = size_type{1} << 21;
+
+    void* allocate(size_type num_bytes) override;
+
+    void deallocate(void* ptr) override;
+
+    /** Returns the alignment of the allocations in bytes. */
+    size_type get_alignment() const { return alignment_; }
+
+    /**
+     * Creates a NUMA-aware allocator.
+     *
+     * @param alignment  the alignment of the allocations in bytes, has to be a
+     *                   power of two
+     * @param use_huge_pages  whether to request transparent huge pages, this
+     *                        raises the alignment to huge_page_size
+     * @param bind_threads  whether to bind each OpenMP thread to a core
+     */
+    NumaCpuAllocator(size_type alignment = 64, bool use_huge_pages = false,
+                     bool bind_threads = false);
+
+private:
+    size_type alignment_;
+    bool use_huge_pages_;
+};
+
+
+/**
+ * Allocator for OmpExecutor and ReferenceExecutor that keeps freed blocks in
+ * size classes to serve later allocations without going back to the system
+ * allocator.
+ *
+ * Allocation sizes are rounded up to the next power of two, starting at
+ * min_block_size. Freed blocks are kept in the cache of their size class as
+ * long as the total amount of cached memory stays below max_cached_bytes,
+ * allocations larger than max_block_size are always forwarded to the upstream
+ * allocator. The allocator is thread-safe.
+ *
+ * Every allocation emits a cached_allocation_completed event to the loggers
+ * attached to the allocator, and the accumulated hit/miss statistics can be
+ * queried with get_statistics().
+ */
+class CachingCpuAllocator
+    : public CpuAllocatorBase,
+      public log::EnableLogging<CachingCpuAllocator> {
+public:
+    /** The smallest size class in bytes. */
+    static constexpr size_type min_block_size = 256;
+
+    /**
+     * The statistics of a CachingCpuAllocator.
+     */
+    struct statistics {
+        /** The number of allocations served from the cache. */
+        size_type num_hits;
+        /** The number of allocations forwarded to the upstream allocator. */
+        size_type num_misses;
+        /** The number of bytes currently kept in the cache. */
+        size_type cached_bytes;
+        /** The number of bytes currently handed out to the user. */
+        size_type used_bytes;
+    };
+
+    void* allocate(size_type num_bytes) override;
+
+    void deallocate(void* ptr) override;
+
+    /**
+     * Releases cached blocks to the upstream allocator until at most
+     * max_cached_bytes are kept in the cache.
+     *
+     * @param max_cached_bytes  the number of cached bytes to retain
+     */
+    void trim(size_type max_cached_bytes = 0);
+
+    /** Returns the current statistics of the allocator. */
+    statistics get_statistics() const;
+
+    /**
+     * Creates a caching allocator.
+     *
+     * @param max_cached_bytes  the maximum number of bytes kept in the cache
+     * @param max_block_size  allocations larger than this are not cached
+     * @param upstream  the allocator used for cache misses
+     */
+    CachingCpuAllocator(
+        size_type max_cached_bytes = size_type{1} << 30,
+        size_type max_block_size = size_type{1} << 28,
+        std::shared_ptr<CpuAllocatorBase> upstream =
+            std::make_shared<CpuAllocator>());
+
+    ~CachingCpuAllocator() override;
+
+private:
+    size_type max_cached_bytes_;
+    size_type max_block_size_;
+    std::shared_ptr<CpuAllocatorBase> upstream_;
+    mutable std::mutex mutex_;
+    // free blocks of each size class
+    std::vector<std::vector<void*>> free_blocks_;
+    // size in bytes of every block handed out and whether it can be cached
+    std::unordered_map<void*, std::pair<size_type, bool>> block_sizes_;
+    statistics stats_;
+};
+
+
 /**
  * Allocator using cudaMalloc.
  */
@@ -369,6 +369,19 @@ public:
         return status;
     }
 
+    /**
+     * Checks whether the communication of this request has completed
+     * (MPI_Test). Unlike wait, this does not block.
+     *
+     * @return  true if the communication has completed.
+     */
+    bool test()
+    {
+        int flag = 0;
+        GKO_ASSERT_NO_MPI_ERRORS(MPI_Test(&req_, &flag, MPI_STATUS_IGNORE));
+        return flag;
+    }
+
 
 private:
     MPI_Request req_;
@@ -6,7 +6,10 @@
 #define GKO_PUBLIC_CORE_BASE_MTX_IO_HPP_
 
 
+#include <functional>
 #include <istream>
+#include <memory>
+#include <string>
 
 
 #include <ginkgo/core/base/matrix_data.hpp>
@@ -87,6 +90,51 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 matrix_data<ValueType, IndexType> read_generic_raw(std::istream& is);
 
 
+/**
+ * Reads a matrix stored in matrix market format from a file using multiple
+ * threads.
+ *
+ * The file is memory-mapped if the platform supports it and its entries are
+ * split at line boundaries between the threads, which parse and sort them
+ * independently. Only the coordinate layout is parsed in parallel.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param filename  the path of the file to read
+ * @param num_threads  the number of threads to use, 0 uses the number of
+ *                     hardware threads
+ *
+ * @return A matrix_data structure containing the matrix. The nonzero elements
+ *         are sorted in lexicographic order of their (row, column) indexes.
+ *
+ * @note This is an advanced routine that will return the raw matrix data
+ *       structure. Consider using gko::read instead.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+matrix_data<ValueType, IndexType> read_raw_parallel(const std::string& filename,
+                                                    size_type num_threads = 0);
+
+
+/**
+ * Reads a matrix stored in either binary or matrix market format from a file.
+ * Matrix market files are read with read_raw_parallel.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param filename  the path of the file to read
+ * @param num_threads  the number of threads to use, 0 uses the number of
+ *                     hardware threads
+ *
+ * @return A matrix_data structure containing the matrix. The nonzero elements
+ *         are sorted in lexicographic order of their (row, column) indexes.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+matrix_data<ValueType, IndexType> read_generic_raw_parallel(
+    const std::string& filename, size_type num_threads = 0);
+
+
 /**
  * Specifies the layout type when writing data in matrix market format.
  */
@@ -217,9 +265,20 @@ inline std::unique_ptr<MatrixType> read_generic(StreamType&& is,
 }
 
 
+class Executor;
+
+
+template <typename ValueType, typename IndexType>
+class device_matrix_data;
+
+
 namespace matrix {
 
 
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
 template <typename ValueType>
 class Dense;
 
@@ -236,6 +295,119 @@ class Fft3;
 }  // namespace matrix
 
 
+/**
+ * Reads a matrix stored in matrix market format from an input stream in
+ * chunks of bounded size.
+ *
+ * For coordinate layout files, at most chunk_size entries are kept in memory
+ * at the same time before they are passed to fn. Array layout files are read
+ * completely before they are split into chunks.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param is  input stream from which to read the data
+ * @param exec  the executor to store the chunks on
+ * @param chunk_size  the maximum number of entries in a chunk
+ * @param fn  the function called with each chunk in file order. The size of
+ *            every chunk is the size of the whole matrix.
+ */
+template <typename ValueType, typename IndexType>
+void read_raw_chunked(
+    std::istream& is, std::shared_ptr<const Executor> exec,
+    size_type chunk_size,
+    std::function<void(const device_matrix_data<ValueType, IndexType>&)> fn);
+
+
+/**
+ * Reads a matrix stored in matrix market format from an input stream directly
+ * into a device_matrix_data.
+ *
+ * The entries are read in chunks of chunk_size entries and copied into the
+ * result on exec, so no matrix_data holding all entries is created.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param exec  the executor to store the data on
+ * @param is  input stream from which to read the data
+ * @param chunk_size  the maximum number of entries read at once
+ *
+ * @return the matrix data, sorted in row-major order.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+device_matrix_data<ValueType, IndexType> read_device_raw(
+    std::shared_ptr<const Executor> exec, std::istream& is,
+    size_type chunk_size = size_type{1} << 20);
+
+
+/**
+ * Reads a matrix stored in matrix market format from a seekable input stream
+ * into a Csr matrix.
+ *
+ * The stream is read twice in chunks of chunk_size entries: the first pass
+ * counts the entries in each row, the second pass places them in the Csr
+ * arrays. Apart from the current chunk, the peak memory consumption is thus
+ * the size of the resulting matrix.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param exec  the executor to create the matrix on
+ * @param is  seekable input stream from which to read the data
+ * @param chunk_size  the maximum number of entries read at once
+ *
+ * @return the Csr matrix with sorted column indices.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_csr(
+    std::shared_ptr<const Executor> exec, std::istream& is,
+    size_type chunk_size = size_type{1} << 20);
+
+
+/**
+ * Writes a Csr matrix to an output stream in Ginkgo's binary CSR format.
+ *
+ * The format consists of a 64 byte header storing a magic number encoding the
+ * value and index type, the format version, the matrix dimensions, the number
+ * of stored elements and the offsets of the row pointers, column indices and
+ * values arrays. The arrays are stored in this order in native byte order,
+ * each of them starting at an offset that is a multiple of 64 bytes.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param os  output stream where the data is to be written
+ * @param mtx  the matrix to write
+ */
+template <typename ValueType, typename IndexType>
+void write_binary_csr(std::ostream& os,
+                      const matrix::Csr<ValueType, IndexType>* mtx);
+
+
+/**
+ * Reads a Csr matrix stored in Ginkgo's binary CSR format from a file.
+ *
+ * The file is memory-mapped if the platform supports it. If the file stores
+ * the requested value and index type and exec is a host executor, the arrays
+ * of the matrix point directly into the mapping, which stays alive as long as
+ * the matrix does. Pages are only loaded when they are accessed, and they are
+ * shared with other processes mapping the same file until they are modified.
+ * Otherwise, the data is converted or copied to exec.
+ *
+ * @tparam ValueType  type of matrix values
+ * @tparam IndexType  type of matrix indexes
+ *
+ * @param exec  the executor to create the matrix on
+ * @param filename  the path of the file to read
+ *
+ * @return the Csr matrix stored in the file.
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+std::unique_ptr<matrix::Csr<ValueType, IndexType>> read_binary_csr(
+    std::shared_ptr<const Executor> exec, const std::string& filename);
+
+
 namespace detail {
 
 
@@ -43,6 +43,13 @@ class Pgm;
 namespace detail {
 
 
+class progress_thread;
+
+
+template <typename ValueType, typename LocalIndexType, typename GlobalIndexType>
+struct distributed_spgemm_plan;
+
+
 /**
  * Helper struct to test if the Builder type has a function create<ValueType,
  * IndexType>(std::shared_ptr<const Executor>).
@@ -138,6 +145,24 @@ template <typename ValueType>
 class Vector;
 
 
+/**
+ * Specifies how Matrix::read_distributed handles entries of rows that are not
+ * owned by the calling process.
+ */
+enum class assembly_mode {
+    /**
+     * Entries of rows owned by other processes are discarded.
+     */
+    local_only,
+    /**
+     * Entries of rows owned by other processes are summed up locally and
+     * sent to their owners in bounded-size chunks, where they are added to
+     * the owner's entries.
+     */
+    communicate
+};
+
+
 /**
  * The Matrix class defines a (MPI-)distributed matrix.
  *
@@ -236,6 +261,11 @@ class Vector;
  * // Applying to distributed multi-vectors computes an SpMV/SpMM product
  * A->apply(b, x)              // x = A*b
  * A->apply(alpha, b, beta, x) // x = alpha*A*b + beta*x
+ *
+ * // Distributed sparse matrix products and transposes
+ * auto C = A->multiply(B);    // C = A*B
+ * A->multiply_numeric(B, C);  // C = A*B, reusing the structure of C
+ * auto At = A->transpose();   // At = A^T
  * ```
  *
  * @tparam ValueType  The underlying value type.
@@ -249,6 +279,7 @@ class Matrix
           Matrix<ValueType, LocalIndexType, GlobalIndexType>>,
       public ConvertibleTo<
           Matrix<next_precision<ValueType>, LocalIndexType, GlobalIndexType>>,
+      public Transposable,
       public DistributedBase {
     friend class EnableDistributedPolymorphicObject<Matrix, LinOp>;
     friend class Matrix<next_precision<ValueType>, LocalIndexType,
@@ -264,6 +295,12 @@ public:
         gko::experimental::distributed::Vector<ValueType>;
     using local_vector_type = typename global_vector_type::local_vector_type;
 
+    /**
+     * The default maximum number of entries sent to a single process at once
+     * by read_distributed with assembly_mode::communicate.
+     */
+    static constexpr size_type default_assembly_chunk_size = 1 << 16;
+
     using EnableDistributedLinOp<Matrix>::convert_to;
     using EnableDistributedLinOp<Matrix>::move_to;
     using ConvertibleTo<Matrix<next_precision<ValueType>, LocalIndexType,
@@ -286,17 +323,23 @@ public:
      * are ignored.
      *
      * @note The matrix data can contain entries for rows other than those owned
-     *        by the process. Entries for those rows are discarded.
+     *        by the process. Depending on assembly_type, entries for those rows
+     *        are discarded or communicated to their owners.
      *
      * @param data  The device_matrix_data structure.
      * @param partition  The global row and column partition.
+     * @param assembly_type  How entries of non-owned rows are handled.
+     * @param chunk_size  The maximum number of entries sent to a single
+     *                    process at once with assembly_mode::communicate.
      *
      * @return the index_map induced by the partitions and the matrix structure
      */
     void read_distributed(
         const device_matrix_data<value_type, global_index_type>& data,
         std::shared_ptr<const Partition<local_index_type, global_index_type>>
-            partition);
+            partition,
+        assembly_mode assembly_type = assembly_mode::local_only,
+        size_type chunk_size = default_assembly_chunk_size);
 
     /**
      * Reads a square matrix from the matrix_data structure and a global
@@ -310,7 +353,9 @@ public:
     void read_distributed(
         const matrix_data<value_type, global_index_type>& data,
         std::shared_ptr<const Partition<local_index_type, global_index_type>>
-            partition);
+            partition,
+        assembly_mode assembly_type = assembly_mode::local_only,
+        size_type chunk_size = default_assembly_chunk_size);
 
     /**
      * Reads a matrix from the device_matrix_data structure, a global row
@@ -321,11 +366,18 @@ public:
      * and columns of the device_matrix_data are ignored.
      *
      * @note The matrix data can contain entries for rows other than those owned
-     *        by the process. Entries for those rows are discarded.
+     *        by the process. Depending on assembly_type, entries for those rows
+     *        are discarded or communicated to their owners. The communication
+     *        only involves processes that exchange entries, and every message
+     *        carries at most chunk_size entries, which bounds the additional
+     *        memory needed for the exchange.
      *
      * @param data  The device_matrix_data structure.
      * @param row_partition  The global row partition.
      * @param col_partition  The global col partition.
+     * @param assembly_type  How entries of non-owned rows are handled.
+     * @param chunk_size  The maximum number of entries sent to a single
+     *                    process at once with assembly_mode::communicate.
      *
      * @return the index_map induced by the partitions and the matrix structure
      */
@@ -334,7 +386,9 @@ public:
         std::shared_ptr<const Partition<local_index_type, global_index_type>>
             row_partition,
         std::shared_ptr<const Partition<local_index_type, global_index_type>>
-            col_partition);
+            col_partition,
+        assembly_mode assembly_type = assembly_mode::local_only,
+        size_type chunk_size = default_assembly_chunk_size);
 
     /**
      * Reads a matrix from the matrix_data structure, a global row partition,
@@ -350,7 +404,9 @@ public:
         std::shared_ptr<const Partition<local_index_type, global_index_type>>
             row_partition,
         std::shared_ptr<const Partition<local_index_type, global_index_type>>
-            col_partition);
+            col_partition,
+        assembly_mode assembly_type = assembly_mode::local_only,
+        size_type chunk_size = default_assembly_chunk_size);
 
     /**
      * Get read access to the stored local matrix.
@@ -369,6 +425,135 @@ public:
         return non_local_mtx_;
     }
 
+    /**
+     * Get the offsets of the non-local columns received from each rank.
+     *
+     * The columns of the non-local matrix are grouped by their owning rank, so
+     * the columns `[offsets[i], offsets[i + 1])` belong to rank `i`.
+     *
+     * @return  the receive offsets, with `comm.size() + 1` entries
+     */
+    const std::vector<comm_index_type>& get_recv_offsets() const
+    {
+        return recv_offsets_;
+    }
+
+    /**
+     * Exchanges the ghost rows of a local multi-vector, i.e. the rows that
+     * correspond to the columns of the non-local matrix.
+     *
+     * This is a blocking, collective operation that uses the same
+     * communication pattern as the SpMV.
+     *
+     * @param local_b  the local rows of a multi-vector, with the number of rows
+     *                 of the local matrix. The number of columns has to be the
+     *                 same on all ranks.
+     *
+     * @return  a multi-vector containing the received rows, ordered like the
+     *          columns of the non-local matrix
+     */
+    std::unique_ptr<local_vector_type> exchange_ghost_rows(
+        ptr_param<const local_vector_type> local_b) const;
+
+    /**
+     * Get the row partition the matrix was read with.
+     *
+     * @return  the row partition, or nullptr if the matrix was not created by
+     *          read_distributed
+     */
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+    get_row_partition() const
+    {
+        return row_partition_;
+    }
+
+    /**
+     * Get the column partition the matrix was read with.
+     *
+     * @return  the column partition, or nullptr if the matrix was not created
+     *          by read_distributed
+     */
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+    get_col_partition() const
+    {
+        return col_partition_;
+    }
+
+    /**
+     * Computes the distributed sparse matrix product `this * b`.
+     *
+     * The rows of b that correspond to the non-local columns of this matrix
+     * are received from their owners using the communication pattern of the
+     * SpMV, afterwards the product is computed by the Csr SpGEMM of the
+     * local and non-local blocks. The result uses the row partition of this
+     * matrix and the column partition of b, and stores Csr matrices.
+     *
+     * The communication pattern and the sparsity pattern of the product are
+     * kept in the result, so multiply_numeric can recompute the values of a
+     * product with the same sparsity patterns.
+     *
+     * @note Both matrices have to be created by read_distributed, and the
+     *       column partition of this matrix has to match the row partition
+     *       of b.
+     *
+     * @param b  the right-hand side factor
+     *
+     * @return  the product
+     */
+    std::unique_ptr<Matrix> multiply(ptr_param<const Matrix> b) const;
+
+    /**
+     * Recomputes the values of a product `result = this * b`, where result was
+     * created by multiply from matrices with the same sparsity patterns as
+     * this and b.
+     *
+     * Only the values of b are communicated, the index exchange and the setup
+     * of the result structure are skipped.
+     *
+     * @param b  the right-hand side factor
+     * @param result  the product computed by a previous call to multiply
+     */
+    void multiply_numeric(ptr_param<const Matrix> b,
+                          ptr_param<Matrix> result) const;
+
+    /**
+     * @copydoc Transposable::transpose
+     *
+     * The result uses the column partition of this matrix as row partition
+     * and vice versa. The entries are sent to the owners of their transposed
+     * rows like in read_distributed with assembly_mode::communicate.
+     *
+     * @note The matrix has to be created by read_distributed.
+     */
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    /**
+     * Enables or disables a dedicated thread that drives the progress of the
+     * non-blocking halo exchange during apply.
+     *
+     * While the local block is applied with one OpenMP thread less, the
+     * progress thread keeps testing the pending exchange. The non-local block,
+     * which contains the couplings of the boundary rows, is applied once the
+     * exchange has completed.
+     * This only has an effect on an OmpExecutor if MPI was initialized with at
+     * least MPI_THREAD_SERIALIZED, otherwise apply behaves as before.
+     *
+     * @param enabled  whether apply should use a progress thread
+     */
+    void set_progress_thread(bool enabled);
+
+    /**
+     * Checks whether apply uses a progress thread.
+     *
+     * @return  true if set_progress_thread was enabled and is supported
+     */
+    bool has_progress_thread() const noexcept
+    {
+        return progress_thread_ != nullptr;
+    }
+
     /**
      * Copy constructs a Matrix.
      *
@@ -606,6 +791,14 @@ protected:
      */
     mpi::request communicate(const local_vector_type* local_b) const;
 
+    /**
+     * Runs local_apply while the communication of req is in flight and waits
+     * for the communication afterwards. If enabled, the progress thread drives
+     * the communication in the meantime.
+     */
+    template <typename Func>
+    void overlap_communication(mpi::request& req, Func&& local_apply) const;
+
     void apply_impl(const LinOp* b, LinOp* x) const override;
 
     void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
@@ -625,6 +818,14 @@ private:
     gko::detail::DenseCache<value_type> recv_buffer_;
     std::shared_ptr<LinOp> local_mtx_;
     std::shared_ptr<LinOp> non_local_mtx_;
+    std::shared_ptr<gko::detail::progress_thread> progress_thread_;
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+        row_partition_;
+    std::shared_ptr<const Partition<local_index_type, global_index_type>>
+        col_partition_;
+    std::shared_ptr<const gko::detail::distributed_spgemm_plan<
+        value_type, local_index_type, global_index_type>>
+        spgemm_plan_;
 };
 
 
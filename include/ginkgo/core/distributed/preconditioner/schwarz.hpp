@@ -12,8 +12,13 @@
 #if GINKGO_BUILD_MPI
 
 
+#include <vector>
+
+
 #include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/dense_cache.hpp>
 #include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/mpi.hpp>
 #include <ginkgo/core/distributed/matrix.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
 
@@ -37,7 +42,26 @@ namespace preconditioner {
  * See Iterative Methods for Sparse Linear Systems (Y. Saad) for a general
  * treatment and variations of the method.
  *
- * @note Currently overlap and coarse grid correction are not supported (TODO).
+ * Optionally, an additive coarse-space correction can be added on top of the
+ * local subdomain solves, which makes the preconditioner a two-level method:
+ * ```
+ * M^{-1} = sum_i R_i^T A_i^{-1} R_i + Z (Z^H A Z)^{-1} Z^H
+ * ```
+ * Each column of the coarse basis `Z` is supported on a single subdomain. By
+ * default, the Nicolaides coarse space is used, i.e. one piecewise-constant
+ * basis vector per non-empty subdomain. Alternatively, each rank can provide
+ * its own local basis vectors, e.g. from local eigenproblems in a GenEO-style
+ * method. Without such a correction, the iteration count grows with the number
+ * of subdomains.
+ *
+ * The coarse matrix `Z^H A Z` is gathered onto rank 0 and solved there by the
+ * coarse solver, e.g. experimental::solver::Direct. Every application of the
+ * preconditioner thus gathers the restricted residual on rank 0, solves the
+ * coarse problem serially on that rank and scatters the coarse solution back,
+ * so the coarse problem size (number of ranks times number of local basis
+ * vectors) needs to stay small enough for a single rank.
+ *
+ * @note Currently overlap is not supported (TODO).
  *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  integral type of the preconditioner
@@ -74,6 +98,26 @@ public:
          */
         std::shared_ptr<const LinOp> GKO_FACTORY_PARAMETER_SCALAR(
             generated_local_solver, nullptr);
+
+        /**
+         * Coarse solver factory. If it is set, an additive coarse-space
+         * correction is applied in addition to the local solves. The coarse
+         * solver is generated from the gathered coarse matrix on rank 0 only.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_DEFERRED_FACTORY_PARAMETER(
+            coarse_solver);
+
+        /**
+         * Coarse basis, only used if a coarse solver is provided. The local
+         * vector of each rank contains the basis vectors supported on its
+         * subdomain, so each column of a local vector is a separate coarse
+         * basis vector. All ranks with a non-empty subdomain have to provide
+         * the same number of columns, ranks without local rows contribute no
+         * basis vectors. If it is not set, the Nicolaides coarse space with a
+         * single constant vector per subdomain is used.
+         */
+        std::shared_ptr<const Vector<ValueType>> GKO_FACTORY_PARAMETER_SCALAR(
+            coarse_basis, nullptr);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Schwarz, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -125,7 +169,39 @@ private:
      */
     void set_solver(std::shared_ptr<const LinOp> new_solver);
 
+    /**
+     * Generates the coarse basis, assembles the coarse matrix on rank 0 and
+     * generates the coarse solver from it.
+     *
+     * @param system_matrix  the distributed system matrix
+     */
+    void generate_coarse(
+        const Matrix<ValueType, LocalIndexType, GlobalIndexType>*
+            system_matrix);
+
+    /**
+     * Adds the coarse-space correction to the local solution.
+     *
+     * @param local_b  the local part of the right-hand side
+     * @param local_x  the local part of the solution, the correction is added
+     *                 to it
+     */
+    void apply_coarse(const gko::matrix::Dense<ValueType>* local_b,
+                      gko::matrix::Dense<ValueType>* local_x) const;
+
     std::shared_ptr<const LinOp> local_solver_;
+    std::shared_ptr<const LinOp> coarse_solver_;
+    std::shared_ptr<const gko::matrix::Dense<ValueType>> coarse_basis_;
+    std::shared_ptr<const gko::matrix::Dense<ValueType>> coarse_restriction_;
+    std::shared_ptr<const gko::matrix::Dense<ValueType>> coarse_one_;
+    // communicator of the system matrix, used for the coarse level
+    mpi::communicator coarse_comm_{MPI_COMM_NULL};
+    // offsets of the basis vectors of each rank in the coarse space
+    std::vector<comm_index_type> coarse_offsets_;
+    mutable gko::detail::DenseCache<ValueType> local_coarse_b_;
+    mutable gko::detail::DenseCache<ValueType> host_local_coarse_b_;
+    mutable gko::detail::DenseCache<ValueType> coarse_b_;
+    mutable gko::detail::DenseCache<ValueType> coarse_x_;
 };
 
 
@@ -23,6 +23,7 @@ namespace gko {
 /* Eliminate circular dependencies the hard way */
 template <typename ValueType>
 class array;
+class Allocator;
 class Executor;
 class LinOp;
 class LinOpFactory;
@@ -54,6 +55,13 @@ class Criterion;
 }  // namespace stop
 
 
+namespace solver {
+namespace cb_gmres {
+enum class storage_precision;
+}  // namespace cb_gmres
+}  // namespace solver
+
+
 namespace log {
 
 
@@ -580,6 +588,66 @@ protected:
         const array<int>& iters, const array<float>& residual_norms) const
     {}
 
+    /**
+     * Distributed multigrid level generated event.
+     *
+     * @param level  the multigrid level which generated the coarse operator
+     * @param coarse  the generated coarse operator
+     * @param num_active_ranks  the number of ranks owning coarse rows
+     * @param send_volume  the number of coarse vector entries this rank sends
+     *                     in one application of the coarse operator
+     * @param recv_volume  the number of coarse vector entries this rank
+     *                     receives in one application of the coarse operator
+     */
+    GKO_LOGGER_REGISTER_EVENT(27, multigrid_level_generated, const LinOp* level,
+                              const LinOp* coarse,
+                              const int& num_active_ranks,
+                              const size_type& send_volume,
+                              const size_type& recv_volume)
+
+    /**
+     * Caching allocator's allocation completed event.
+     *
+     * @param allocator  the allocator used
+     * @param num_bytes  the number of bytes allocated
+     * @param location  the address at which the data was allocated
+     * @param cache_hit  whether the allocation was served from the cache
+     */
+    GKO_LOGGER_REGISTER_EVENT(28, cached_allocation_completed,
+                              const Allocator* allocator,
+                              const size_type& num_bytes,
+                              const uintptr& location, const bool& cache_hit)
+
+    /**
+     * Executor's operation work reported event. It is emitted right before an
+     * operation is launched and describes the nominal amount of work the
+     * operation performs.
+     *
+     * @param exec  the executor used
+     * @param op  the operation to be launched
+     * @param flops  the number of floating point operations performed by op
+     * @param bytes  the number of bytes op reads from and writes to memory
+     */
+    GKO_LOGGER_REGISTER_EVENT(29, operation_work_reported, const Executor* exec,
+                              const Operation* op, const size_type& flops,
+                              const size_type& bytes)
+
+    /**
+     * Krylov basis storage precision selected event. It is emitted by an
+     * adaptive CB-GMRES solver whenever it starts storing the Krylov basis in
+     * a new precision, i.e. at the start of the solve and whenever it
+     * escalates the precision at a restart.
+     *
+     * @param solver  the solver used
+     * @param num_iterations  the number of iterations completed before the
+     *                        precision was selected
+     * @param precision  the storage precision used from now on
+     */
+    GKO_LOGGER_REGISTER_EVENT(
+        30, krylov_storage_precision_selected, const LinOp* solver,
+        const size_type& num_iterations,
+        const solver::cb_gmres::storage_precision& precision)
+
 public:
 #undef GKO_LOGGER_REGISTER_EVENT
 
@@ -595,7 +663,8 @@ public:
      * Bitset Mask which activates all operation events
      */
     static constexpr mask_type operation_events_mask =
-        operation_launched_mask | operation_completed_mask;
+        operation_launched_mask | operation_completed_mask |
+        operation_work_reported_mask;
 
     /**
      * Bitset Mask which activates all polymorphic object events
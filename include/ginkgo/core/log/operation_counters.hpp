@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_LOG_OPERATION_COUNTERS_HPP_
+#define GKO_PUBLIC_CORE_LOG_OPERATION_COUNTERS_HPP_
+
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/log/logger.hpp>
+
+
+namespace gko {
+namespace log {
+
+
+/**
+ * OperationCounters is a Logger with low overhead that can stay attached in
+ * production runs. It aggregates event counts, the number of bytes allocated
+ * and copied, and the time spent in each class of events. In addition, it keeps
+ * the count, time and reported work of every kernel separately, identified by
+ * the name of the Operation.
+ *
+ * Each thread logging events updates its own set of counters with relaxed
+ * atomic operations, so the only synchronization happens when a thread logs
+ * its first event. Apart from that first event, logging never allocates
+ * memory. The counters can be read at any time via get_snapshot() from any
+ * thread.
+ *
+ * Times are measured on the host with std::chrono::steady_clock, without
+ * synchronizing the executor. For asynchronous executors, they thus describe
+ * the time until the event returned control to the host.
+ *
+ * @ingroup log
+ */
+class OperationCounters : public Logger {
+public:
+    /** The classes of events that are counted and timed separately. */
+    enum class event_class {
+        /** Executor::alloc calls */
+        allocation,
+        /** Executor::free calls */
+        free,
+        /** Executor::copy_from calls */
+        copy,
+        /** Executor::run calls */
+        operation,
+        /** LinOp::apply calls, including the advanced apply */
+        apply,
+        /** LinOpFactory::generate calls */
+        generate,
+    };
+
+    /** The number of different event classes. */
+    static constexpr size_type num_event_classes = 6;
+
+    /** The counters for a single class of events. */
+    struct event_counter {
+        /** The number of events. */
+        size_type count{};
+        /**
+         * The total time spent in these events. Nested events of the same
+         * class are only counted once.
+         */
+        std::chrono::nanoseconds time{};
+    };
+
+    /** The counters for a single kind of Operation. */
+    struct operation_counter {
+        /** The name of the operation, see Operation::get_name(). */
+        std::string name;
+        /** The number of times the operation was run. */
+        size_type count{};
+        /** The total time spent running the operation. */
+        std::chrono::nanoseconds time{};
+        /** The number of floating point operations reported for all runs. */
+        size_type flops{};
+        /** The number of bytes moved reported for all runs. */
+        size_type bytes{};
+    };
+
+    /** The state of all counters at a single point in time. */
+    struct snapshot {
+        /** The counters for each event class, indexed by event_class. */
+        std::array<event_counter, num_event_classes> events;
+        /** The total number of bytes allocated. */
+        size_type bytes_allocated{};
+        /** The total number of bytes copied. */
+        size_type bytes_copied{};
+        /** The counters for each operation that was run, sorted by name. */
+        std::vector<operation_counter> operations;
+
+        /** Returns the counters for the given event class. */
+        const event_counter& operator[](event_class cls) const
+        {
+            return events[static_cast<size_type>(cls)];
+        }
+    };
+
+    /**
+     * The events logged by default: all executor, operation, LinOp and
+     * LinOpFactory events.
+     */
+    static constexpr mask_type default_mask =
+        executor_events_mask | operation_events_mask | linop_events_mask |
+        linop_factory_events_mask;
+
+    void on_allocation_started(const Executor* exec,
+                               const size_type& num_bytes) const override;
+
+    void on_allocation_completed(const Executor* exec,
+                                 const size_type& num_bytes,
+                                 const uintptr& location) const override;
+
+    void on_free_started(const Executor* exec,
+                         const uintptr& location) const override;
+
+    void on_free_completed(const Executor* exec,
+                           const uintptr& location) const override;
+
+    void on_copy_started(const Executor* from, const Executor* to,
+                         const uintptr& location_from,
+                         const uintptr& location_to,
+                         const size_type& num_bytes) const override;
+
+    void on_copy_completed(const Executor* from, const Executor* to,
+                           const uintptr& location_from,
+                           const uintptr& location_to,
+                           const size_type& num_bytes) const override;
+
+    void on_operation_launched(const Executor* exec,
+                               const Operation* operation) const override;
+
+    void on_operation_completed(const Executor* exec,
+                                const Operation* operation) const override;
+
+    void on_operation_work_reported(const Executor* exec,
+                                    const Operation* operation,
+                                    const size_type& flops,
+                                    const size_type& bytes) const override;
+
+    void on_linop_apply_started(const LinOp* A, const LinOp* b,
+                                const LinOp* x) const override;
+
+    void on_linop_apply_completed(const LinOp* A, const LinOp* b,
+                                  const LinOp* x) const override;
+
+    void on_linop_advanced_apply_started(const LinOp* A, const LinOp* alpha,
+                                         const LinOp* b, const LinOp* beta,
+                                         const LinOp* x) const override;
+
+    void on_linop_advanced_apply_completed(const LinOp* A, const LinOp* alpha,
+                                           const LinOp* b, const LinOp* beta,
+                                           const LinOp* x) const override;
+
+    void on_linop_factory_generate_started(const LinOpFactory* factory,
+                                           const LinOp* input) const override;
+
+    void on_linop_factory_generate_completed(
+        const LinOpFactory* factory, const LinOp* input,
+        const LinOp* output) const override;
+
+    bool needs_propagation() const override { return true; }
+
+    /**
+     * Returns the current state of all counters, summed over all threads.
+     *
+     * @param reset  if true, the counters are reset to zero while they are
+     *               read, so no event is lost between two snapshots.
+     */
+    snapshot get_snapshot(bool reset = false) const;
+
+    /** Resets all counters to zero. */
+    void reset() const;
+
+    /**
+     * Creates an OperationCounters logger.
+     *
+     * @param enabled_events  the events that should be counted
+     * @param max_operations  the maximum number of different operations each
+     *                        thread keeps separate counters for. Operations
+     *                        beyond that limit are combined in a single
+     *                        counter named "other".
+     *
+     * @return a shared pointer to the new logger
+     */
+    static std::shared_ptr<OperationCounters> create(
+        const mask_type& enabled_events = default_mask,
+        size_type max_operations = 256)
+    {
+        return std::shared_ptr<OperationCounters>(
+            new OperationCounters(enabled_events, max_operations));
+    }
+
+    ~OperationCounters() override;
+
+protected:
+    explicit OperationCounters(const mask_type& enabled_events,
+                               size_type max_operations);
+
+private:
+    struct thread_counters;
+
+    thread_counters& get_thread_counters() const;
+
+    uint64 id_;
+    size_type max_operations_;
+    mutable std::mutex mutex_;
+    mutable std::vector<std::unique_ptr<thread_counters>> threads_;
+};
+
+
+}  // namespace log
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_LOG_OPERATION_COUNTERS_HPP_
@@ -7,6 +7,7 @@
 
 
 #include <iostream>
+#include <string>
 #include <unordered_map>
 
 
@@ -60,6 +61,9 @@ public:
     using hook_function =
         std::function<void(const char*, profile_event_category)>;
 
+    using work_function =
+        std::function<void(const char*, size_type flops, size_type bytes)>;
+
     void on_allocation_started(const gko::Executor* exec,
                                const gko::size_type&) const override;
 
@@ -88,6 +92,11 @@ public:
     void on_operation_completed(const Executor* exec,
                                 const Operation* operation) const override;
 
+    void on_operation_work_reported(const Executor* exec,
+                                    const Operation* operation,
+                                    const size_type& flops,
+                                    const size_type& bytes) const override;
+
     /* PolymorphicObject events */
     void on_polymorphic_object_copy_started(
         const Executor* exec, const PolymorphicObject* from,
@@ -258,6 +267,16 @@ public:
         std::chrono::nanoseconds exclusive{0};
         /** The total number of invocations of the range. */
         int64 count{};
+        /**
+         * The total number of floating point operations reported for all
+         * invocations of the range.
+         */
+        size_type flops{};
+        /**
+         * The total number of bytes moved reported for all invocations of the
+         * range.
+         */
+        size_type bytes{};
     };
 
     struct nested_summary_entry {
@@ -269,6 +288,16 @@ public:
         int64 count{};
         /** The nested ranges inside this range. */
         std::vector<nested_summary_entry> children{};
+        /**
+         * The total number of floating point operations reported for all
+         * invocations of the range.
+         */
+        size_type flops{};
+        /**
+         * The total number of bytes moved reported for all invocations of the
+         * range.
+         */
+        size_type bytes{};
     };
 
     /** Receives the results from ProfilerHook::create_summary(). */
@@ -329,6 +358,37 @@ public:
         std::string header_;
     };
 
+    /**
+     * Writes the achieved throughput of all ranges from
+     * ProfilerHook::create_summary() with reported work, i.e. operations
+     * launched via Executor::run(op, flops, bytes), to an ASCII table in
+     * Markdown format.
+     */
+    class RooflineSummaryWriter : public SummaryWriter {
+    public:
+        /**
+         * Constructs a writer on an output stream.
+         *
+         * @param output  the output stream to write the table to.
+         * @param header  the header to write above the table.
+         * @param peak_bandwidth  the peak memory bandwidth of the hardware in
+         *                        GB/s. If it is positive, the table contains
+         *                        the fraction of the peak bandwidth achieved
+         *                        by each range.
+         */
+        RooflineSummaryWriter(std::ostream& output = std::cerr,
+                              std::string header = "Roofline summary",
+                              double peak_bandwidth = 0.0);
+
+        void write(const std::vector<summary_entry>& entries,
+                   std::chrono::nanoseconds overhead) override;
+
+    private:
+        std::ostream* output_;
+        std::string header_;
+        double peak_bandwidth_;
+    };
+
     /**
      * Creates a logger measuring the runtime of Ginkgo events and printing a
      * summary when it is destroyed.
@@ -374,6 +434,46 @@ public:
             std::make_unique<TableSummaryWriter>(),
         bool debug_check_nesting = false);
 
+    /**
+     * Creates a logger recording a timeline of Ginkgo events and writing it
+     * in the Chrome trace event JSON format, which can be displayed by
+     * Perfetto (ui.perfetto.dev) or chrome://tracing.
+     *
+     * Every thread emitting events gets its own track. The events are
+     * buffered in memory and written to the output whenever the buffer is
+     * full, and when the logger is destroyed.
+     *
+     * @param output  the output stream to write the trace to. It needs to
+     *                outlive the logger.
+     * @param process_id  the process ID the events are associated with, e.g.
+     *                    the MPI rank. Traces from different processes can be
+     *                    merged by concatenating their traceEvents arrays.
+     * @param max_buffered_events  the maximum number of events buffered in
+     *                             memory before they are written to output.
+     *
+     * @note The timestamps are taken on the host. For the ranges to match
+     *       the GPU kernel execution, enable synchronization via
+     *       `set_synchronization(true)`.
+     */
+    static std::shared_ptr<ProfilerHook> create_trace(
+        std::ostream& output, int process_id = 0,
+        size_type max_buffered_events = 1 << 16);
+
+    /**
+     * Creates a logger recording a timeline of Ginkgo events and writing it
+     * in the Chrome trace event JSON format to a file.
+     *
+     * @see create_trace(std::ostream&, int, size_type)
+     *
+     * @param filename  the path of the file to write the trace to.
+     * @param process_id  the process ID the events are associated with.
+     * @param max_buffered_events  the maximum number of events buffered in
+     *                             memory before they are written to the file.
+     */
+    static std::shared_ptr<ProfilerHook> create_trace(
+        const std::string& filename, int process_id = 0,
+        size_type max_buffered_events = 1 << 16);
+
     /**
      * Creates a logger annotating Ginkgo events with a custom set of functions
      * for range begin and end.
@@ -392,6 +492,7 @@ private:
     bool synchronize_;
     hook_function begin_hook_;
     hook_function end_hook_;
+    work_function work_hook_;
 };
 
 
@@ -90,6 +90,17 @@ struct operation_data {
 };
 
 
+/**
+ * Struct representing the nominal work of an Operation
+ */
+struct operation_work_data {
+    const Executor* exec;
+    const Operation* operation;
+    const size_type flops;
+    const size_type bytes;
+};
+
+
 /**
  * Struct representing PolymorphicObject related data
  */
@@ -157,6 +168,39 @@ struct linop_factory_data {
 };
 
 
+/**
+ * Struct representing distributed multigrid level related data
+ */
+struct multigrid_level_data {
+    const LinOp* level;
+    const LinOp* coarse;
+    const int num_active_ranks;
+    const size_type send_volume;
+    const size_type recv_volume;
+};
+
+
+/**
+ * Struct representing the Krylov basis storage precision selected by a solver
+ */
+struct krylov_storage_precision_data {
+    const LinOp* solver;
+    const size_type num_iterations;
+    const solver::cb_gmres::storage_precision precision;
+};
+
+
+/**
+ * Struct representing caching allocator related data
+ */
+struct cached_allocation_data {
+    const Allocator* allocator;
+    const size_type num_bytes;
+    const uintptr location;
+    const bool cache_hit;
+};
+
+
 /**
  * Struct representing Criterion related data
  */
@@ -230,6 +274,8 @@ public:
 
         std::deque<std::unique_ptr<operation_data>> operation_launched;
         std::deque<std::unique_ptr<operation_data>> operation_completed;
+        std::deque<std::unique_ptr<operation_work_data>>
+            operation_work_reported;
 
         std::deque<std::unique_ptr<polymorphic_object_data>>
             polymorphic_object_create_started;
@@ -260,6 +306,15 @@ public:
 
         std::deque<std::unique_ptr<iteration_complete_data>>
             iteration_completed;
+
+        std::deque<std::unique_ptr<multigrid_level_data>>
+            multigrid_level_generated;
+
+        std::deque<std::unique_ptr<krylov_storage_precision_data>>
+            krylov_storage_precision_selected;
+
+        std::deque<std::unique_ptr<cached_allocation_data>>
+            cached_allocation_completed;
     };
 
     /* Executor events */
@@ -293,6 +348,11 @@ public:
     void on_operation_completed(const Executor* exec,
                                 const Operation* operation) const override;
 
+    void on_operation_work_reported(const Executor* exec,
+                                    const Operation* operation,
+                                    const size_type& flops,
+                                    const size_type& bytes) const override;
+
     /* PolymorphicObject events */
     void on_polymorphic_object_create_started(
         const Executor* exec, const PolymorphicObject* po) const override;
@@ -391,6 +451,23 @@ public:
         const LinOp* residual_norm,
         const LinOp* implicit_sq_residual_norm) const override;
 
+    /* Multigrid events */
+    void on_multigrid_level_generated(
+        const LinOp* level, const LinOp* coarse, const int& num_active_ranks,
+        const size_type& send_volume,
+        const size_type& recv_volume) const override;
+
+    /* Krylov solver events */
+    void on_krylov_storage_precision_selected(
+        const LinOp* solver, const size_type& num_iterations,
+        const solver::cb_gmres::storage_precision& precision) const override;
+
+    /* Allocator events */
+    void on_cached_allocation_completed(const Allocator* allocator,
+                                        const size_type& num_bytes,
+                                        const uintptr& location,
+                                        const bool& cache_hit) const override;
+
     /**
      * Creates a Record logger. This dynamically allocates the memory,
      * constructs the object and returns an std::unique_ptr to this object.
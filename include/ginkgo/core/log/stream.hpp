@@ -61,6 +61,11 @@ public:
     void on_operation_completed(const Executor* exec,
                                 const Operation* operation) const override;
 
+    void on_operation_work_reported(const Executor* exec,
+                                    const Operation* operation,
+                                    const size_type& flops,
+                                    const size_type& bytes) const override;
+
     /* PolymorphicObject events */
     void on_polymorphic_object_create_started(
         const Executor*, const PolymorphicObject* po) const override;
@@ -153,6 +158,23 @@ public:
         const LinOp* residual_norm,
         const LinOp* implicit_sq_residual_norm) const override;
 
+    /* Multigrid events */
+    void on_multigrid_level_generated(
+        const LinOp* level, const LinOp* coarse, const int& num_active_ranks,
+        const size_type& send_volume,
+        const size_type& recv_volume) const override;
+
+    /* Krylov solver events */
+    void on_krylov_storage_precision_selected(
+        const LinOp* solver, const size_type& num_iterations,
+        const solver::cb_gmres::storage_precision& precision) const override;
+
+    /* Allocator events */
+    void on_cached_allocation_completed(const Allocator* allocator,
+                                        const size_type& num_bytes,
+                                        const uintptr& location,
+                                        const bool& cache_hit) const override;
+
     /**
      * Creates a Stream logger. This dynamically allocates the memory,
      * constructs the object and returns an std::unique_ptr to this object.
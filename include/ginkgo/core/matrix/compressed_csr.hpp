@@ -0,0 +1,436 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_COMPRESSED_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_COMPRESSED_CSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+template <typename ValueType>
+class Dense;
+
+
+namespace compressed_csr {
+
+
+/**
+ * Describes how the column indexes of a CompressedCsr matrix are stored.
+ *
+ * With delta compression, each column index is stored as its difference to
+ * the previous column index of the same row, or to the row index for the
+ * first entry of a row, using a signed 8 or 16 bit integer. Differences that
+ * don't fit are stored as the smallest value of that integer type (the escape
+ * value) and the full column index is stored in a separate outlier array.
+ * This works best for matrices whose nonzeros are close to the diagonal, e.g.
+ * after a bandwidth-reducing reordering like reorder::Rcm.
+ */
+enum class index_compression {
+    /** The column indexes are stored as IndexType. */
+    none,
+    /** The column indexes are stored as 8 bit differences. */
+    delta8,
+    /** The column indexes are stored as 16 bit differences. */
+    delta16
+};
+
+
+}  // namespace compressed_csr
+
+
+/**
+ * CompressedCsr is a CSR matrix whose values are stored in a lower precision
+ * than the precision used for the arithmetic operations.
+ *
+ * SpMV is usually limited by memory bandwidth, and the values make up most of
+ * the data read by a CSR SpMV. Storing them in a lower precision thus speeds
+ * up the SpMV, while the operator keeps the interface (and the value_type) of
+ * a full precision matrix: the stored values are converted to ValueType while
+ * they are read, and all products and sums are computed in ValueType. This is
+ * useful for operators whose accuracy is less important than their speed, for
+ * example within preconditioners or smoothers.
+ *
+ * The storage precision is given as a precision_reduction relative to
+ * ValueType, see the corresponding documentation for details. For a
+ * ValueType of `double`,
+ * - `precision_reduction(0, 1)` stores the values as `float`,
+ * - `precision_reduction(0, 2)` stores them as IEEE half precision,
+ * - `precision_reduction(1, 1)` stores them as `float` truncated to 16 bits,
+ *   which has the same format as bfloat16.
+ * Unsupported reductions fall back to storing the values in ValueType.
+ *
+ * Optionally, each row can be scaled by the largest absolute value of its
+ * entries before the values are compressed. This keeps the stored values in
+ * [-1, 1], which avoids overflow for storage formats with a smaller exponent
+ * range like half precision. The row scaling factors are stored in full
+ * precision and applied to the result of each row.
+ *
+ * The column indexes can additionally be stored as small differences, see
+ * compressed_csr::index_compression, which reduces the remaining index data
+ * read by the SpMV.
+ *
+ * @note Only the Reference and OpenMP executors provide kernels for this
+ *       format.
+ *
+ * @tparam ValueType  precision of the arithmetic operations and the vectors in
+ *                    apply
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class CompressedCsr
+    : public EnableLinOp<CompressedCsr<ValueType, IndexType>>,
+      public ConvertibleTo<Csr<ValueType, IndexType>>,
+      public ReadableFromMatrixData<ValueType, IndexType>,
+      public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<CompressedCsr, LinOp>;
+
+public:
+    using EnableLinOp<CompressedCsr>::convert_to;
+    using EnableLinOp<CompressedCsr>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using scale_type = remove_complex<ValueType>;
+    using csr_type = Csr<ValueType, IndexType>;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* result) const override;
+
+    void move_to(Csr<ValueType, IndexType>* result) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    /**
+     * Compresses a CSR matrix into this matrix, keeping the storage precision,
+     * row scaling and index compression settings of this matrix.
+     *
+     * @param source  the matrix to compress
+     */
+    void compress(const csr_type* source);
+
+    /**
+     * Returns how the column indexes are stored.
+     *
+     * @return how the column indexes are stored
+     */
+    compressed_csr::index_compression get_index_compression() const noexcept
+    {
+        return index_compression_;
+    }
+
+    /**
+     * Returns the precision the values are stored in, relative to ValueType.
+     *
+     * @return the storage precision of the values
+     */
+    precision_reduction get_storage_precision() const noexcept
+    {
+        return storage_precision_;
+    }
+
+    /**
+     * Returns the size in bytes of a single stored value.
+     *
+     * @return the size in bytes of a single stored value
+     */
+    size_type get_value_size() const noexcept { return value_size_; }
+
+    /**
+     * Returns true if the rows are scaled before compressing the values.
+     *
+     * @return true if the rows are scaled before compressing the values
+     */
+    bool is_row_scaled() const noexcept { return row_scaling_; }
+
+    /**
+     * Returns the compressed values of the matrix, i.e. the raw storage of
+     * get_num_stored_elements() values of get_value_size() bytes each.
+     *
+     * @return the compressed values of the matrix.
+     */
+    char* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc CompressedCsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const char* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the scaling factors of the rows, or nullptr if the rows are not
+     * scaled.
+     *
+     * @return the scaling factors of the rows.
+     */
+    scale_type* get_row_scales() noexcept
+    {
+        return row_scaling_ ? row_scales_.get_data() : nullptr;
+    }
+
+    /**
+     * @copydoc CompressedCsr::get_row_scales()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const scale_type* get_const_row_scales() const noexcept
+    {
+        return row_scaling_ ? row_scales_.get_const_data() : nullptr;
+    }
+
+    /**
+     * Returns the column indexes of the matrix, or nullptr if they are
+     * compressed.
+     *
+     * @return the column indexes of the matrix.
+     */
+    index_type* get_col_idxs() noexcept { return col_idxs_.get_data(); }
+
+    /**
+     * @copydoc CompressedCsr::get_col_idxs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the compressed column indexes of the matrix, i.e. the raw
+     * storage of get_num_stored_elements() differences of 1 or 2 bytes each,
+     * or nullptr if the column indexes are not compressed.
+     *
+     * @return the compressed column indexes of the matrix.
+     */
+    char* get_col_deltas() noexcept { return col_deltas_.get_data(); }
+
+    /**
+     * @copydoc CompressedCsr::get_col_deltas()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const char* get_const_col_deltas() const noexcept
+    {
+        return col_deltas_.get_const_data();
+    }
+
+    /**
+     * Returns the column indexes that could not be stored as differences, in
+     * the order of their entries.
+     *
+     * @return the outlier column indexes of the matrix.
+     */
+    index_type* get_outlier_cols() noexcept { return outlier_cols_.get_data(); }
+
+    /**
+     * @copydoc CompressedCsr::get_outlier_cols()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_outlier_cols() const noexcept
+    {
+        return outlier_cols_.get_const_data();
+    }
+
+    /**
+     * Returns the offsets of the first outlier column index of each row, or
+     * nullptr if the column indexes are not compressed.
+     *
+     * @return the outlier pointers of the matrix.
+     */
+    index_type* get_outlier_ptrs() noexcept { return outlier_ptrs_.get_data(); }
+
+    /**
+     * @copydoc CompressedCsr::get_outlier_ptrs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_outlier_ptrs() const noexcept
+    {
+        return outlier_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of column indexes stored in the outlier array.
+     *
+     * @return the number of outlier column indexes
+     */
+    size_type get_num_outliers() const noexcept
+    {
+        return outlier_cols_.get_size();
+    }
+
+    /**
+     * Returns the row pointers of the matrix.
+     *
+     * @return the row pointers of the matrix.
+     */
+    index_type* get_row_ptrs() noexcept { return row_ptrs_.get_data(); }
+
+    /**
+     * @copydoc CompressedCsr::get_row_ptrs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_size() / value_size_;
+    }
+
+    /**
+     * Creates an empty CompressedCsr matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param storage_precision  the precision the values are stored in,
+     *                           relative to ValueType
+     * @param row_scaling  whether the rows are scaled by the largest absolute
+     *                     value of their entries before compressing them
+     * @param index_compression  how the column indexes are stored
+     *
+     * @throw InvalidStateError  if storage_precision is
+     *                           precision_reduction::autodetect()
+     */
+    static std::unique_ptr<CompressedCsr> create(
+        std::shared_ptr<const Executor> exec,
+        precision_reduction storage_precision = precision_reduction(0, 1),
+        bool row_scaling = false,
+        compressed_csr::index_compression index_compression =
+            compressed_csr::index_compression::none);
+
+    /**
+     * Creates a CompressedCsr matrix from the values and sparsity pattern of
+     * a CSR matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param source  the matrix to compress
+     * @param storage_precision  the precision the values are stored in,
+     *                           relative to ValueType
+     * @param row_scaling  whether the rows are scaled by the largest absolute
+     *                     value of their entries before compressing them
+     * @param index_compression  how the column indexes are stored
+     *
+     * @throw InvalidStateError  if storage_precision is
+     *                           precision_reduction::autodetect()
+     */
+    static std::unique_ptr<CompressedCsr> create(
+        std::shared_ptr<const Executor> exec, const csr_type* source,
+        precision_reduction storage_precision = precision_reduction(0, 1),
+        bool row_scaling = false,
+        compressed_csr::index_compression index_compression =
+            compressed_csr::index_compression::none);
+
+    /**
+     * Copy-assigns a CompressedCsr matrix. Preserves executor, copies
+     * everything else.
+     */
+    CompressedCsr& operator=(const CompressedCsr&);
+
+    /**
+     * Move-assigns a CompressedCsr matrix. Preserves executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor and storage precision, no nonzeros and valid row
+     * pointers).
+     */
+    CompressedCsr& operator=(CompressedCsr&&);
+
+    /**
+     * Copy-constructs a CompressedCsr matrix. Inherits executor and data.
+     */
+    CompressedCsr(const CompressedCsr&);
+
+    /**
+     * Move-constructs a CompressedCsr matrix. Inherits executor, moves the
+     * data and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor and storage precision, no nonzeros and valid row
+     * pointers).
+     */
+    CompressedCsr(CompressedCsr&&);
+
+protected:
+    CompressedCsr(std::shared_ptr<const Executor> exec,
+                  precision_reduction storage_precision =
+                      precision_reduction(0, 1),
+                  bool row_scaling = false,
+                  compressed_csr::index_compression index_compression =
+                      compressed_csr::index_compression::none);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    precision_reduction storage_precision_;
+    size_type value_size_;
+    bool row_scaling_;
+    compressed_csr::index_compression index_compression_;
+    array<char> values_;
+    array<scale_type> row_scales_;
+    array<index_type> col_idxs_;
+    array<char> col_deltas_;
+    array<index_type> outlier_cols_;
+    array<index_type> outlier_ptrs_;
+    array<index_type> row_ptrs_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_COMPRESSED_CSR_HPP_
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_FORMAT_TUNER_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_FORMAT_TUNER_HPP_
+
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+/**
+ * FormatTuner selects the sparse matrix format and CSR strategy with the
+ * fastest SpMV for a given matrix on a given executor. It converts the matrix
+ * to each candidate format, times a few SpMVs with each of them and returns
+ * the matrix in the fastest format.
+ *
+ * The decisions are stored by a fingerprint of the matrix, consisting of the
+ * executor type, the value and index types, the matrix dimensions, the number
+ * of stored elements and a hash of the row pointers. If a cache file is given,
+ * the decisions are persisted there, so later runs with a matrix of the same
+ * sparsity pattern skip the timing runs.
+ *
+ * The supported candidate formats are
+ * - `csr_classical`, `csr_merge_path`, `csr_sparselib`: Csr with the
+ *   corresponding strategy,
+ * - `csr_load_balance`: Csr with the load_balance strategy, only considered on
+ *   GPU executors,
+ * - `coo`, `ell`, `sellp` and `hybrid`: the corresponding matrix format. Ell is
+ *   only considered if the longest row has at most `ell_imbalance_limit`
+ *   times as many entries as the average row.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup mat_formats
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class FormatTuner {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using csr_type = Csr<ValueType, IndexType>;
+
+    /** The outcome of a call to tune(). */
+    struct result {
+        /** The input matrix converted to the fastest format. */
+        std::unique_ptr<LinOp> matrix;
+        /** The name of the fastest format. */
+        std::string format;
+        /** true if the decision was taken from the cache without timing. */
+        bool cached;
+        /**
+         * The average SpMV time of each candidate format that was timed,
+         * empty if the decision was cached.
+         */
+        std::map<std::string, std::chrono::nanoseconds> timings;
+    };
+
+    /**
+     * Returns the names of all candidate formats supported by the tuner.
+     */
+    static std::vector<std::string> get_default_formats();
+
+    /**
+     * Computes the fingerprint that identifies decisions for this matrix in
+     * the cache.
+     *
+     * @param exec  the executor the decision is taken for
+     * @param mtx  the matrix
+     */
+    static std::string get_fingerprint(std::shared_ptr<const Executor> exec,
+                                       const csr_type* mtx);
+
+    /**
+     * Converts the matrix to the given format on the tuner's executor.
+     *
+     * @param format  the name of one of the supported formats
+     * @param mtx  the matrix to convert
+     *
+     * @return the converted matrix, or nullptr if the format is not
+     *         applicable to this matrix or executor.
+     */
+    std::unique_ptr<LinOp> convert(const std::string& format,
+                                   const csr_type* mtx) const;
+
+    /**
+     * Returns the matrix in the fastest format, either from the cache or by
+     * timing all candidate formats.
+     *
+     * @param mtx  the matrix to tune the format for
+     */
+    result tune(const csr_type* mtx);
+
+    /**
+     * Returns the decision for the given fingerprint, or an empty string if
+     * none has been taken yet.
+     */
+    std::string get_cached_format(const std::string& fingerprint) const;
+
+    /**
+     * Creates a FormatTuner.
+     *
+     * @param exec  the executor to tune the SpMV for
+     * @param cache_file  the file to read and store decisions. If it is empty,
+     *                    decisions are only kept in memory.
+     * @param warmup  the number of untimed SpMVs per candidate
+     * @param repetitions  the number of timed SpMVs per candidate
+     * @param formats  the names of the candidate formats
+     * @param ell_imbalance_limit  the maximum ratio between the longest and
+     *                             the average row length for Ell candidates
+     *
+     * @throw StreamError  if the cache file exists but can't be read
+     * @throw InvalidStateError  if a format name is not supported
+     */
+    explicit FormatTuner(
+        std::shared_ptr<const Executor> exec, std::string cache_file = {},
+        size_type warmup = 2, size_type repetitions = 10,
+        std::vector<std::string> formats = get_default_formats(),
+        double ell_imbalance_limit = 100.0);
+
+private:
+    void store(const std::string& fingerprint, const std::string& format);
+
+    std::shared_ptr<const Executor> exec_;
+    std::string cache_file_;
+    size_type warmup_;
+    size_type repetitions_;
+    std::vector<std::string> formats_;
+    double ell_imbalance_limit_;
+    std::map<std::string, std::string> decisions_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_FORMAT_TUNER_HPP_
@@ -41,6 +41,16 @@ namespace multigrid {
  * un-aggregated elements are assigned to an aggregated group
  * or are left alone.
  *
+ * For distributed matrices, the aggregation runs on the local block of each
+ * rank. Optionally, rows which are left alone on their rank can join an
+ * aggregate on a neighboring rank (cross_rank_aggregates), and coarse levels
+ * with few rows per rank can be agglomerated onto fewer ranks
+ * (agglomeration_threshold). The remaining ranks keep an empty local block of
+ * the coarse operator. The number of ranks owning coarse rows and the
+ * communication volume of the coarse operator are reported through the
+ * multigrid_level_generated event to the loggers of the factory and to the
+ * propagating loggers of the executor.
+ *
  * @tparam ValueType  precision of matrix elements
  * @tparam IndexType  precision of matrix indexes
  *
@@ -128,6 +138,25 @@ public:
          * incorrect.
          */
         bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * The minimum average number of coarse rows per rank. If a
+         * distributed coarse level has fewer rows per rank, it is agglomerated
+         * onto as many neighboring groups of ranks as needed to keep at least
+         * this number of rows on every rank owning coarse rows.
+         * A value of 0 disables the agglomeration. This parameter has no
+         * effect on non-distributed matrices.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(agglomeration_threshold, 0u);
+
+        /**
+         * Allow rows which are aggregated alone on their rank to join the
+         * aggregate of their strongest neighbor on another rank.
+         * Such rows are marked with -1 in the aggregate group, since their
+         * coarse row is not owned by this rank. This parameter has no effect
+         * on non-distributed matrices.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(cross_rank_aggregates, false);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Pgm, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -172,7 +201,8 @@ protected:
           EnableMultigridLevel<ValueType>(system_matrix),
           parameters_{factory->get_parameters()},
           system_matrix_{system_matrix},
-          agg_(factory->get_executor(), system_matrix_->get_size()[0])
+          agg_(factory->get_executor(), system_matrix_->get_size()[0]),
+          factory_loggers_{factory->get_loggers()}
     {
         GKO_ASSERT(parameters_.max_unassigned_ratio <= 1.0);
         GKO_ASSERT(parameters_.max_unassigned_ratio >= 0.0);
@@ -184,6 +214,15 @@ protected:
 
     void generate();
 
+    /**
+     * This function computes the aggregate group of the local matrix and
+     * stores it in agg_.
+     *
+     * @return the number of aggregates
+     */
+    IndexType compute_aggregates(
+        std::shared_ptr<const matrix::Csr<ValueType, IndexType>> local_matrix);
+
     /**
      * This function generates the local matrix coarsening operators.
      *
@@ -195,6 +234,27 @@ protected:
         std::shared_ptr<const matrix::Csr<ValueType, IndexType>> local_matrix);
 
 #if GINKGO_BUILD_MPI
+    /**
+     * This function generates the distributed coarsening operators from
+     * globally numbered aggregates. It supports cross-rank aggregates and
+     * the agglomeration of the coarse level onto fewer ranks.
+     */
+    template <typename GlobalIndexType>
+    void generate_redistributed(
+        std::shared_ptr<const experimental::distributed::Matrix<
+            ValueType, IndexType, GlobalIndexType>>
+            matrix);
+
+    /**
+     * Reports the rank count and communication volume of a distributed
+     * coarse operator through the multigrid_level_generated event.
+     */
+    template <typename GlobalIndexType>
+    void log_coarse_level(
+        std::shared_ptr<const experimental::distributed::Matrix<
+            ValueType, IndexType, GlobalIndexType>>
+            coarse);
+
     template <typename GlobalIndexType>
     void communicate(std::shared_ptr<const experimental::distributed::Matrix<
                          ValueType, IndexType, GlobalIndexType>>
@@ -206,6 +266,7 @@ protected:
 private:
     std::shared_ptr<const LinOp> system_matrix_{};
     array<IndexType> agg_;
+    std::vector<std::shared_ptr<const log::Logger>> factory_loggers_;
 };
 
 
@@ -30,6 +30,12 @@ namespace reorder {
  * Computes a Approximate Minimum Degree (AMD) reordering of an input
  * matrix.
  *
+ * On the OmpExecutor, the ordering is computed by a parallel multiple
+ * elimination variant of AMD, which eliminates an independent set of pivots
+ * of minimum degree at a time. Its result does not depend on the number of
+ * threads, but differs from the sequential AMD implementation of SuiteSparse
+ * used on all other executors, and usually leads to a higher fill-in.
+ *
  * @tparam IndexType  the type used to store sparsity pattern indices of the
  *                    system matrix
  */
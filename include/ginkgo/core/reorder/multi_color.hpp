@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_REORDER_MULTI_COLOR_HPP_
+#define GKO_PUBLIC_CORE_REORDER_MULTI_COLOR_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+
+
+/**
+ * The distance up to which rows of the same color may not be connected.
+ */
+enum class multi_color_distance {
+    /**
+     * Rows of the same color are not adjacent, i.e. a_ij = 0 for rows i, j of
+     * the same color. This suffices for Gauss-Seidel, SOR, ILU(0) and IC(0).
+     */
+    one,
+    /**
+     * Rows of the same color do not share any neighbor either, i.e. their
+     * nonzero patterns are disjoint.
+     */
+    two
+};
+
+
+/**
+ * MultiColor computes a graph coloring of the adjacency graph of a matrix and
+ * the permutation grouping the rows by color.
+ *
+ * Rows of the same color are not connected in the matrix, so the rows of each
+ * color of the permuted matrix form a diagonal block. Thus, Gauss-Seidel
+ * sweeps, ILU(0) or IC(0) factorizations and triangular solves of the permuted
+ * matrix can process all rows of a color in parallel, one color after the
+ * other, without level scheduling. The color offsets are returned by
+ * generate(system_matrix, color_ptrs).
+ *
+ * The coloring is computed by the Jones-Plassmann algorithm: in each round,
+ * every uncolored row whose pseudo-random priority is larger than the priority
+ * of all its uncolored neighbors picks the smallest color not used by its
+ * neighbors. The result only depends on the priorities, so it is the same for
+ * all executors and numbers of threads. It equals the greedy coloring of the
+ * rows in the order of decreasing priority.
+ *
+ * The coloring is computed on the host, i.e. on the master executor of the
+ * factory's executor.
+ *
+ * @tparam IndexType  the type used to store sparsity pattern indices of the
+ *                    system matrix
+ *
+ * @ingroup reorder
+ */
+template <typename IndexType = int32>
+class MultiColor
+    : public EnablePolymorphicObject<MultiColor<IndexType>, LinOpFactory>,
+      public EnablePolymorphicAssignment<MultiColor<IndexType>> {
+public:
+    struct parameters_type;
+    friend class EnablePolymorphicObject<MultiColor<IndexType>, LinOpFactory>;
+    friend class enable_parameters_type<parameters_type,
+                                        MultiColor<IndexType>>;
+
+    using index_type = IndexType;
+    using permutation_type = matrix::Permutation<index_type>;
+
+    struct parameters_type
+        : public enable_parameters_type<parameters_type,
+                                        MultiColor<IndexType>> {
+        /**
+         * If set to false, computes the coloring of A + A^T, otherwise assumes
+         * that A is structurally symmetric and uses it directly.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_symmetrize, false);
+
+        /**
+         * The distance up to which rows of the same color may not be
+         * connected.
+         */
+        multi_color_distance GKO_FACTORY_PARAMETER_SCALAR(
+            distance, multi_color_distance::one);
+    };
+
+    /**
+     * Returns the parameters used to construct the factory.
+     *
+     * @return the parameters used to construct the factory.
+     */
+    const parameters_type& get_parameters() { return parameters_; }
+
+    /**
+     * @copydoc LinOpFactory::generate
+     * @note This function overrides the default LinOpFactory::generate to
+     *       return a Permutation instead of a generic LinOp, which would
+     *       need to be cast to Permutation again to access its indices.
+     *       It is only necessary because smart pointers aren't covariant.
+     */
+    std::unique_ptr<permutation_type> generate(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
+    /**
+     * Generates the permutation grouping the rows by color and returns the
+     * color offsets.
+     *
+     * @param system_matrix  the matrix to color
+     * @param color_ptrs  the array the color offsets are written to: the rows
+     *                    color_ptrs[c], ..., color_ptrs[c + 1] - 1 of the
+     *                    permuted matrix have color c. It contains
+     *                    num_colors + 1 entries.
+     *
+     * @return the permutation grouping the rows by color
+     */
+    std::unique_ptr<permutation_type> generate(
+        std::shared_ptr<const LinOp> system_matrix,
+        array<index_type>& color_ptrs) const;
+
+    /** Creates a new parameter_type to set up the factory. */
+    static parameters_type build() { return {}; }
+
+protected:
+    explicit MultiColor(std::shared_ptr<const Executor> exec,
+                        const parameters_type& params = {});
+
+    std::unique_ptr<LinOp> generate_impl(
+        std::shared_ptr<const LinOp> system_matrix) const override;
+
+    parameters_type parameters_;
+};
+
+
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_REORDER_MULTI_COLOR_HPP_
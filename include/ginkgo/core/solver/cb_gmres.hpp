@@ -46,6 +46,14 @@ namespace cb_gmres {
  *             a reduced ValueType.
  * - ireduce2: The storage precision is an integer of the same size as
  *             a twice reduced ValueType.
+ * - adaptive: The storage precision is chosen per restart cycle. The solver
+ *             starts with the storage precision of reduce2 and escalates it
+ *             to reduce1 and keep at a restart whenever the last restart
+ *             cycle indicates that the Krylov basis is not accurate enough,
+ *             see CbGmres::parameters_type::adaptive_residual_gap and
+ *             CbGmres::parameters_type::adaptive_stagnation_ratio. Each
+ *             selected precision is reported to the loggers through the
+ *             krylov_storage_precision_selected event.
  *
  * Precision reduction works as follows:
  * - double -> float -> half -> half -> ... (half is the lowest supported
@@ -65,7 +73,8 @@ enum class storage_precision {
     reduce2,
     integer,
     ireduce1,
-    ireduce2
+    ireduce2,
+    adaptive
 };
 
 
@@ -142,6 +151,23 @@ public:
          * Krylov dimension factory.
          */
         size_type GKO_FACTORY_PARAMETER_SCALAR(krylov_dim, 100u);
+
+        /**
+         * With the adaptive storage precision, the storage precision is
+         * escalated at a restart if the residual norm computed explicitly
+         * exceeds the residual norm estimated by the Arnoldi process by more
+         * than this factor. Such a gap indicates that the Krylov basis lost
+         * its orthogonality due to the compression.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(adaptive_residual_gap, 10.0);
+
+        /**
+         * With the adaptive storage precision, the storage precision is
+         * escalated at a restart if the last full restart cycle did not reduce
+         * the residual norm below this fraction of its value at the start of
+         * the cycle.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(adaptive_stagnation_ratio, 0.9);
     };
 
     GKO_ENABLE_LIN_OP_FACTORY(CbGmres, parameters, Factory);
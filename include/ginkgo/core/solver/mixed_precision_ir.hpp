@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_MIXED_PRECISION_IR_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_MIXED_PRECISION_IR_HPP_
+
+
+#include <type_traits>
+
+
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/config/config.hpp>
+#include <ginkgo/core/config/registry.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/stop/combined.hpp>
+#include <ginkgo/core/stop/criterion.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+/**
+ * MixedPrecisionIr is an iterative refinement (IR) solver which solves the
+ * residual equation in a lower precision than the one of the system, in the
+ * spirit of GMRES-IR.
+ *
+ * The solution and the residual are kept in ValueType, while the inner solver
+ * and its preconditioner operate on a copy of the system matrix converted to
+ * the inner_value_type, i.e. float for double systems. This halves the memory
+ * traffic of the inner solves, which make up most of the work:
+ *
+ * ```
+ * solution = initial_guess
+ * while not converged:
+ *     residual = b - A solution                 (ValueType)
+ *     error = inner_solver(A_inner, residual)   (inner_value_type)
+ *     solution = solution + error
+ * ```
+ *
+ * The stopping criteria of the inner solver are replaced at every outer
+ * iteration: the inner solve stops after max_inner_iterations or once it
+ * reduced the residual by the inner tolerance. The inner tolerance starts at
+ * inner_reduction_factor and is adapted to the convergence rate `rho` of the
+ * outer iteration as `0.9 * rho^2`, bounded by min_inner_reduction_factor and
+ * inner_reduction_factor. Thus, fast outer convergence leads to more accurate
+ * inner solves, while slow outer convergence avoids wasting inner iterations.
+ *
+ * If an outer iteration reduces the residual norm by less than
+ * stagnation_ratio, the accuracy of the inner precision is assumed to be
+ * exhausted, and the remaining inner solves fall back to the fallback_solver
+ * applied to the system matrix in ValueType.
+ *
+ * The system matrix needs to be convertible to a Csr matrix in ValueType or
+ * inner_value_type.
+ *
+ * @tparam ValueType  precision of the system matrix and the solution
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision>
+class MixedPrecisionIr
+    : public EnableLinOp<MixedPrecisionIr<ValueType>>,
+      public EnableSolverBase<MixedPrecisionIr<ValueType>>,
+      public EnableIterativeBase<MixedPrecisionIr<ValueType>> {
+    friend class EnableLinOp<MixedPrecisionIr>;
+    friend class EnablePolymorphicObject<MixedPrecisionIr, LinOp>;
+
+public:
+    using value_type = ValueType;
+
+    /**
+     * The value type of the inner solver: ValueType reduced once in precision,
+     * or ValueType itself if it is already single precision.
+     */
+    using inner_value_type = std::conditional_t<
+        std::is_same<remove_complex<ValueType>, double>::value,
+        next_precision<ValueType>, ValueType>;
+
+    /**
+     * Return true as iterative solvers use the data in x as an initial guess.
+     *
+     * @return true as iterative solvers use the data in x as an initial guess.
+     */
+    bool apply_uses_initial_guess() const override { return true; }
+
+    /**
+     * Returns the system matrix converted to the inner precision.
+     *
+     * @return the system matrix converted to the inner precision
+     */
+    std::shared_ptr<const LinOp> get_inner_system_matrix() const
+    {
+        return inner_system_matrix_;
+    }
+
+    /**
+     * Returns the solver operating in the inner precision.
+     *
+     * @return the solver operating in the inner precision
+     */
+    std::shared_ptr<const LinOp> get_inner_solver() const
+    {
+        return inner_solver_;
+    }
+
+    /**
+     * Returns the solver operating in ValueType that is used after the outer
+     * iteration stagnated. It is only generated once it is needed.
+     *
+     * @return the fallback solver, or nullptr if no solve stagnated yet
+     */
+    std::shared_ptr<const LinOp> get_fallback_solver() const
+    {
+        return fallback_solver_;
+    }
+
+    class Factory;
+
+    struct parameters_type
+        : enable_iterative_solver_factory_parameters<parameters_type, Factory> {
+        /**
+         * Inner solver factory. It is generated on the system matrix converted
+         * to inner_value_type, so it should operate in inner_value_type, as
+         * should its preconditioner. By default, an unpreconditioned Gmres is
+         * used.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_DEFERRED_FACTORY_PARAMETER(
+            solver);
+
+        /**
+         * Solver factory used after the outer iteration stagnated. It is
+         * generated on the system matrix in ValueType. By default, an
+         * unpreconditioned Gmres is used.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_DEFERRED_FACTORY_PARAMETER(
+            fallback_solver);
+
+        /**
+         * Maximum number of iterations of each inner solve.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(max_inner_iterations, 100u);
+
+        /**
+         * Residual reduction of the first inner solve, and the loosest
+         * reduction any inner solve uses.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(inner_reduction_factor, 1e-2);
+
+        /**
+         * The tightest residual reduction any inner solve uses. The default is
+         * attainable in single precision for reasonably conditioned systems.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(min_inner_reduction_factor, 1e-6);
+
+        /**
+         * The inner solves fall back to ValueType if an outer iteration
+         * reduced the residual norm of any right-hand side by less than this
+         * factor.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(stagnation_ratio, 0.5);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(MixedPrecisionIr, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+    /**
+     * Create the parameters from the property_tree.
+     * Because this is directly tied to the specific type, the value/index type
+     * settings within config are ignored and type_descriptor is only used
+     * for children configs. The inner solver is parsed with inner_value_type.
+     *
+     * @param config  the property tree for setting
+     * @param context  the registry
+     * @param td_for_child  the type descriptor for children configs. The
+     *                      default uses the value type of this class.
+     *
+     * @return parameters
+     */
+    static parameters_type parse(const config::pnode& config,
+                                 const config::registry& context,
+                                 const config::type_descriptor& td_for_child =
+                                     config::make_type_descriptor<ValueType>());
+
+protected:
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_dense_impl(const matrix::Dense<ValueType>* b,
+                          matrix::Dense<ValueType>* x) const;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    explicit MixedPrecisionIr(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<MixedPrecisionIr>(std::move(exec))
+    {}
+
+    explicit MixedPrecisionIr(const Factory* factory,
+                              std::shared_ptr<const LinOp> system_matrix);
+
+private:
+    std::shared_ptr<const LinOp> inner_system_matrix_{};
+    std::shared_ptr<LinOp> inner_solver_{};
+    mutable std::shared_ptr<LinOp> fallback_solver_{};
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_MIXED_PRECISION_IR_HPP_
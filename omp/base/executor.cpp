@@ -21,4 +21,10 @@ int OmpExecutor::get_num_omp_threads()
 }
 
 
+void OmpExecutor::set_num_omp_threads(int num_threads)
+{
+    omp_set_num_threads(num_threads);
+}
+
+
 }  // namespace gko
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/base/memory.hpp>
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/machine_topology.hpp>
+#include <ginkgo/core/base/math.hpp>
+
+
+namespace gko {
+
+
+NumaCpuAllocator::NumaCpuAllocator(size_type alignment, bool use_huge_pages,
+                                   bool bind_threads)
+    : alignment_{use_huge_pages ? std::max(alignment, huge_page_size)
+                                : alignment},
+      use_huge_pages_{use_huge_pages}
+{
+    GKO_ASSERT(alignment_ >= sizeof(void*) &&
+               (alignment_ & (alignment_ - 1)) == 0);
+    if (bind_threads) {
+        const auto topology = machine_topology::get_instance();
+        const auto num_cores = static_cast<int>(topology->get_num_cores());
+        if (num_cores > 0) {
+#pragma omp parallel
+            topology->bind_to_core(omp_get_thread_num() % num_cores);
+        }
+    }
+}
+
+
+void* NumaCpuAllocator::allocate(size_type num_bytes)
+{
+    // round up to the alignment to avoid sharing pages between allocations
+    const auto alloc_size =
+        std::max(static_cast<size_type>(ceildiv(num_bytes, alignment_)),
+                 size_type{1}) *
+        alignment_;
+    void* ptr{};
+#ifdef _WIN32
+    ptr = _aligned_malloc(alloc_size, alignment_);
+#else
+    if (posix_memalign(&ptr, alignment_, alloc_size) != 0) {
+        ptr = nullptr;
+    }
+#endif
+    GKO_ENSURE_ALLOCATED(ptr, "omp", num_bytes);
+#ifdef MADV_HUGEPAGE
+    if (use_huge_pages_) {
+        madvise(ptr, alloc_size, MADV_HUGEPAGE);
+    }
+#endif
+    // touch the memory with the static schedule used by the kernels
+    const auto bytes = static_cast<char*>(ptr);
+#pragma omp parallel
+    {
+        const auto num_threads = static_cast<size_type>(omp_get_num_threads());
+        const auto tid = static_cast<size_type>(omp_get_thread_num());
+        const auto chunk =
+            static_cast<size_type>(ceildiv(alloc_size, num_threads));
+        const auto begin = std::min(tid * chunk, alloc_size);
+        const auto end = std::min(begin + chunk, alloc_size);
+        std::memset(bytes + begin, 0, end - begin);
+    }
+    return ptr;
+}
+
+
+void NumaCpuAllocator::deallocate(void* ptr)
+{
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+
+}  // namespace gko
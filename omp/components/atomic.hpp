@@ -40,6 +40,29 @@ void atomic_add(ValueType& out, ValueType val)
 }
 
 
+/**
+ * Atomically replaces out by val if val is smaller.
+ */
+template <typename ValueType>
+void atomic_min(ValueType& out, ValueType val)
+{
+#if defined(__GNUG__) || defined(__clang__)
+    auto old = __atomic_load_n(&out, __ATOMIC_RELAXED);
+    while (val < old &&
+           !__atomic_compare_exchange_n(&out, &old, val, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+#else
+#pragma omp critical(gko_omp_atomic_min)
+    {
+        if (val < out) {
+            out = val;
+        }
+    }
+#endif
+}
+
+
 }  // namespace omp
 }  // namespace kernels
 }  // namespace gko
@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_COMPONENTS_HALF_CONVERSION_HPP_
+#define GKO_OMP_COMPONENTS_HALF_CONVERSION_HPP_
+
+
+#include <type_traits>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/extended_float.hpp"
+
+
+#if defined(__x86_64__) && (defined(__GNUG__) || defined(__clang__)) && \
+    !defined(__INTEL_COMPILER)
+#include <immintrin.h>
+#define GKO_OMP_HAS_F16C_DISPATCH 1
+#endif  // defined(__x86_64__) && (defined(__GNUG__) || defined(__clang__)) &&
+        // !defined(__INTEL_COMPILER)
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+
+
+/**
+ * Type trait which is true if values stored as T are half precision, i.e. if
+ * converting them in bulk with convert_half_values pays off.
+ */
+template <typename T>
+struct is_half_storage : std::false_type {};
+
+template <>
+struct is_half_storage<half> : std::true_type {};
+
+template <>
+struct is_half_storage<std::complex<half>> : std::true_type {};
+
+
+/**
+ * The type half precision values of type T are converted to, i.e. float or
+ * std::complex<float>.
+ */
+template <typename T>
+using half_conversion_type =
+    std::conditional_t<is_complex<T>(), std::complex<float>, float>;
+
+
+namespace detail {
+
+
+#ifdef GKO_OMP_HAS_F16C_DISPATCH
+
+
+__attribute__((target("avx,f16c"))) inline void convert_half_values_f16c(
+    const uint16* in, size_type n, float* out)
+{
+    size_type i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const auto packed =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(packed));
+    }
+    for (; i < n; ++i) {
+        out[i] = _cvtsh_ss(in[i]);
+    }
+}
+
+
+#endif  // GKO_OMP_HAS_F16C_DISPATCH
+
+
+}  // namespace detail
+
+
+/**
+ * Returns true if the CPU can convert half precision values in hardware, i.e.
+ * if it supports the F16C instructions. The check runs only once.
+ */
+inline bool has_hardware_half_conversion()
+{
+#ifdef GKO_OMP_HAS_F16C_DISPATCH
+    static const bool supported = __builtin_cpu_supports("avx") &&
+                                  __builtin_cpu_supports("f16c");
+    return supported;
+#else
+    return false;
+#endif  // GKO_OMP_HAS_F16C_DISPATCH
+}
+
+
+/**
+ * Converts n half precision values to single precision.
+ *
+ * If the CPU supports it, eight values at a time are converted with the F16C
+ * instructions, otherwise the software conversion of gko::half is used. Both
+ * produce the same result for all values gko::half creates, as it flushes
+ * subnormals to zero.
+ *
+ * @param in  the half precision values
+ * @param n  the number of values
+ * @param out  the output array of at least n values
+ */
+inline void convert_half_values(const half* in, size_type n, float* out)
+{
+#ifdef GKO_OMP_HAS_F16C_DISPATCH
+    if (has_hardware_half_conversion()) {
+        // gko::half only consists of its bit representation
+        detail::convert_half_values_f16c(reinterpret_cast<const uint16*>(in),
+                                         n, out);
+        return;
+    }
+#endif  // GKO_OMP_HAS_F16C_DISPATCH
+    for (size_type i = 0; i < n; ++i) {
+        out[i] = static_cast<float>(in[i]);
+    }
+}
+
+
+/**
+ * @copydoc convert_half_values(const half*, size_type, float*)
+ */
+inline void convert_half_values(const std::complex<half>* in, size_type n,
+                                std::complex<float>* out)
+{
+    // both types store the real part next to the imaginary part
+    convert_half_values(reinterpret_cast<const half*>(in), 2 * n,
+                        reinterpret_cast<float*>(out));
+}
+
+
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_COMPONENTS_HALF_CONVERSION_HPP_
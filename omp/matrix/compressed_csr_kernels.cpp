@@ -0,0 +1,336 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/compressed_csr_kernels.hpp"
+
+
+#include <algorithm>
+#include <type_traits>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/base/extended_float.hpp"
+#include "core/matrix/compressed_csr_utils.hpp"
+#include "core/preconditioner/jacobi_utils.hpp"
+#include "omp/components/half_conversion.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The compressed-value CSR matrix format namespace.
+ *
+ * @ingroup compressed_csr
+ */
+namespace compressed_csr {
+namespace {
+
+
+template <typename ValueType, typename StorageType, typename IndexType,
+          typename OutFn>
+void spmv_impl(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::CompressedCsr<ValueType, IndexType>* a,
+               const StorageType* vals, const matrix::Dense<ValueType>* b,
+               matrix::Dense<ValueType>* c, OutFn out, std::false_type)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto scales = a->get_const_row_scales();
+    matrix::compressed_csr::run_with_col_reader(a, [&](auto get_row_cols) {
+#pragma omp parallel for
+        for (size_type row = 0; row < a->get_size()[0]; ++row) {
+            for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                auto cols = get_row_cols(row);
+                auto sum = zero<ValueType>();
+                for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                    sum += static_cast<ValueType>(vals[k]) * b->at(cols(k), j);
+                }
+                if (scales) {
+                    sum *= scales[row];
+                }
+                c->at(row, j) = out(row, j, sum);
+            }
+        }
+    });
+}
+
+
+// half precision values are converted in bulk once per row, and the converted
+// values are reused for all right-hand sides
+template <typename ValueType, typename StorageType, typename IndexType,
+          typename OutFn>
+void spmv_impl(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::CompressedCsr<ValueType, IndexType>* a,
+               const StorageType* vals, const matrix::Dense<ValueType>* b,
+               matrix::Dense<ValueType>* c, OutFn out, std::true_type)
+{
+    using converted_type = half_conversion_type<StorageType>;
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto scales = a->get_const_row_scales();
+    matrix::compressed_csr::run_with_col_reader(a, [&](auto get_row_cols) {
+#pragma omp parallel
+        {
+            vector<converted_type> row_vals(exec);
+#pragma omp for
+            for (size_type row = 0; row < a->get_size()[0]; ++row) {
+                const auto begin = row_ptrs[row];
+                const auto end = row_ptrs[row + 1];
+                row_vals.resize(end - begin);
+                convert_half_values(vals + begin, end - begin,
+                                    row_vals.data());
+                auto cols = get_row_cols(row);
+                for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                    auto sum = zero<ValueType>();
+                    for (auto k = begin; k < end; ++k) {
+                        sum += static_cast<ValueType>(row_vals[k - begin]) *
+                               b->at(cols(k), j);
+                    }
+                    if (scales) {
+                        sum *= scales[row];
+                    }
+                    c->at(row, j) = out(row, j, sum);
+                }
+            }
+        }
+    });
+}
+
+
+template <typename ValueType, typename StorageType, typename IndexType>
+void compress_values(const matrix::Csr<ValueType, IndexType>* source,
+                     remove_complex<ValueType>* scales, StorageType* vals)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto source_vals = source->get_const_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        auto scale = one<remove_complex<ValueType>>();
+        if (scales) {
+            auto max_abs = zero<remove_complex<ValueType>>();
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                max_abs = std::max(max_abs, abs(source_vals[k]));
+            }
+            // keep empty and zero rows unscaled
+            if (is_nonzero(max_abs) && is_finite(max_abs)) {
+                scale = max_abs;
+            }
+            scales[row] = scale;
+        }
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            vals[k] = static_cast<StorageType>(source_vals[k] / scale);
+        }
+    }
+}
+
+
+template <typename ValueType, typename StorageType, typename IndexType>
+void decompress_values(
+    std::shared_ptr<const OmpExecutor> exec,
+    const matrix::CompressedCsr<ValueType, IndexType>* source,
+    const StorageType* vals, ValueType* result_vals, std::false_type)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto scales = source->get_const_row_scales();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        const auto scale =
+            scales ? scales[row] : one<remove_complex<ValueType>>();
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            result_vals[k] = static_cast<ValueType>(vals[k]) * scale;
+        }
+    }
+}
+
+
+template <typename ValueType, typename StorageType, typename IndexType>
+void decompress_values(
+    std::shared_ptr<const OmpExecutor> exec,
+    const matrix::CompressedCsr<ValueType, IndexType>* source,
+    const StorageType* vals, ValueType* result_vals, std::true_type)
+{
+    using converted_type = half_conversion_type<StorageType>;
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto scales = source->get_const_row_scales();
+#pragma omp parallel
+    {
+        vector<converted_type> row_vals(exec);
+#pragma omp for
+        for (size_type row = 0; row < source->get_size()[0]; ++row) {
+            const auto begin = row_ptrs[row];
+            const auto end = row_ptrs[row + 1];
+            const auto scale =
+                scales ? scales[row] : one<remove_complex<ValueType>>();
+            row_vals.resize(end - begin);
+            convert_half_values(vals + begin, end - begin, row_vals.data());
+            for (auto k = begin; k < end; ++k) {
+                result_vals[k] =
+                    static_cast<ValueType>(row_vals[k - begin]) * scale;
+            }
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void compress_cols(const matrix::Csr<ValueType, IndexType>* source,
+                   matrix::CompressedCsr<ValueType, IndexType>* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto outlier_ptrs = result->get_const_outlier_ptrs();
+    const auto outliers = result->get_outlier_cols();
+    matrix::compressed_csr::run_with_delta_type(
+        result->get_index_compression(), [&](auto delta_tag) {
+            using delta_type = decltype(delta_tag);
+            const auto deltas =
+                reinterpret_cast<delta_type*>(result->get_col_deltas());
+#pragma omp parallel for
+            for (size_type row = 0; row < source->get_size()[0]; ++row) {
+                matrix::compressed_csr::compress_row_cols(
+                    row, row_ptrs, col_idxs, deltas,
+                    outliers + outlier_ptrs[row]);
+            }
+        });
+}
+
+
+template <typename ValueType, typename IndexType>
+void decompress_cols(const matrix::CompressedCsr<ValueType, IndexType>* source,
+                     IndexType* result_cols)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    matrix::compressed_csr::run_with_col_reader(
+        source, [&](auto get_row_cols) {
+#pragma omp parallel for
+            for (size_type row = 0; row < source->get_size()[0]; ++row) {
+                auto cols = get_row_cols(row);
+                for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                    result_cols[k] = cols(k);
+                }
+            }
+        });
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::CompressedCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, a->get_storage_precision(),
+        spmv_impl(exec, a,
+                  reinterpret_cast<const resolved_precision*>(
+                      a->get_const_values()),
+                  b, c,
+                  [](size_type, size_type, ValueType sum) { return sum; },
+                  is_half_storage<resolved_precision>{}));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::CompressedCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, a->get_storage_precision(),
+        spmv_impl(exec, a,
+                  reinterpret_cast<const resolved_precision*>(
+                      a->get_const_values()),
+                  b, c,
+                  [&](size_type row, size_type j, ValueType sum) {
+                      return valpha * sum + vbeta * c->at(row, j);
+                  },
+                  is_half_storage<resolved_precision>{}));
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compress(std::shared_ptr<const OmpExecutor> exec,
+              const matrix::Csr<ValueType, IndexType>* source,
+              matrix::CompressedCsr<ValueType, IndexType>* result)
+{
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, result->get_storage_precision(),
+        compress_values(
+            source, result->get_row_scales(),
+            reinterpret_cast<resolved_precision*>(result->get_values())));
+    compress_cols(source, result);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_COMPRESS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void decompress(std::shared_ptr<const OmpExecutor> exec,
+                const matrix::CompressedCsr<ValueType, IndexType>* source,
+                matrix::Csr<ValueType, IndexType>* result)
+{
+    GKO_PRECONDITIONER_JACOBI_RESOLVE_PRECISION(
+        ValueType, source->get_storage_precision(),
+        decompress_values(exec, source,
+                          reinterpret_cast<const resolved_precision*>(
+                              source->get_const_values()),
+                          result->get_values(),
+                          is_half_storage<resolved_precision>{}));
+    decompress_cols(source, result->get_col_idxs());
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_DECOMPRESS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_index_outliers(std::shared_ptr<const OmpExecutor> exec,
+                          const matrix::Csr<ValueType, IndexType>* source,
+                          matrix::CompressedCsr<ValueType, IndexType>* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto counts = result->get_outlier_ptrs();
+    matrix::compressed_csr::run_with_delta_type(
+        result->get_index_compression(), [&](auto delta_tag) {
+            using delta_type = decltype(delta_tag);
+#pragma omp parallel for
+            for (size_type row = 0; row < source->get_size()[0]; ++row) {
+                counts[row] =
+                    matrix::compressed_csr::count_row_outliers<delta_type>(
+                        row, row_ptrs, col_idxs);
+            }
+        });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_COMPRESSED_CSR_COUNT_INDEX_OUTLIERS_KERNEL);
+
+
+}  // namespace compressed_csr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -5,6 +5,7 @@
 #include "core/matrix/ell_kernels.hpp"
 
 
+#include <algorithm>
 #include <array>
 
 
@@ -32,6 +33,10 @@ namespace omp {
 namespace ell {
 
 
+// the number of rows processed together by the single-vector SpMV kernels
+constexpr int spmv_block_size = 64;
+
+
 template <int num_rhs, typename InputValueType, typename MatrixValueType,
           typename OutputValueType, typename IndexType, typename OutFn>
 void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
@@ -42,43 +47,56 @@ void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
     GKO_ASSERT(b->get_size()[1] == num_rhs);
     using arithmetic_type =
         highest_precision<InputValueType, OutputValueType, MatrixValueType>;
-    using a_accessor =
-        gko::acc::reduced_row_major<1, arithmetic_type, const MatrixValueType>;
-    using b_accessor =
-        gko::acc::reduced_row_major<2, arithmetic_type, const InputValueType>;
 
     const auto num_stored_elements_per_row =
         a->get_num_stored_elements_per_row();
     const auto stride = a->get_stride();
-    const auto a_vals = gko::acc::range<a_accessor>(
-        std::array<acc::size_type, 1>{
-            static_cast<acc::size_type>(num_stored_elements_per_row * stride)},
-        a->get_const_values());
-    const auto b_vals = gko::acc::range<b_accessor>(
-        std::array<acc::size_type, 2>{
-            {static_cast<acc::size_type>(b->get_size()[0]),
-             static_cast<acc::size_type>(b->get_size()[1])}},
-        b->get_const_values(),
-        std::array<acc::size_type, 1>{
-            {static_cast<acc::size_type>(b->get_stride())}});
-
+    const auto num_rows = a->get_size()[0];
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto a_ptr = a->get_const_values();
+    const auto b_ptr = b->get_const_values();
+    const auto b_stride = b->get_stride();
+    const auto num_blocks = ceildiv(num_rows, spmv_block_size);
 #pragma omp parallel for
-    for (size_type row = 0; row < a->get_size()[0]; row++) {
-        std::array<arithmetic_type, num_rhs> partial_sum;
-        partial_sum.fill(zero<arithmetic_type>());
+    for (size_type block = 0; block < num_blocks; block++) {
+        // ELL stores the entries of consecutive rows contiguously, so we
+        // process a block of rows at a time with the loop over the rows
+        // innermost, which can be vectorized
+        const auto block_begin = block * spmv_block_size;
+        const auto block_rows =
+            std::min<size_type>(spmv_block_size, num_rows - block_begin);
+        std::array<arithmetic_type, spmv_block_size * num_rhs> partial_sums;
+        partial_sums.fill(zero<arithmetic_type>());
         for (size_type i = 0; i < num_stored_elements_per_row; i++) {
-            arithmetic_type val = a_vals(row + i * stride);
-            auto col = a->col_at(row, i);
-            if (col != invalid_index<IndexType>()) {
+            const auto offset = block_begin + i * stride;
+#pragma omp simd
+            for (size_type row = 0; row < block_rows; row++) {
+                // avoid branches on padding entries to allow for
+                // vectorization
+                const auto col = col_idxs[offset + row];
+                const auto valid = col != invalid_index<IndexType>();
+                const auto safe_col = valid ? col : IndexType{};
+                const auto stored_val =
+                    static_cast<arithmetic_type>(a_ptr[offset + row]);
+                const auto val = valid ? stored_val : zero<arithmetic_type>();
 #pragma unroll
                 for (size_type j = 0; j < num_rhs; j++) {
-                    partial_sum[j] += val * b_vals(col, j);
+                    partial_sums[j * spmv_block_size + row] +=
+                        val * static_cast<arithmetic_type>(
+                                  b_ptr[safe_col * b_stride + j]);
                 }
             }
         }
+        for (size_type row = 0; row < block_rows; row++) {
+            const auto global_row = block_begin + row;
 #pragma unroll
-        for (size_type j = 0; j < num_rhs; j++) {
-            [&] { c->at(row, j) = out(row, j, partial_sum[j]); }();
+            for (size_type j = 0; j < num_rhs; j++) {
+                [&] {
+                    c->at(global_row, j) =
+                        out(global_row, j,
+                            partial_sums[j * spmv_block_size + row]);
+                }();
+            }
         }
     }
 }
@@ -5,14 +5,19 @@
 #include "core/matrix/fft_kernels.hpp"
 
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+
+#include <omp.h>
+
+
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 
 
-#include "core/base/allocator.hpp"
-
-
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -22,281 +27,357 @@ namespace omp {
  * @ingroup fft
  */
 namespace fft {
+namespace {
+
+
+/*
+ * The transforms are computed by a Stockham auto-sort FFT with radix-4 steps
+ * and a final radix-2 step if the size is not a power of four. Each step reads
+ * from one work array and writes to the other one in natural order, so no
+ * bit reversal is necessary. For multi-dimensional transforms, the FFTs along
+ * the contiguous dimension are computed, followed by a transpose which makes
+ * the next dimension contiguous.
+ *
+ * The twiddle factors of all steps and the two work arrays are stored in the
+ * buffer of the Fft object, which starts with a header describing the twiddle
+ * factors. This way, the twiddle factors are only computed by the first apply.
+ */
+constexpr int64 header_size = 8;
+
+
+// the header identifying the twiddle factors stored in the buffer
+template <typename ValueType, size_type num_dims>
+std::array<int64, header_size> build_header(
+    const std::array<int64, num_dims>& sizes, int64 sign)
+{
+    static_assert(num_dims + 3 <= header_size, "header too small");
+    std::array<int64, header_size> header{};
+    header[0] = sizeof(ValueType);
+    header[1] = sign;
+    header[2] = num_dims;
+    std::copy(sizes.begin(), sizes.end(), header.begin() + 3);
+    return header;
+}
 
 
-template <typename InValueType, typename OutValueType>
-void bfly(const matrix::Dense<InValueType>* b, matrix::Dense<OutValueType>* x,
-          int64 lo, int64 hi, OutValueType root)
+// the number of Stockham steps for an FFT of the given size
+int64 num_steps(int64 size)
 {
-    for (size_type rhs = 0; rhs < x->get_size()[1]; rhs++) {
-        auto lo_val = b->at(lo, rhs);
-        auto hi_val = b->at(hi, rhs);
-        x->at(lo, rhs) = lo_val + hi_val;
-        x->at(hi, rhs) = (lo_val - hi_val) * root;
+    int64 steps{};
+    for (int64 len = size; len > 1; len /= 4) {
+        steps++;
     }
+    return steps;
 }
 
 
-template <typename ValueType>
-void bfly(matrix::Dense<ValueType>* x, int64 lo, int64 hi, ValueType root)
+// the number of twiddle factors of the radix-4 steps of an FFT
+int64 num_twiddles(int64 size)
 {
-    for (size_type rhs = 0; rhs < x->get_size()[1]; rhs++) {
-        auto lo_val = x->at(lo, rhs);
-        auto hi_val = x->at(hi, rhs);
-        x->at(lo, rhs) = lo_val + hi_val;
-        x->at(hi, rhs) = (lo_val - hi_val) * root;
+    int64 result{};
+    for (auto len = size; len >= 4; len /= 4) {
+        result += 3 * (len / 4);
     }
+    return result;
 }
 
 
+// stores w^p, w^2p, w^3p for each radix-4 step of length len and p < len / 4
 template <typename ValueType>
-void bit_rev_swap(matrix::Dense<ValueType>* x, int64 i, int64 rev_i)
+void build_twiddles(int64 size, int64 sign, ValueType* twiddles)
 {
-    for (size_type rhs = 0; rhs < x->get_size()[1]; rhs++) {
-        if (i < rev_i) {
-            std::swap(x->at(i, rhs), x->at(rev_i, rhs));
+    for (auto len = size; len >= 4; len /= 4) {
+        const auto m = len / 4;
+#pragma omp parallel for
+        for (int64 p = 0; p < m; p++) {
+            for (int64 t = 1; t <= 3; t++) {
+                twiddles[3 * p + t - 1] =
+                    unit_root<ValueType>(len, sign * t * p);
+            }
         }
+        twiddles += 3 * m;
     }
 }
 
 
-int64 bit_rev(int64 i, int64 size)
+// avoids the NaN and infinity handling of std::complex multiplication, which
+// prevents vectorization
+template <typename ValueType>
+std::complex<ValueType> mul(std::complex<ValueType> a,
+                            std::complex<ValueType> b)
 {
-    int64 rev{};
-    for (int64 fwd = 1, bwd = size / 2; fwd < size; fwd *= 2, bwd /= 2) {
-        rev |= ((i / fwd) & 1) * bwd;
-    }
-    return rev;
+    return {a.real() * b.real() - a.imag() * b.imag(),
+            a.real() * b.imag() + a.imag() * b.real()};
 }
 
 
+/*
+ * Computes the radix-4 butterfly of the values in[q + s * (p + k * m)],
+ * k = 0, ..., 3 of a step with sub-transforms of length 4 * m, which are
+ * interleaved with stride s.
+ */
 template <typename ValueType>
-vector<ValueType> build_unit_roots(std::shared_ptr<const DefaultExecutor> exec,
-                                   int64 size, int64 sign)
+void radix4_bfly(const std::complex<ValueType>* in,
+                 std::complex<ValueType>* out,
+                 const std::complex<ValueType>* twiddles, int64 m, int64 s,
+                 int64 p, int64 q, ValueType sign)
 {
-    vector<ValueType> roots(size / 2, {exec});
-    for (int64 i = 0; i < size / 2; i++) {
-        roots[i] = unit_root<ValueType>(size, sign * i);
-    }
-    return roots;
+    const auto a = in[q + s * p];
+    const auto b = in[q + s * (p + m)];
+    const auto c = in[q + s * (p + 2 * m)];
+    const auto d = in[q + s * (p + 3 * m)];
+    const auto apc = a + c;
+    const auto amc = a - c;
+    const auto bpd = b + d;
+    const auto bmd = b - d;
+    // -sign * i * (b - d)
+    const std::complex<ValueType> jbmd{sign * bmd.imag(), -sign * bmd.real()};
+    out[q + s * (4 * p)] = apc + bpd;
+    out[q + s * (4 * p + 1)] = mul(twiddles[3 * p], amc - jbmd);
+    out[q + s * (4 * p + 2)] = mul(twiddles[3 * p + 1], apc - bpd);
+    out[q + s * (4 * p + 3)] = mul(twiddles[3 * p + 2], amc + jbmd);
 }
 
 
 template <typename ValueType>
-void fft(std::shared_ptr<const DefaultExecutor> exec,
-         const matrix::Dense<std::complex<ValueType>>* b,
-         matrix::Dense<std::complex<ValueType>>* x, bool inverse,
-         array<char>& buffer)
+void radix2_bfly(const ValueType* in, ValueType* out, int64 s, int64 q)
 {
-    using complex_type = std::complex<ValueType>;
-    using real_type = ValueType;
-    const int64 sign = inverse ? 1 : -1;
-    const auto nrhs = b->get_size()[1];
-    const auto size = static_cast<int64>(b->get_size()[0]);
-    GKO_ASSERT_IS_POWER_OF_TWO(size);
-    auto roots = build_unit_roots<complex_type>(exec, size, sign);
-    // first butterfly step
-    auto d = size / 2;
-#pragma omp parallel for
-    for (int64 k = 0; k < size / 2; k++) {
-        bfly(b, x, k, k + d, roots[k]);
-    }
-    // remaining butterfly steps
-    for (d = size / 4; d > 0; d /= 2) {
-        // square roots
-        for (int64 i = 0; i < d; i++) {
-            roots[i] = roots[2 * i];
-        }
-#pragma omp parallel for
-        for (int64 base = 0; base < size; base += d * 2) {
-            for (int64 k = base; k < base + d; k++) {
-                bfly(x, k, k + d, roots[k - base]);
+    const auto a = in[q];
+    const auto b = in[q + s];
+    out[q] = a + b;
+    out[q + s] = a - b;
+}
+
+
+// transforms a single row on the calling thread
+template <typename ValueType>
+void sequential_fft(ValueType* data, ValueType* scratch,
+                    const ValueType* twiddles, int64 size, int64 nrhs,
+                    remove_complex<ValueType> sign)
+{
+    auto s = nrhs;
+    auto len = size;
+    for (; len >= 4; len /= 4) {
+        const auto m = len / 4;
+        for (int64 p = 0; p < m; p++) {
+#pragma omp simd
+            for (int64 q = 0; q < s; q++) {
+                radix4_bfly(data, scratch, twiddles, m, s, p, q, sign);
             }
         }
+        twiddles += 3 * m;
+        s *= 4;
+        std::swap(data, scratch);
     }
-// bit reversal
-#pragma omp parallel for
-    for (int64 k = 0; k < size; k++) {
-        bit_rev_swap(x, k, bit_rev(k, size));
+    if (len == 2) {
+#pragma omp simd
+        for (int64 q = 0; q < s; q++) {
+            radix2_bfly(data, scratch, s, q);
+        }
     }
 }
 
-GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_FFT_KERNEL);
-
 
+// transforms a single row with all threads of the enclosing parallel region
 template <typename ValueType>
-void fft2(std::shared_ptr<const DefaultExecutor> exec,
-          const matrix::Dense<std::complex<ValueType>>* b,
-          matrix::Dense<std::complex<ValueType>>* x, size_type size1,
-          size_type size2, bool inverse, array<char>& buffer)
+void parallel_fft(ValueType* data, ValueType* scratch,
+                  const ValueType* twiddles, int64 size, int64 nrhs,
+                  remove_complex<ValueType> sign)
 {
-    using complex_type = std::complex<ValueType>;
-    using real_type = ValueType;
-    const int64 sign = inverse ? 1 : -1;
-    const auto nrhs = b->get_size()[1];
-    const auto ssize1 = static_cast<int64>(size1);
-    const auto ssize2 = static_cast<int64>(size2);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize1);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize2);
-    const auto idx = [&](int64 x, int64 y) { return x * ssize2 + y; };
-    auto roots1 = build_unit_roots<complex_type>(exec, ssize1, sign);
-    auto roots2 = build_unit_roots<complex_type>(exec, ssize2, sign);
-    // minor dimension first: size1 FFTs
-    // first butterfly step
-    auto d = ssize2 / 2;
-#pragma omp parallel for
-    for (int64 k1 = 0; k1 < ssize1; k1++) {
-        for (int64 k2 = 0; k2 < ssize2 / 2; k2++) {
-            bfly(b, x, idx(k1, k2), idx(k1, k2 + d), roots2[k2]);
+    auto s = nrhs;
+    auto len = size;
+    for (; len >= 4; len /= 4) {
+        const auto m = len / 4;
+#pragma omp for collapse(2)
+        for (int64 p = 0; p < m; p++) {
+            for (int64 q = 0; q < s; q++) {
+                radix4_bfly(data, scratch, twiddles, m, s, p, q, sign);
+            }
         }
+        twiddles += 3 * m;
+        s *= 4;
+        std::swap(data, scratch);
     }
-    // remaining butterfly steps
-    for (d = ssize2 / 4; d > 0; d /= 2) {
-        // square roots
-        for (int64 i = 0; i < d; i++) {
-            roots2[i] = roots2[2 * i];
-        }
-#pragma omp parallel for
-        for (int64 k1 = 0; k1 < ssize1; k1++) {
-            for (int64 base = 0; base < ssize2; base += d * 2) {
-                for (int64 k2 = base; k2 < base + d; k2++) {
-                    bfly(x, idx(k1, k2), idx(k1, k2 + d), roots2[k2 - base]);
-                }
-            }
+    if (len == 2) {
+#pragma omp for
+        for (int64 q = 0; q < s; q++) {
+            radix2_bfly(data, scratch, s, q);
         }
     }
-    // then major dimension: 1 ssize2-wide FFT
-    // butterfly steps
-    for (d = ssize1 / 2; d > 0; d /= 2) {
-#pragma omp parallel for
-        for (int64 base = 0; base < ssize1; base += d * 2) {
-            for (int64 k1 = base; k1 < base + d; k1++) {
-                auto root = roots1[k1 - base];
-                for (int64 k2 = 0; k2 < ssize2; k2++) {
-                    bfly(x, idx(k1, k2), idx(k1 + d, k2), root);
-                }
-            }
+}
+
+
+/*
+ * Transforms the num_rows contiguous rows of data, each consisting of nrhs
+ * interleaved vectors of the given size. Needs to be called from within a
+ * parallel region. Returns the work array containing the result.
+ */
+template <typename ValueType>
+ValueType* batched_fft(ValueType* data, ValueType* scratch,
+                       const ValueType* twiddles, int64 num_rows, int64 size,
+                       int64 nrhs, remove_complex<ValueType> sign)
+{
+    const auto row_size = size * nrhs;
+    if (num_rows >= omp_get_num_threads()) {
+        // each row is transformed by a single thread, so its work arrays stay
+        // in the cache of that thread for all steps
+#pragma omp for
+        for (int64 row = 0; row < num_rows; row++) {
+            sequential_fft(data + row * row_size, scratch + row * row_size,
+                           twiddles, size, nrhs, sign);
         }
-        // square roots
-        for (int64 i = 0; i < d / 2; i++) {
-            roots1[i] = roots1[2 * i];
+    } else {
+        for (int64 row = 0; row < num_rows; row++) {
+            parallel_fft(data + row * row_size, scratch + row * row_size,
+                         twiddles, size, nrhs, sign);
         }
     }
-// bit reversal
-#pragma omp parallel for
-    for (int64 k1 = 0; k1 < ssize1; k1++) {
-        for (int64 k2 = 0; k2 < ssize2; k2++) {
-            bit_rev_swap(x, idx(k1, k2),
-                         idx(bit_rev(k1, ssize1), bit_rev(k2, ssize2)));
+    return num_steps(size) % 2 == 0 ? data : scratch;
+}
+
+
+// transposes the rows x cols matrix of blocks of nrhs values in into out
+template <typename ValueType>
+void transpose(const ValueType* in, ValueType* out, int64 rows, int64 cols,
+               int64 nrhs)
+{
+    constexpr int64 block_size = 16;
+#pragma omp for collapse(2)
+    for (int64 row_begin = 0; row_begin < rows; row_begin += block_size) {
+        for (int64 col_begin = 0; col_begin < cols; col_begin += block_size) {
+            const auto row_end = std::min(row_begin + block_size, rows);
+            const auto col_end = std::min(col_begin + block_size, cols);
+            for (auto row = row_begin; row < row_end; row++) {
+                for (auto col = col_begin; col < col_end; col++) {
+                    std::copy_n(in + (row * cols + col) * nrhs, nrhs,
+                                out + (col * rows + row) * nrhs);
+                }
+            }
         }
     }
 }
 
-GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_FFT2_KERNEL);
-
 
-template <typename ValueType>
-void fft3(std::shared_ptr<const DefaultExecutor> exec,
-          const matrix::Dense<std::complex<ValueType>>* b,
-          matrix::Dense<std::complex<ValueType>>* x, size_type size1,
-          size_type size2, size_type size3, bool inverse, array<char>& buffer)
+template <typename ValueType, size_type num_dims>
+void fft_impl(const matrix::Dense<std::complex<ValueType>>* b,
+              matrix::Dense<std::complex<ValueType>>* x,
+              const std::array<int64, num_dims>& sizes, bool inverse,
+              array<char>& buffer)
 {
     using complex_type = std::complex<ValueType>;
-    using real_type = ValueType;
     const int64 sign = inverse ? 1 : -1;
-    const auto nrhs = b->get_size()[1];
-    const auto ssize1 = static_cast<int64>(size1);
-    const auto ssize2 = static_cast<int64>(size2);
-    const auto ssize3 = static_cast<int64>(size3);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize1);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize2);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize3);
-    const auto idx = [&](int64 x, int64 y, int64 z) {
-        return x * ssize2 * ssize3 + y * ssize3 + z;
-    };
-    auto roots1 = build_unit_roots<complex_type>(exec, ssize1, sign);
-    auto roots2 = build_unit_roots<complex_type>(exec, ssize2, sign);
-    auto roots3 = build_unit_roots<complex_type>(exec, ssize3, sign);
-    // minor dimension first: size1*size2 FFTs
-    // first butterfly step
-    auto d = ssize3 / 2;
-#pragma omp parallel for
-    for (int64 k1 = 0; k1 < ssize1; k1++) {
-        for (int64 k2 = 0; k2 < ssize2; k2++) {
-            for (int64 k3 = 0; k3 < ssize3 / 2; k3++) {
-                bfly(b, x, idx(k1, k2, k3), idx(k1, k2, k3 + d), roots3[k3]);
-            }
-        }
+    const auto nrhs = static_cast<int64>(b->get_size()[1]);
+    const auto size = static_cast<int64>(b->get_size()[0]);
+    int64 total_twiddles{};
+    for (auto dim_size : sizes) {
+        GKO_ASSERT_IS_POWER_OF_TWO(dim_size);
+        total_twiddles += num_twiddles(dim_size);
     }
-    // remaining butterfly steps
-    for (d = ssize3 / 4; d > 0; d /= 2) {
-        // square roots
-        for (int64 i = 0; i < d; i++) {
-            roots3[i] = roots3[2 * i];
-        }
-#pragma omp parallel for
-        for (int64 k1 = 0; k1 < ssize1; k1++) {
-            for (int64 k2 = 0; k2 < ssize2; k2++) {
-                for (int64 base = 0; base < ssize3; base += d * 2) {
-                    for (int64 k3 = base; k3 < base + d; k3++) {
-                        bfly(x, idx(k1, k2, k3), idx(k1, k2, k3 + d),
-                             roots3[k3 - base]);
-                    }
-                }
-            }
-        }
+    // set up the buffer, reusing the twiddle factors of previous applies
+    const auto header = build_header<complex_type>(sizes, sign);
+    const auto header_bytes = sizeof(header);
+    const auto required_bytes =
+        header_bytes +
+        (total_twiddles + 2 * size * nrhs) * sizeof(complex_type);
+    const auto valid_twiddles =
+        buffer.get_size() >= required_bytes &&
+        std::memcmp(buffer.get_const_data(), header.data(), header_bytes) == 0;
+    if (buffer.get_size() < required_bytes) {
+        buffer.resize_and_reset(required_bytes);
     }
-    // then second dimension: 1 ssize1*ssize3-wide FFT
-    // butterfly steps
-    for (d = ssize2 / 2; d > 0; d /= 2) {
-#pragma omp parallel for
-        for (int64 base = 0; base < ssize2; base += d * 2) {
-            for (int64 k2 = base; k2 < base + d; k2++) {
-                auto root = roots2[k2 - base];
-                for (int64 k1 = 0; k1 < ssize1; k1++) {
-                    for (int64 k3 = 0; k3 < ssize3; k3++) {
-                        bfly(x, idx(k1, k2, k3), idx(k1, k2 + d, k3), root);
-                    }
-                }
-            }
-        }
-        // square roots
-        for (int64 i = 0; i < d / 2; i++) {
-            roots2[i] = roots2[2 * i];
+    auto twiddles =
+        reinterpret_cast<complex_type*>(buffer.get_data() + header_bytes);
+    if (!valid_twiddles) {
+        std::memcpy(buffer.get_data(), header.data(), header_bytes);
+        auto dim_twiddles = twiddles;
+        for (auto dim_size : sizes) {
+            build_twiddles(dim_size, sign, dim_twiddles);
+            dim_twiddles += num_twiddles(dim_size);
         }
     }
-    // then major dimension: 1 ssize2*ssize3-wide FFT
-    // butterfly steps
-    for (d = ssize1 / 2; d > 0; d /= 2) {
-#pragma omp parallel for
-        for (int64 base = 0; base < ssize1; base += d * 2) {
-            for (int64 k1 = base; k1 < base + d; k1++) {
-                auto root = roots1[k1 - base];
-                for (int64 k2 = 0; k2 < ssize2; k2++) {
-                    for (int64 k3 = 0; k3 < ssize3; k3++) {
-                        bfly(x, idx(k1, k2, k3), idx(k1 + d, k2, k3), root);
-                    }
-                }
+    const auto work = twiddles + total_twiddles;
+#pragma omp parallel
+    {
+        // the entries of all right-hand sides are interleaved
+#pragma omp for
+        for (int64 i = 0; i < size; i++) {
+            for (int64 rhs = 0; rhs < nrhs; rhs++) {
+                work[i * nrhs + rhs] = b->at(i, rhs);
             }
         }
-        // square roots
-        for (int64 i = 0; i < d / 2; i++) {
-            roots1[i] = roots1[2 * i];
+        auto data = work;
+        auto scratch = work + size * nrhs;
+        const complex_type* dim_twiddles = twiddles + total_twiddles;
+        // after the FFT along the contiguous dimension, the transpose moves
+        // it to the front and makes the next dimension contiguous
+        for (auto dim = static_cast<int64>(num_dims) - 1; dim >= 0; dim--) {
+            const auto dim_size = sizes[dim];
+            const auto num_rows = size / dim_size;
+            dim_twiddles -= num_twiddles(dim_size);
+            auto result = batched_fft(data, scratch, dim_twiddles, num_rows,
+                                      dim_size, nrhs, ValueType(sign));
+            if (result != data) {
+                std::swap(data, scratch);
+            }
+            if (num_dims > 1) {
+                transpose(data, scratch, num_rows, dim_size, nrhs);
+                std::swap(data, scratch);
+            }
         }
-    }
-// bit reversal
-#pragma omp parallel for
-    for (int64 k1 = 0; k1 < ssize1; k1++) {
-        for (int64 k2 = 0; k2 < ssize2; k2++) {
-            for (int64 k3 = 0; k3 < ssize3; k3++) {
-                bit_rev_swap(x, idx(k1, k2, k3),
-                             idx(bit_rev(k1, ssize1), bit_rev(k2, ssize2),
-                                 bit_rev(k3, ssize3)));
+#pragma omp for
+        for (int64 i = 0; i < size; i++) {
+            for (int64 rhs = 0; rhs < nrhs; rhs++) {
+                x->at(i, rhs) = data[i * nrhs + rhs];
             }
         }
     }
 }
 
+
+}  // anonymous namespace
+
+
+template <typename ValueType>
+void fft(std::shared_ptr<const DefaultExecutor> exec,
+         const matrix::Dense<std::complex<ValueType>>* b,
+         matrix::Dense<std::complex<ValueType>>* x, bool inverse,
+         array<char>& buffer)
+{
+    fft_impl(b, x, std::array<int64, 1>{static_cast<int64>(b->get_size()[0])},
+             inverse, buffer);
+}
+
+GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_FFT_KERNEL);
+
+
+template <typename ValueType>
+void fft2(std::shared_ptr<const DefaultExecutor> exec,
+          const matrix::Dense<std::complex<ValueType>>* b,
+          matrix::Dense<std::complex<ValueType>>* x, size_type size1,
+          size_type size2, bool inverse, array<char>& buffer)
+{
+    fft_impl(b, x,
+             std::array<int64, 2>{static_cast<int64>(size1),
+                                  static_cast<int64>(size2)},
+             inverse, buffer);
+}
+
+GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_FFT2_KERNEL);
+
+
+template <typename ValueType>
+void fft3(std::shared_ptr<const DefaultExecutor> exec,
+          const matrix::Dense<std::complex<ValueType>>* b,
+          matrix::Dense<std::complex<ValueType>>* x, size_type size1,
+          size_type size2, size_type size3, bool inverse, array<char>& buffer)
+{
+    fft_impl(b, x,
+             std::array<int64, 3>{static_cast<int64>(size1),
+                                  static_cast<int64>(size2),
+                                  static_cast<int64>(size3)},
+             inverse, buffer);
+}
+
 GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_FFT3_KERNEL);
 
 
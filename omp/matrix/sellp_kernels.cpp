@@ -5,7 +5,9 @@
 #include "core/matrix/sellp_kernels.hpp"
 
 
+#include <algorithm>
 #include <array>
+#include <vector>
 
 
 #include <omp.h>
@@ -32,32 +34,55 @@ void spmv_small_rhs(std::shared_ptr<const OmpExecutor> exec,
                     matrix::Dense<ValueType>* c, OutFn out)
 {
     GKO_ASSERT(b->get_size()[1] == num_rhs);
-    auto slice_lengths = a->get_const_slice_lengths();
-    auto slice_sets = a->get_const_slice_sets();
-    auto slice_size = a->get_slice_size();
-    auto slice_num = ceildiv(a->get_size()[0] + slice_size - 1, slice_size);
-#pragma omp parallel for collapse(2)
-    for (size_type slice = 0; slice < slice_num; slice++) {
-        for (size_type row = 0; row < slice_size; row++) {
-            size_type global_row = slice * slice_size + row;
-            if (global_row < a->get_size()[0]) {
-                std::array<ValueType, num_rhs> partial_sum;
-                partial_sum.fill(zero<ValueType>());
-                for (size_type i = 0; i < slice_lengths[slice]; i++) {
-                    auto val = a->val_at(row, slice_sets[slice], i);
-                    auto col = a->col_at(row, slice_sets[slice], i);
-                    if (col != invalid_index<IndexType>()) {
+    const auto num_rows = a->get_size()[0];
+    const auto slice_lengths = a->get_const_slice_lengths();
+    const auto slice_sets = a->get_const_slice_sets();
+    const auto slice_size = a->get_slice_size();
+    const auto slice_num = ceildiv(num_rows, slice_size);
+    const auto vals = a->get_const_values();
+    const auto cols = a->get_const_col_idxs();
+    const auto b_vals = b->get_const_values();
+    const auto b_stride = b->get_stride();
+#pragma omp parallel
+    {
+        // the partial sums of all rows in a slice, stored separately for each
+        // right-hand side, so the innermost loop over the rows of a slice
+        // accesses values, column indices and partial sums contiguously and
+        // can be vectorized
+        std::vector<ValueType> partial_sums(slice_size * num_rhs);
+#pragma omp for
+        for (size_type slice = 0; slice < slice_num; slice++) {
+            const auto slice_begin = slice * slice_size;
+            const auto slice_rows =
+                std::min(slice_size, num_rows - slice_begin);
+            const auto sums = partial_sums.data();
+            std::fill(partial_sums.begin(), partial_sums.end(),
+                      zero<ValueType>());
+            for (size_type i = 0; i < slice_lengths[slice]; i++) {
+                const auto offset = (slice_sets[slice] + i) * slice_size;
+#pragma omp simd
+                for (size_type row = 0; row < slice_rows; row++) {
+                    // avoid branches on padding entries to allow for
+                    // vectorization
+                    const auto col = cols[offset + row];
+                    const auto valid = col != invalid_index<IndexType>();
+                    const auto safe_col = valid ? col : IndexType{};
+                    const auto stored_val = vals[offset + row];
+                    const auto val = valid ? stored_val : zero<ValueType>();
 #pragma unroll
-                        for (size_type j = 0; j < num_rhs; j++) {
-                            partial_sum[j] += val * b->at(col, j);
-                        }
+                    for (size_type j = 0; j < num_rhs; j++) {
+                        sums[j * slice_size + row] +=
+                            val * b_vals[safe_col * b_stride + j];
                     }
                 }
+            }
+            for (size_type row = 0; row < slice_rows; row++) {
+                const auto global_row = slice_begin + row;
 #pragma unroll
                 for (size_type j = 0; j < num_rhs; j++) {
                     [&] {
                         c->at(global_row, j) =
-                            out(global_row, j, partial_sum[j]);
+                            out(global_row, j, sums[j * slice_size + row]);
                     }();
                 }
             }
@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+#include <algorithm>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The symmetric CSR matrix format namespace.
+ *
+ * @ingroup symmetric_csr
+ */
+namespace symmetric_csr {
+namespace {
+
+
+/**
+ * Computes the product of the symmetric matrix with b and passes each row of
+ * it to out.
+ *
+ * The rows are split into one contiguous block per thread. The mirrored lower
+ * entries of a block contribute to rows of later blocks, so every block
+ * accumulates its results in a separate buffer covering the rows from its
+ * first row up to its largest column index, and the buffers are summed up
+ * afterwards. This avoids write conflicts between the threads without
+ * atomics, and keeps the buffers small for matrices with a small bandwidth.
+ */
+template <typename ValueType, typename IndexType, typename OutFn>
+void spmv_impl(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::SymmetricCsr<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+               OutFn out)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto num_rows = a->get_size()[0];
+    const auto num_rhs = c->get_size()[1];
+    const auto num_blocks = static_cast<size_type>(omp_get_max_threads());
+    const auto block_size =
+        std::max<size_type>(ceildiv(num_rows, num_blocks), 1);
+    const auto block_begin = [&](size_type block) {
+        return std::min(block * block_size, num_rows);
+    };
+    // the rows of each block buffer are [block_begin(block), block_ends[block])
+    vector<size_type> block_ends(num_blocks, {exec});
+#pragma omp parallel for
+    for (size_type block = 0; block < num_blocks; ++block) {
+        const auto end = block_begin(block + 1);
+        auto buffer_end = end;
+        for (auto row = block_begin(block); row < end; ++row) {
+            // the column indexes are sorted, the last one is the largest
+            if (row_ptrs[row + 1] > row_ptrs[row]) {
+                const auto last_col = col_idxs[row_ptrs[row + 1] - 1];
+                buffer_end =
+                    std::max(buffer_end, static_cast<size_type>(last_col) + 1);
+            }
+        }
+        block_ends[block] = buffer_end;
+    }
+    vector<size_type> offsets(num_blocks + 1, {exec});
+    offsets[0] = 0;
+    for (size_type block = 0; block < num_blocks; ++block) {
+        offsets[block + 1] =
+            offsets[block] + (block_ends[block] - block_begin(block)) * num_rhs;
+    }
+    vector<ValueType> partial(offsets[num_blocks], {exec});
+#pragma omp parallel for
+    for (size_type block = 0; block < num_blocks; ++block) {
+        const auto begin = block_begin(block);
+        const auto end = block_begin(block + 1);
+        const auto local = partial.data() + offsets[block];
+        std::fill(local, partial.data() + offsets[block + 1],
+                  zero<ValueType>());
+        for (auto row = begin; row < end; ++row) {
+            const auto local_row = (row - begin) * num_rhs;
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                const auto col = static_cast<size_type>(col_idxs[k]);
+                const auto local_col = (col - begin) * num_rhs;
+                for (size_type j = 0; j < num_rhs; ++j) {
+                    local[local_row + j] += vals[k] * b->at(col, j);
+                    if (col != row) {
+                        local[local_col + j] += vals[k] * b->at(row, j);
+                    }
+                }
+            }
+        }
+    }
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        // only the blocks starting at or before row can contribute to it
+        const auto last_block = row / block_size;
+        for (size_type j = 0; j < num_rhs; ++j) {
+            auto sum = zero<ValueType>();
+            for (size_type block = 0; block <= last_block; ++block) {
+                if (row < block_ends[block]) {
+                    sum += partial[offsets[block] +
+                                   (row - block_begin(block)) * num_rhs + j];
+                }
+            }
+            c->at(row, j) = out(row, j, sum);
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::SymmetricCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    spmv_impl(exec, a, b, c,
+              [](size_type, size_type, ValueType sum) { return sum; });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    spmv_impl(exec, a, b, c,
+              [&](size_type row, size_type j, ValueType sum) {
+                  return valpha * sum + vbeta * c->at(row, j);
+              });
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_upper_nonzeros_per_row(
+    std::shared_ptr<const OmpExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* source, IndexType* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        result[row] = static_cast<IndexType>(std::count_if(
+            col_idxs + row_ptrs[row], col_idxs + row_ptrs[row + 1],
+            [&](IndexType col) { return col >= static_cast<IndexType>(row); }));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NONZEROS_PER_ROW_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_upper(std::shared_ptr<const OmpExecutor> exec,
+                const matrix::Csr<ValueType, IndexType>* source,
+                matrix::SymmetricCsr<ValueType, IndexType>* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    const auto out_row_ptrs = result->get_const_row_ptrs();
+    const auto out_col_idxs = result->get_col_idxs();
+    const auto out_vals = result->get_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        auto out_nz = out_row_ptrs[row];
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            if (col_idxs[k] >= static_cast<IndexType>(row)) {
+                out_col_idxs[out_nz] = col_idxs[k];
+                out_vals[out_nz] = vals[k];
+                out_nz++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_UPPER_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_nonzeros_per_row(
+    std::shared_ptr<const OmpExecutor> exec,
+    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+    IndexType* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        result[row] = row_ptrs[row + 1] - row_ptrs[row];
+    }
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            if (col_idxs[k] != static_cast<IndexType>(row)) {
+#pragma omp atomic
+                result[col_idxs[k]]++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_NONZEROS_PER_ROW_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const OmpExecutor> exec,
+                 const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    const auto num_rows = source->get_size()[0];
+    const auto out_row_ptrs = result->get_const_row_ptrs();
+    const auto out_col_idxs = result->get_col_idxs();
+    const auto out_vals = result->get_values();
+    // like the Csr transpose, the mirrored lower entries are filled in
+    // sequentially, so they precede the upper entries of each row and stay
+    // sorted
+    vector<IndexType> out_nz(out_row_ptrs, out_row_ptrs + num_rows, {exec});
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = col_idxs[k];
+            out_col_idxs[out_nz[row]] = col;
+            out_vals[out_nz[row]] = vals[k];
+            out_nz[row]++;
+            if (col != static_cast<IndexType>(row)) {
+                out_col_idxs[out_nz[col]] = row;
+                out_vals[out_nz[col]] = vals[k];
+                out_nz[col]++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+
+
+}  // namespace symmetric_csr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,417 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/amd_kernels.hpp"
+
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "omp/components/atomic.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The approximate minimum degree reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace amd {
+namespace {
+
+
+// the priority of a candidate pivot, a pseudo-random bijection on uint64
+inline uint64 pivot_priority(uint64 vertex)
+{
+    vertex = (vertex ^ (vertex >> 30)) * 0xbf58476d1ce4e5b9ull;
+    vertex = (vertex ^ (vertex >> 27)) * 0x94d049bb133111ebull;
+    return vertex ^ (vertex >> 31);
+}
+
+
+// the range of [0, size) processed by the calling thread
+template <typename IndexType>
+std::pair<IndexType, IndexType> thread_range(IndexType size)
+{
+    const auto chunk = static_cast<IndexType>(
+        ceildiv(size, static_cast<int64>(omp_get_num_threads())));
+    const auto begin =
+        std::min<IndexType>(omp_get_thread_num() * chunk, size);
+    return {begin, std::min<IndexType>(begin + chunk, size)};
+}
+
+
+/*
+ * Returns the minimum of values[in[i]] for i in [0, size). Needs to be called
+ * by all threads of a parallel region.
+ */
+template <typename IndexType>
+IndexType parallel_min(const IndexType* in, IndexType size,
+                       const IndexType* values, IndexType* thread_values)
+{
+    const auto range = thread_range(size);
+    auto result = std::numeric_limits<IndexType>::max();
+    for (auto i = range.first; i < range.second; i++) {
+        result = std::min(result, values[in[i]]);
+    }
+    thread_values[omp_get_thread_num()] = result;
+#pragma omp barrier
+    for (int thread = 0; thread < omp_get_num_threads(); thread++) {
+        result = std::min(result, thread_values[thread]);
+    }
+#pragma omp barrier
+    return result;
+}
+
+
+/*
+ * Stores the entries in[i] for which pred(i) is true in out, preserving their
+ * order, and returns their number. Needs to be called by all threads of a
+ * parallel region.
+ */
+template <typename IndexType, typename Predicate>
+IndexType parallel_filter(const IndexType* in, IndexType size, IndexType* out,
+                          IndexType* thread_offsets, Predicate pred)
+{
+    const auto range = thread_range(size);
+    const auto num_threads = omp_get_num_threads();
+    const auto thread_id = omp_get_thread_num();
+    IndexType count{};
+    for (auto i = range.first; i < range.second; i++) {
+        count += pred(i) ? 1 : 0;
+    }
+    thread_offsets[thread_id + 1] = count;
+#pragma omp barrier
+#pragma omp single
+    {
+        thread_offsets[0] = 0;
+        std::partial_sum(thread_offsets, thread_offsets + num_threads + 1,
+                         thread_offsets);
+    }
+    auto out_idx = thread_offsets[thread_id];
+    for (auto i = range.first; i < range.second; i++) {
+        if (pred(i)) {
+            out[out_idx++] = in[i];
+        }
+    }
+    const auto result = thread_offsets[num_threads];
+#pragma omp barrier
+    return result;
+}
+
+
+/*
+ * Replaces values[i] by the sum of values[0], ..., values[i - 1] for i in
+ * [0, size] and returns the total sum. values needs to have size + 1 entries.
+ * Needs to be called by all threads of a parallel region.
+ */
+template <typename IndexType>
+IndexType parallel_prefix_sum(IndexType* values, IndexType size,
+                              IndexType* thread_offsets)
+{
+    const auto range = thread_range(size);
+    const auto num_threads = omp_get_num_threads();
+    const auto thread_id = omp_get_thread_num();
+    IndexType sum{};
+    for (auto i = range.first; i < range.second; i++) {
+        const auto value = values[i];
+        values[i] = sum;
+        sum += value;
+    }
+    thread_offsets[thread_id + 1] = sum;
+#pragma omp barrier
+#pragma omp single
+    {
+        thread_offsets[0] = 0;
+        std::partial_sum(thread_offsets, thread_offsets + num_threads + 1,
+                         thread_offsets);
+        values[size] = thread_offsets[num_threads];
+    }
+    for (auto i = range.first; i < range.second; i++) {
+        values[i] += thread_offsets[thread_id];
+    }
+    const auto result = values[size];
+#pragma omp barrier
+    return result;
+}
+
+
+}  // anonymous namespace
+
+
+/*
+ * The elimination works on the quotient graph: each eliminated variable
+ * becomes an element, which stores the variables its elimination connected,
+ * and each variable stores its adjacent variables and elements. When an
+ * element is adjacent to an eliminated variable, it is absorbed into the new
+ * element. The degrees of the variables approximate their external degrees
+ * like in AMD, except that the variables of all new elements of a round are
+ * subtracted from the sizes of the old elements.
+ *
+ * Multiple pivots are eliminated in each round: all variables of minimum
+ * degree are candidates, and each claims the variables it reaches through
+ * edges or elements. A candidate which claimed all of them is eliminated, so
+ * the reaches of all pivots of a round are disjoint, i.e. they form a
+ * distance-2 independent set. Their eliminations modify disjoint parts of the
+ * quotient graph and can be done in parallel.
+ * Claims are resolved by a pseudo-random priority, so the result does not
+ * depend on the number of threads. Variables which become simplicial by the
+ * elimination of a pivot are eliminated directly after it, which replaces
+ * the mass elimination of supervariables in AMD.
+ */
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const DefaultExecutor> exec,
+                         IndexType num_rows, const IndexType* row_ptrs,
+                         const IndexType* col_idxs, IndexType* permutation)
+{
+    const auto invalid = invalid_index<IndexType>();
+    const auto unclaimed = std::numeric_limits<uint64>::max();
+    // the adjacent variables of each variable, pruned in place
+    vector<IndexType> adj(col_idxs, col_idxs + row_ptrs[num_rows], exec);
+    vector<IndexType> adj_ends(row_ptrs + 1, row_ptrs + num_rows + 1, exec);
+    // the adjacent elements of a variable, or the variables of an element
+    vector<vector<IndexType>> lists(num_rows, vector<IndexType>(exec), exec);
+    vector<IndexType> degrees(num_rows, exec);
+    vector<uint8> eliminated(num_rows, 0, exec);
+    vector<uint8> absorbed(num_rows, 0, exec);
+    vector<uint8> selected(num_rows, 0, exec);
+    vector<uint64> owners(num_rows, unclaimed, exec);
+    vector<IndexType> marks(num_rows, invalid, exec);
+    // the number of variables of an element outside the new elements
+    vector<IndexType> external_sizes(num_rows, exec);
+    vector<IndexType> live(num_rows, exec);
+    vector<IndexType> live_tmp(num_rows, exec);
+    vector<IndexType> candidates(num_rows, exec);
+    vector<IndexType> num_simplicial(num_rows + 1, exec);
+    vector<IndexType> thread_buffer(omp_get_max_threads() + 1, exec);
+    IndexType num_live = num_rows;
+    IndexType num_eliminated{};
+    // calls fn for v and all live variables adjacent to v or to one of its
+    // elements until it returns false. Variables may be visited multiple
+    // times. Returns false if fn did.
+    const auto for_each_reachable = [&](IndexType v, auto fn) {
+        if (!fn(v)) {
+            return false;
+        }
+        for (auto nz = row_ptrs[v]; nz < adj_ends[v]; nz++) {
+            if (!eliminated[adj[nz]] && !fn(adj[nz])) {
+                return false;
+            }
+        }
+        for (const auto element : lists[v]) {
+            for (const auto u : lists[element]) {
+                if (!fn(u)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+#pragma omp parallel
+    {
+#pragma omp for
+        for (IndexType row = 0; row < num_rows; row++) {
+            degrees[row] = row_ptrs[row + 1] - row_ptrs[row];
+            live[row] = row;
+        }
+        auto live_vars = live.data();
+        auto live_vars_tmp = live_tmp.data();
+        while (num_live > 0) {
+            const auto min_degree = parallel_min(
+                live_vars, num_live, degrees.data(), thread_buffer.data());
+            const auto num_candidates = parallel_filter(
+                live_vars, num_live, candidates.data(), thread_buffer.data(),
+                [&](IndexType i) {
+                    return degrees[live_vars[i]] == min_degree;
+                });
+            // each variable is claimed by the candidate with the smallest
+            // priority reaching it
+#pragma omp for
+            for (IndexType i = 0; i < num_candidates; i++) {
+                const auto candidate = candidates[i];
+                const auto priority = pivot_priority(candidate);
+                for_each_reachable(candidate, [&](IndexType u) {
+                    atomic_min(owners[u], priority);
+                    return true;
+                });
+            }
+#pragma omp for
+            for (IndexType i = 0; i < num_candidates; i++) {
+                const auto candidate = candidates[i];
+                const auto priority = pivot_priority(candidate);
+                selected[i] = for_each_reachable(candidate, [&](IndexType u) {
+                    return owners[u] == priority;
+                });
+            }
+#pragma omp for
+            for (IndexType i = 0; i < num_candidates; i++) {
+                for_each_reachable(candidates[i], [&](IndexType u) {
+#pragma omp atomic write
+                    owners[u] = unclaimed;
+                    return true;
+                });
+            }
+            // the pivots are appended to the permutation
+            const auto pivots = permutation + num_eliminated;
+            const auto num_pivots = parallel_filter(
+                candidates.data(), num_candidates, pivots,
+                thread_buffer.data(), [&](IndexType i) { return selected[i]; });
+            // turn the pivots into elements, absorbing their adjacent elements
+#pragma omp for
+            for (IndexType i = 0; i < num_pivots; i++) {
+                const auto pivot = pivots[i];
+                vector<IndexType> element_vars(exec);
+                marks[pivot] = pivot;
+                const auto add_var = [&](IndexType u) {
+                    if (marks[u] != pivot) {
+                        marks[u] = pivot;
+                        element_vars.push_back(u);
+                    }
+                };
+                for (auto nz = row_ptrs[pivot]; nz < adj_ends[pivot]; nz++) {
+                    if (!eliminated[adj[nz]]) {
+                        add_var(adj[nz]);
+                    }
+                }
+                for (const auto element : lists[pivot]) {
+                    for (const auto u : lists[element]) {
+                        add_var(u);
+                    }
+                    absorbed[element] = true;
+                    vector<IndexType>(exec).swap(lists[element]);
+                }
+                eliminated[pivot] = true;
+                adj_ends[pivot] = row_ptrs[pivot];
+                lists[pivot] = std::move(element_vars);
+            }
+            // variables which are only connected to the new element form a
+            // clique with it, so eliminating them right away causes no
+            // fill-in. They are moved to the end of the element.
+#pragma omp for
+            for (IndexType i = 0; i < num_pivots; i++) {
+                const auto pivot = pivots[i];
+                auto& element_vars = lists[pivot];
+                const auto is_remaining = [&](IndexType v) {
+                    for (auto nz = row_ptrs[v]; nz < adj_ends[v]; nz++) {
+                        const auto u = adj[nz];
+                        if (!eliminated[u] && marks[u] != pivot) {
+                            return true;
+                        }
+                    }
+                    return std::any_of(
+                        lists[v].begin(), lists[v].end(),
+                        [&](IndexType element) { return !absorbed[element]; });
+                };
+                const auto it = std::stable_partition(
+                    element_vars.begin(), element_vars.end(), is_remaining);
+                num_simplicial[i] =
+                    static_cast<IndexType>(element_vars.end() - it);
+            }
+            const auto simplicial = pivots + num_pivots;
+            const auto num_simplicial_total = parallel_prefix_sum(
+                num_simplicial.data(), num_pivots, thread_buffer.data());
+#pragma omp for
+            for (IndexType i = 0; i < num_pivots; i++) {
+                auto& element_vars = lists[pivots[i]];
+                const auto begin = element_vars.end() - (num_simplicial[i + 1] -
+                                                         num_simplicial[i]);
+                std::copy(begin, element_vars.end(),
+                          simplicial + num_simplicial[i]);
+                for (auto it = begin; it != element_vars.end(); ++it) {
+                    eliminated[*it] = true;
+                    vector<IndexType>(exec).swap(lists[*it]);
+                }
+                element_vars.erase(begin, element_vars.end());
+            }
+            // prune the variables of the new elements, and count for each of
+            // their other elements how many of its variables are not in any
+            // new element, to approximate the external degrees like AMD
+#pragma omp for
+            for (IndexType i = 0; i < num_pivots; i++) {
+                const auto pivot = pivots[i];
+                for (const auto v : lists[pivot]) {
+                    // variables of the new element are reachable through it
+                    auto out_nz = row_ptrs[v];
+                    for (auto nz = row_ptrs[v]; nz < adj_ends[v]; nz++) {
+                        const auto u = adj[nz];
+                        if (!eliminated[u] && marks[u] != pivot) {
+                            adj[out_nz++] = u;
+                        }
+                    }
+                    adj_ends[v] = out_nz;
+                    auto& elements = lists[v];
+                    elements.erase(std::remove_if(elements.begin(),
+                                                  elements.end(),
+                                                  [&](IndexType element) {
+                                                      return absorbed[element];
+                                                  }),
+                                   elements.end());
+                    for (const auto element : elements) {
+                        const auto size =
+                            static_cast<IndexType>(lists[element].size());
+#pragma omp atomic write
+                        external_sizes[element] = size;
+                    }
+                }
+            }
+#pragma omp for
+            for (IndexType i = 0; i < num_pivots; i++) {
+                for (const auto v : lists[pivots[i]]) {
+                    for (const auto element : lists[v]) {
+#pragma omp atomic
+                        external_sizes[element]--;
+                    }
+                }
+            }
+            const auto num_remaining =
+                num_live - num_pivots - num_simplicial_total;
+#pragma omp for
+            for (IndexType i = 0; i < num_pivots; i++) {
+                const auto pivot = pivots[i];
+                const auto element_size =
+                    static_cast<IndexType>(lists[pivot].size());
+                for (const auto v : lists[pivot]) {
+                    auto& elements = lists[v];
+                    auto degree = adj_ends[v] - row_ptrs[v] + element_size - 1;
+                    for (const auto element : elements) {
+                        degree += external_sizes[element];
+                    }
+                    elements.push_back(pivot);
+                    degrees[v] =
+                        std::min({degree, degrees[v] + element_size - 2,
+                                  num_remaining - 1});
+                }
+            }
+            const auto num_live_tmp = parallel_filter(
+                live_vars, num_live, live_vars_tmp, thread_buffer.data(),
+                [&](IndexType i) { return !eliminated[live_vars[i]]; });
+            std::swap(live_vars, live_vars_tmp);
+#pragma omp single
+            {
+                num_eliminated += num_pivots + num_simplicial_total;
+                num_live = num_live_tmp;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_AMD_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace amd
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/multi_color_kernels.hpp"
+
+
+#include <numeric>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The multi-color reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace multi_color {
+
+
+template <typename IndexType>
+void compute_coloring(std::shared_ptr<const DefaultExecutor> exec,
+                      IndexType num_vertices, const IndexType* row_ptrs,
+                      const IndexType* col_idxs,
+                      gko::experimental::reorder::multi_color_distance distance,
+                      IndexType* colors)
+{
+    const auto distance_two =
+        distance == gko::experimental::reorder::multi_color_distance::two;
+    const auto invalid = invalid_index<IndexType>();
+    // calls fn for all neighbors of v until it returns false, and returns
+    // whether all calls returned true. Neighbors reachable on multiple paths
+    // are visited multiple times.
+    const auto for_each_neighbor = [&](IndexType v, auto fn) {
+        for (auto nz = row_ptrs[v]; nz < row_ptrs[v + 1]; nz++) {
+            const auto u = col_idxs[nz];
+            if (u == v) {
+                continue;
+            }
+            if (!fn(u)) {
+                return false;
+            }
+            if (distance_two) {
+                for (auto nz2 = row_ptrs[u]; nz2 < row_ptrs[u + 1]; nz2++) {
+                    const auto w = col_idxs[nz2];
+                    if (w != v && !fn(w)) {
+                        return false;
+                    }
+                }
+            }
+        }
+        return true;
+    };
+    vector<IndexType> worklist(num_vertices, exec);
+    vector<uint8> selected(num_vertices, exec);
+    std::iota(worklist.begin(), worklist.end(), IndexType{});
+    std::fill_n(colors, num_vertices, invalid);
+    auto num_uncolored = static_cast<size_type>(num_vertices);
+#pragma omp parallel
+    {
+        // marks the colors used by the neighbors of the vertex it stores
+        vector<IndexType> forbidden(64, invalid, exec);
+        while (num_uncolored > 0) {
+            // select the uncolored vertices with maximal priority among their
+            // uncolored neighbors. No two of them are neighbors.
+#pragma omp for
+            for (size_type i = 0; i < num_uncolored; i++) {
+                const auto v = worklist[i];
+                const auto priority = coloring_priority(v);
+                selected[i] = for_each_neighbor(v, [&](IndexType u) {
+                    return colors[u] != invalid ||
+                           coloring_priority(u) < priority;
+                });
+            }
+            // color them with the smallest color their neighbors don't use.
+            // This only reads colors from previous rounds.
+#pragma omp for
+            for (size_type i = 0; i < num_uncolored; i++) {
+                if (!selected[i]) {
+                    continue;
+                }
+                const auto v = worklist[i];
+                while (true) {
+                    const auto limit = static_cast<IndexType>(forbidden.size());
+                    for_each_neighbor(v, [&](IndexType u) {
+                        const auto color = colors[u];
+                        if (color != invalid && color < limit) {
+                            forbidden[color] = v;
+                        }
+                        return true;
+                    });
+                    IndexType color{};
+                    while (color < limit && forbidden[color] == v) {
+                        color++;
+                    }
+                    if (color < limit) {
+                        colors[v] = color;
+                        break;
+                    }
+                    forbidden.resize(2 * forbidden.size(), invalid);
+                }
+            }
+#pragma omp single
+            {
+                size_type out{};
+                for (size_type i = 0; i < num_uncolored; i++) {
+                    if (!selected[i]) {
+                        worklist[out++] = worklist[i];
+                    }
+                }
+                num_uncolored = out;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_MULTI_COLOR_COMPUTE_COLORING_KERNEL);
+
+
+}  // namespace multi_color
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/base/memory.hpp>
+
+
+#include <cstdint>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+
+
+namespace {
+
+
+TEST(NumaCpuAllocator, AllocatesAlignedZeroedMemory)
+{
+    gko::NumaCpuAllocator alloc{128};
+
+    auto ptr = static_cast<char*>(alloc.allocate(1000));
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 128, 0);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(ptr[i], 0);
+    }
+    alloc.deallocate(ptr);
+}
+
+
+TEST(NumaCpuAllocator, UsesHugePageAlignment)
+{
+    gko::NumaCpuAllocator alloc{64, true};
+
+    auto ptr = alloc.allocate(100);
+
+    ASSERT_EQ(alloc.get_alignment(), gko::NumaCpuAllocator::huge_page_size);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) %
+                  gko::NumaCpuAllocator::huge_page_size,
+              0);
+    alloc.deallocate(ptr);
+}
+
+
+TEST(NumaCpuAllocator, WorksWithExecutor)
+{
+    auto exec =
+        gko::OmpExecutor::create(std::make_shared<gko::NumaCpuAllocator>());
+
+    gko::array<double> array(exec, {1.0, 2.0, 3.0});
+
+    ASSERT_EQ(array.get_const_data()[2], 3.0);
+}
+
+
+}  // namespace
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "omp/components/half_conversion.hpp"
+
+
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+namespace {
+
+
+class HalfConversion : public ::testing::Test {
+protected:
+    HalfConversion()
+    {
+        // all values gko::half can represent, as it flushes subnormals to
+        // zero, except for NaN
+        for (int bits = 0; bits < 65536; ++bits) {
+            const auto bits16 = static_cast<gko::uint16>(bits);
+            gko::half value;
+            std::memcpy(&value, &bits16, sizeof(value));
+            const auto expected = static_cast<float>(value);
+            if (!std::isnan(expected)) {
+                values.push_back(gko::half{expected});
+                expected_values.push_back(expected);
+            }
+        }
+    }
+
+    std::vector<gko::half> values;
+    std::vector<float> expected_values;
+};
+
+
+TEST_F(HalfConversion, ConvertsLikeSoftwareConversion)
+{
+    // use a size which is not a multiple of the vector width
+    const auto n = values.size() - 3;
+    std::vector<float> result(n);
+
+    gko::kernels::omp::convert_half_values(values.data(), n, result.data());
+
+    for (gko::size_type i = 0; i < n; ++i) {
+        ASSERT_EQ(result[i], expected_values[i]) << i;
+    }
+}
+
+
+TEST_F(HalfConversion, ConvertsComplexLikeSoftwareConversion)
+{
+    const auto n = values.size() / 2 - 3;
+    std::vector<std::complex<gko::half>> complex_values;
+    for (gko::size_type i = 0; i < n; ++i) {
+        complex_values.emplace_back(values[2 * i], values[2 * i + 1]);
+    }
+    std::vector<std::complex<float>> result(n);
+
+    gko::kernels::omp::convert_half_values(complex_values.data(), n,
+                                           result.data());
+
+    for (gko::size_type i = 0; i < n; ++i) {
+        ASSERT_EQ(result[i].real(), expected_values[2 * i]) << i;
+        ASSERT_EQ(result[i].imag(), expected_values[2 * i + 1]) << i;
+    }
+}
+
+
+}  // namespace
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The symmetric CSR matrix format namespace.
+ * @ref SymmetricCsr
+ * @ingroup symmetric_csr
+ */
+namespace symmetric_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::SymmetricCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) = zero<ValueType>();
+        }
+    }
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            auto sum = zero<ValueType>();
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                const auto col = col_idxs[k];
+                sum += vals[k] * b->at(col, j);
+                if (col != row) {
+                    c->at(col, j) += vals[k] * b->at(row, j);
+                }
+            }
+            c->at(row, j) += sum;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            c->at(row, j) *= vbeta;
+        }
+    }
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < c->get_size()[1]; ++j) {
+            auto sum = zero<ValueType>();
+            for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                const auto col = col_idxs[k];
+                sum += vals[k] * b->at(col, j);
+                if (col != row) {
+                    c->at(col, j) += valpha * vals[k] * b->at(row, j);
+                }
+            }
+            c->at(row, j) += valpha * sum;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_upper_nonzeros_per_row(
+    std::shared_ptr<const ReferenceExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* source, IndexType* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        result[row] = 0;
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            if (col_idxs[k] >= static_cast<IndexType>(row)) {
+                result[row]++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_UPPER_NONZEROS_PER_ROW_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_upper(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Csr<ValueType, IndexType>* source,
+                matrix::SymmetricCsr<ValueType, IndexType>* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    const auto out_row_ptrs = result->get_const_row_ptrs();
+    const auto out_col_idxs = result->get_col_idxs();
+    const auto out_vals = result->get_values();
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        auto out_nz = out_row_ptrs[row];
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            if (col_idxs[k] >= static_cast<IndexType>(row)) {
+                out_col_idxs[out_nz] = col_idxs[k];
+                out_vals[out_nz] = vals[k];
+                out_nz++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_UPPER_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void count_nonzeros_per_row(
+    std::shared_ptr<const ReferenceExecutor> exec,
+    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+    IndexType* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+    std::fill_n(result, num_rows, IndexType{});
+    for (size_type row = 0; row < num_rows; ++row) {
+        result[row] += row_ptrs[row + 1] - row_ptrs[row];
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            if (col_idxs[k] != static_cast<IndexType>(row)) {
+                result[col_idxs[k]]++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COUNT_NONZEROS_PER_ROW_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                 const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto row_ptrs = source->get_const_row_ptrs();
+    const auto col_idxs = source->get_const_col_idxs();
+    const auto vals = source->get_const_values();
+    const auto num_rows = source->get_size()[0];
+    const auto out_row_ptrs = result->get_const_row_ptrs();
+    const auto out_col_idxs = result->get_col_idxs();
+    const auto out_vals = result->get_values();
+    // the lower entries of a row are mirrored from the previous rows in
+    // order, so they precede its upper entries and stay sorted
+    vector<IndexType> out_nz(out_row_ptrs, out_row_ptrs + num_rows, {exec});
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = col_idxs[k];
+            out_col_idxs[out_nz[row]] = col;
+            out_vals[out_nz[row]] = vals[k];
+            out_nz[row]++;
+            if (col != static_cast<IndexType>(row)) {
+                out_col_idxs[out_nz[col]] = row;
+                out_vals[out_nz[col]] = vals[k];
+                out_nz[col]++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+
+
+}  // namespace symmetric_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
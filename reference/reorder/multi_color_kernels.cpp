@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/multi_color_kernels.hpp"
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The multi-color reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace multi_color {
+
+
+template <typename IndexType>
+void compute_coloring(std::shared_ptr<const DefaultExecutor> exec,
+                      IndexType num_vertices, const IndexType* row_ptrs,
+                      const IndexType* col_idxs,
+                      gko::experimental::reorder::multi_color_distance distance,
+                      IndexType* colors)
+{
+    const auto distance_two =
+        distance == gko::experimental::reorder::multi_color_distance::two;
+    const auto invalid = invalid_index<IndexType>();
+    // the Jones-Plassmann coloring equals the greedy coloring in the order of
+    // decreasing priority
+    vector<IndexType> order(num_vertices, exec);
+    std::iota(order.begin(), order.end(), IndexType{});
+    std::sort(order.begin(), order.end(), [](IndexType a, IndexType b) {
+        return coloring_priority(a) > coloring_priority(b);
+    });
+    std::fill_n(colors, num_vertices, invalid);
+    // forbidden[c] == v if a neighbor of v has color c
+    vector<IndexType> forbidden(num_vertices + 1, invalid, exec);
+    const auto forbid = [&](IndexType v, IndexType u) {
+        if (u != v && colors[u] != invalid) {
+            forbidden[colors[u]] = v;
+        }
+    };
+    for (const auto v : order) {
+        for (auto nz = row_ptrs[v]; nz < row_ptrs[v + 1]; nz++) {
+            const auto u = col_idxs[nz];
+            if (u == v) {
+                continue;
+            }
+            forbid(v, u);
+            if (distance_two) {
+                for (auto nz2 = row_ptrs[u]; nz2 < row_ptrs[u + 1]; nz2++) {
+                    forbid(v, col_idxs[nz2]);
+                }
+            }
+        }
+        IndexType color{};
+        while (forbidden[color] == v) {
+            color++;
+        }
+        colors[v] = color;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_MULTI_COLOR_COMPUTE_COLORING_KERNEL);
+
+
+}  // namespace multi_color
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
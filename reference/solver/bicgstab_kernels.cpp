@@ -154,6 +154,31 @@ void step_3(
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_3_KERNEL);
 
 
+template <typename ValueType>
+void step_3_and_dot(
+    std::shared_ptr<const ReferenceExecutor> exec, matrix::Dense<ValueType>* x,
+    matrix::Dense<ValueType>* r, const matrix::Dense<ValueType>* s,
+    const matrix::Dense<ValueType>* t, const matrix::Dense<ValueType>* y,
+    const matrix::Dense<ValueType>* z, const matrix::Dense<ValueType>* rr,
+    const matrix::Dense<ValueType>* alpha, const matrix::Dense<ValueType>* beta,
+    const matrix::Dense<ValueType>* gamma, matrix::Dense<ValueType>* omega,
+    matrix::Dense<ValueType>* new_rho, array<char>& tmp,
+    const array<stopping_status>* stop_status)
+{
+    step_3(exec, x, r, s, t, y, z, alpha, beta, gamma, omega, stop_status);
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        new_rho->at(j) = zero<ValueType>();
+    }
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            new_rho->at(j) += conj(rr->at(i, j)) * r->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BICGSTAB_STEP_3_AND_DOT_KERNEL);
+
+
 template <typename ValueType>
 void finalize(std::shared_ptr<const ReferenceExecutor> exec,
               matrix::Dense<ValueType>* x, const matrix::Dense<ValueType>* y,
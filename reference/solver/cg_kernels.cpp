@@ -97,6 +97,30 @@ void step_2(std::shared_ptr<const ReferenceExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_KERNEL);
 
 
+template <typename ValueType>
+void step_2_and_dot(std::shared_ptr<const ReferenceExecutor> exec,
+                    matrix::Dense<ValueType>* x, matrix::Dense<ValueType>* r,
+                    const matrix::Dense<ValueType>* p,
+                    const matrix::Dense<ValueType>* q,
+                    const matrix::Dense<ValueType>* beta,
+                    const matrix::Dense<ValueType>* rho,
+                    matrix::Dense<ValueType>* new_rho, array<char>& tmp,
+                    const array<stopping_status>* stop_status)
+{
+    step_2(exec, x, r, p, q, beta, rho, stop_status);
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        new_rho->at(j) = zero<ValueType>();
+    }
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            new_rho->at(j) += conj(r->at(i, j)) * r->at(i, j);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_CG_STEP_2_AND_DOT_KERNEL);
+
+
 }  // namespace cg
 }  // namespace reference
 }  // namespace kernels
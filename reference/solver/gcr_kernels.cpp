@@ -86,6 +86,33 @@ void step_1(std::shared_ptr<const ReferenceExecutor> exec,
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GCR_STEP_1_KERNEL);
 
 
+template <typename ValueType>
+void step_1_and_norm(
+    std::shared_ptr<const ReferenceExecutor> exec, matrix::Dense<ValueType>* x,
+    matrix::Dense<ValueType>* residual, const matrix::Dense<ValueType>* p,
+    const matrix::Dense<ValueType>* Ap,
+    const matrix::Dense<remove_complex<ValueType>>* Ap_norm,
+    const matrix::Dense<ValueType>* rAp,
+    matrix::Dense<remove_complex<ValueType>>* residual_norm, array<char>& tmp,
+    const stopping_status* stop_status)
+{
+    step_1(exec, x, residual, p, Ap, Ap_norm, rAp, stop_status);
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        residual_norm->at(j) = zero<remove_complex<ValueType>>();
+    }
+    for (size_type i = 0; i < x->get_size()[0]; ++i) {
+        for (size_type j = 0; j < x->get_size()[1]; ++j) {
+            residual_norm->at(j) += squared_norm(residual->at(i, j));
+        }
+    }
+    for (size_type j = 0; j < x->get_size()[1]; ++j) {
+        residual_norm->at(j) = sqrt(residual_norm->at(j));
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_GCR_STEP_1_AND_NORM_KERNEL);
+
+
 }  // namespace gcr
 }  // namespace reference
 }  // namespace kernels
@@ -0,0 +1,259 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/compressed_csr.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/compressed_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class CompressedCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::CompressedCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    CompressedCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          // all values are exactly representable in every storage precision
+          csr(gko::initialize<Csr>(
+              {{1.0, 3.0, 2.0}, {0.0, 5.0, 0.0}, {0.0, 0.0, 0.0}}, exec)),
+          b(gko::initialize<Vec>(
+              {I<value_type>{2.0, 3.0}, I<value_type>{1.0, -1.5},
+               I<value_type>{4.0, 2.5}},
+              exec)),
+          x(gko::initialize<Vec>(
+              {I<value_type>{1.0, 2.0}, I<value_type>{3.0, 4.0},
+               I<value_type>{5.0, 6.0}},
+              exec))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+};
+
+TYPED_TEST_SUITE(CompressedCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(CompressedCsr, AppliesToDenseVector)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto mtx = Mtx::create(this->exec, this->csr.get());
+    auto expected = this->x->clone();
+    this->csr->apply(this->b, expected);
+
+    mtx->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x,
+                        l({I<T>{13.0, 3.5}, I<T>{5.0, -7.5}, I<T>{0.0, 0.0}}),
+                        0.0);
+    GKO_ASSERT_MTX_NEAR(this->x, expected, 0.0);
+}
+
+
+TYPED_TEST(CompressedCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto mtx = Mtx::create(this->exec, this->csr.get());
+
+    mtx->apply(alpha, this->b, beta, this->x);
+
+    GKO_ASSERT_MTX_NEAR(
+        this->x, l({I<T>{-11.0, 0.5}, I<T>{1.0, 15.5}, I<T>{10.0, 12.0}}),
+        0.0);
+}
+
+
+TYPED_TEST(CompressedCsr, AppliesWithRowScaling)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto mtx = Mtx::create(this->exec, this->csr.get(),
+                           gko::precision_reduction(0, 2), true);
+
+    mtx->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x,
+                        l({I<T>{13.0, 3.5}, I<T>{5.0, -7.5}, I<T>{0.0, 0.0}}),
+                        1e-3);
+    EXPECT_EQ(mtx->get_const_row_scales()[0], 3.0);
+    EXPECT_EQ(mtx->get_const_row_scales()[1], 5.0);
+    // empty rows are not scaled
+    EXPECT_EQ(mtx->get_const_row_scales()[2], 1.0);
+}
+
+
+TYPED_TEST(CompressedCsr, AppliesInAllStoragePrecisions)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+
+    for (auto precision :
+         {gko::precision_reduction(0, 0), gko::precision_reduction(0, 1),
+          gko::precision_reduction(0, 2), gko::precision_reduction(1, 0),
+          gko::precision_reduction(1, 1), gko::precision_reduction(2, 0)}) {
+        SCOPED_TRACE(static_cast<int>(precision));
+        auto mtx = Mtx::create(this->exec, this->csr.get(), precision);
+        auto x = this->x->clone();
+
+        mtx->apply(this->b, x);
+
+        GKO_ASSERT_MTX_NEAR(
+            x, l({I<T>{13.0, 3.5}, I<T>{5.0, -7.5}, I<T>{0.0, 0.0}}), 0.0);
+    }
+}
+
+
+TYPED_TEST(CompressedCsr, RoundsValuesToStoragePrecision)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using storage_type = gko::reduce_precision<value_type>;
+    auto csr = gko::initialize<Csr>({I<value_type>{1.0 / 3.0}}, this->exec);
+    auto mtx = Mtx::create(this->exec, csr.get());
+    auto result = Csr::create(this->exec);
+
+    mtx->convert_to(result);
+
+    ASSERT_EQ(result->get_const_values()[0],
+              static_cast<value_type>(
+                  static_cast<storage_type>(csr->get_const_values()[0])));
+}
+
+
+TYPED_TEST(CompressedCsr, ConvertsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, this->csr.get(),
+                           gko::precision_reduction(0, 1), true);
+    auto result = Csr::create(this->exec,
+                              std::make_shared<typename Csr::classical>());
+
+    mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_NEAR(result, this->csr, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->csr);
+    ASSERT_EQ(result->get_strategy()->get_name(), "classical");
+}
+
+
+TYPED_TEST(CompressedCsr, AppliesWithDeltaCompressedIndexes)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto csr = Csr::create(this->exec);
+    csr->read(gko::matrix_data<value_type, index_type>{
+        {3, 300},
+        {{0, 0, 1.0},
+         {0, 1, 3.0},
+         {0, 200, 2.0},
+         {1, 128, 5.0},
+         {1, 299, -1.0},
+         {2, 150, 4.0}}});
+    auto b = Vec::create(this->exec, gko::dim<2>{300, 1});
+    for (gko::size_type i = 0; i < 300; ++i) {
+        b->at(i, 0) = static_cast<value_type>(i % 7);
+    }
+    auto expected = Vec::create(this->exec, gko::dim<2>{3, 1});
+    csr->apply(b, expected);
+
+    for (auto compression :
+         {gko::matrix::compressed_csr::index_compression::delta8,
+          gko::matrix::compressed_csr::index_compression::delta16}) {
+        SCOPED_TRACE(static_cast<int>(compression));
+        auto mtx = Mtx::create(this->exec, csr.get(),
+                               gko::precision_reduction(0, 1), false,
+                               compression);
+        auto x = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+        mtx->apply(b, x);
+
+        GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+    }
+}
+
+
+TYPED_TEST(CompressedCsr, ConvertsToCsrWithDeltaCompressedIndexes)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto csr = Csr::create(this->exec);
+    csr->read(gko::matrix_data<value_type, index_type>{
+        {3, 300},
+        {{0, 0, 1.0},
+         {0, 200, 2.0},
+         {1, 0, 5.0},
+         {1, 299, -1.0},
+         {2, 1, 4.0}}});
+    auto mtx = Mtx::create(
+        this->exec, csr.get(), gko::precision_reduction(0, 1), false,
+        gko::matrix::compressed_csr::index_compression::delta8);
+    auto result = Csr::create(this->exec);
+
+    mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_NEAR(result, csr, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, csr);
+    ASSERT_EQ(mtx->get_num_outliers(), 2);
+}
+
+
+TYPED_TEST(CompressedCsr, AppliesToComplex)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    using complex_type = gko::to_complex<T>;
+    using Vec = gko::matrix::Dense<complex_type>;
+    auto mtx = Mtx::create(this->exec, this->csr.get());
+    auto b = gko::initialize<Vec>(
+        {complex_type{1.0, -1.0}, complex_type{2.0, 0.5},
+         complex_type{0.0, 1.0}},
+        this->exec);
+    auto x = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    mtx->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(
+        x,
+        l({complex_type{7.0, 2.5}, complex_type{10.0, 2.5},
+           complex_type{0.0, 0.0}}),
+        0.0);
+}
+
+
+}  // namespace
@@ -0,0 +1,232 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/multigrid/pgm.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/solver/fcg.hpp>
+#include <ginkgo/core/solver/multigrid.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          csr(gko::initialize<Csr>(
+              {{2.0, 1.0, 0.0}, {1.0, 3.0, -1.0}, {0.0, -1.0, 4.0}}, exec)),
+          mtx(Mtx::create(exec, csr.get())),
+          b(gko::initialize<Vec>(
+              {I<value_type>{1.0, 2.0}, I<value_type>{2.0, 0.5},
+               I<value_type>{3.0, -1.0}},
+              exec)),
+          x(gko::initialize<Vec>(
+              {I<value_type>{1.0, 2.0}, I<value_type>{3.0, 4.0},
+               I<value_type>{5.0, 6.0}},
+              exec))
+    {}
+
+    /** Returns the diagonally dominant tridiagonal matrix (-1, 4, -1). */
+    std::unique_ptr<Csr> generate_tridiagonal(gko::size_type size)
+    {
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>{size}};
+        for (gko::size_type i = 0; i < size; ++i) {
+            if (i > 0) {
+                data.nonzeros.emplace_back(i, i - 1, -1.0);
+            }
+            data.nonzeros.emplace_back(i, i, 4.0);
+            if (i + 1 < size) {
+                data.nonzeros.emplace_back(i, i + 1, -1.0);
+            }
+        }
+        auto result = Csr::create(exec);
+        result->read(data);
+        return result;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+};
+
+TYPED_TEST_SUITE(SymmetricCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsr, AppliesToDenseVector)
+{
+    using T = typename TestFixture::value_type;
+
+    this->mtx->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x,
+                        l({I<T>{4.0, 4.5}, I<T>{4.0, 4.5}, I<T>{10.0, -4.5}}),
+                        0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+
+    this->mtx->apply(alpha, this->b, beta, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x,
+                        l({I<T>{-2.0, -0.5}, I<T>{2.0, 3.5}, I<T>{0.0, 16.5}}),
+                        0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesToComplex)
+{
+    using T = typename TestFixture::value_type;
+    using complex_type = gko::to_complex<T>;
+    using Vec = gko::matrix::Dense<complex_type>;
+    auto b = gko::initialize<Vec>(
+        {complex_type{1.0, -1.0}, complex_type{2.0, 0.5},
+         complex_type{0.0, 1.0}},
+        this->exec);
+    auto x = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    this->mtx->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(
+        x,
+        l({complex_type{4.0, -1.5}, complex_type{7.0, -0.5},
+           complex_type{-2.0, 3.5}}),
+        0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, ConvertsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto result =
+        Csr::create(this->exec, std::make_shared<typename Csr::classical>());
+
+    this->mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_NEAR(result, this->csr, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->csr);
+    ASSERT_TRUE(result->is_sorted_by_column_index());
+    ASSERT_EQ(result->get_strategy()->get_name(), "classical");
+}
+
+
+TYPED_TEST(SymmetricCsr, ConvertsEmptyToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+    auto result = Csr::create(this->exec);
+
+    mtx->convert_to(result);
+
+    ASSERT_EQ(result->get_size(), gko::dim<2>{});
+    ASSERT_EQ(result->get_num_stored_elements(), 0);
+}
+
+
+TYPED_TEST(SymmetricCsr, IsUsableAsCgSystemMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto csr = this->generate_tridiagonal(50);
+    auto mtx = gko::share(Mtx::create(this->exec, csr.get()));
+    auto expected = Vec::create(this->exec, gko::dim<2>{50, 1});
+    expected->fill(1.0);
+    auto b = Vec::create(this->exec, gko::dim<2>{50, 1});
+    csr->apply(expected, b);
+    auto criteria =
+        gko::stop::ResidualNorm<value_type>::build().with_reduction_factor(
+            r<value_type>::value);
+    auto cg = gko::solver::Cg<value_type>::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(50u),
+                      criteria)
+                  .on(this->exec)
+                  ->generate(mtx);
+    auto fcg = gko::solver::Fcg<value_type>::build()
+                   .with_criteria(
+                       gko::stop::Iteration::build().with_max_iters(50u),
+                       criteria)
+                   .on(this->exec)
+                   ->generate(mtx);
+
+    for (auto solver : {gko::as<gko::LinOp>(cg.get()),
+                        gko::as<gko::LinOp>(fcg.get())}) {
+        auto x = Vec::create(this->exec, gko::dim<2>{50, 1});
+        x->fill(0.0);
+
+        solver->apply(b, x);
+
+        GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value * 10);
+    }
+}
+
+
+TYPED_TEST(SymmetricCsr, IsUsableAsMultigridSystemMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto csr = this->generate_tridiagonal(100);
+    auto mtx = gko::share(Mtx::create(this->exec, csr.get()));
+    auto expected = Vec::create(this->exec, gko::dim<2>{100, 1});
+    expected->fill(1.0);
+    auto b = Vec::create(this->exec, gko::dim<2>{100, 1});
+    csr->apply(expected, b);
+    auto x = Vec::create(this->exec, gko::dim<2>{100, 1});
+    x->fill(0.0);
+    auto multigrid =
+        gko::solver::Multigrid::build()
+            .with_mg_level(gko::multigrid::Pgm<value_type, index_type>::build()
+                               .with_deterministic(true))
+            .with_min_coarse_rows(10u)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(100u),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value))
+            .on(this->exec)
+            ->generate(mtx);
+
+    multigrid->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value * 10);
+}
+
+
+}  // namespace
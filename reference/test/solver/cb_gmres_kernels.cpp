@@ -13,6 +13,7 @@
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/record.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/preconditioner/jacobi.hpp>
 #include <ginkgo/core/stop/combined.hpp>
@@ -102,6 +103,8 @@ protected:
             return r<reduce_precision<value_type>, nc_value_type>::value;
         case storage_precision::reduce2:
         case storage_precision::ireduce2:
+        // the adaptive storage may keep the most compressed basis
+        case storage_precision::adaptive:
             return r<reduce_precision<reduce_precision<value_type>>,
                      nc_value_type>::value;
         case storage_precision::integer:
@@ -138,17 +141,20 @@ using st_r2 = st_helper_type<st_enum::reduce2>;
 using st_i = st_helper_type<st_enum::integer>;
 using st_ir1 = st_helper_type<st_enum::ireduce1>;
 using st_ir2 = st_helper_type<st_enum::ireduce2>;
+using st_a = st_helper_type<st_enum::adaptive>;
 
 using TestTypes =
     ::testing::Types<std::tuple<double, st_keep>, std::tuple<double, st_r1>,
                      std::tuple<double, st_r2>, std::tuple<double, st_i>,
                      std::tuple<double, st_ir1>, std::tuple<double, st_ir2>,
-                     std::tuple<float, st_keep>, std::tuple<float, st_r1>,
-                     std::tuple<float, st_r2>, std::tuple<float, st_i>,
-                     std::tuple<float, st_ir1>, std::tuple<float, st_ir2>,
+                     std::tuple<double, st_a>, std::tuple<float, st_keep>,
+                     std::tuple<float, st_r1>, std::tuple<float, st_r2>,
+                     std::tuple<float, st_i>, std::tuple<float, st_ir1>,
+                     std::tuple<float, st_ir2>, std::tuple<float, st_a>,
                      std::tuple<std::complex<double>, st_keep>,
                      std::tuple<std::complex<double>, st_r1>,
                      std::tuple<std::complex<double>, st_r2>,
+                     std::tuple<std::complex<double>, st_a>,
                      std::tuple<std::complex<float>, st_keep>>;
 
 TYPED_TEST_SUITE(CbGmres, TestTypes, PairTypenameNameGenerator);
@@ -535,4 +541,52 @@ TYPED_TEST(CbGmres, SolvesWithPreconditioner)
 }
 
 
+TEST(CbGmresAdaptive, EscalatesStoragePrecisionAtRestarts)
+{
+    using value_type = double;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using gko::solver::cb_gmres::storage_precision;
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::share(
+        gko::initialize<Mtx>({{-86.40, 153.30, -108.90, 8.60, -61.60},
+                              {7.70, -77.00, 3.30, -149.20, 74.80},
+                              {-121.40, 37.10, 55.30, -74.20, -19.20},
+                              {-111.40, -22.60, 110.10, -106.20, 88.90},
+                              {-0.70, 111.70, 154.40, 235.00, -76.50}},
+                             exec));
+    auto logger = gko::share(gko::log::Record::create(
+        gko::log::Logger::krylov_storage_precision_selected_mask));
+    // every full restart cycle counts as stagnating
+    auto solver =
+        gko::solver::CbGmres<value_type>::build()
+            .with_krylov_dim(4u)
+            .with_storage_precision(storage_precision::adaptive)
+            .with_adaptive_stagnation_ratio(0.0)
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(200u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_baseline(gko::stop::mode::initial_resnorm)
+                               .with_reduction_factor(r<value_type>::value))
+            .on(exec)
+            ->generate(mtx);
+    solver->add_logger(logger);
+    auto b = gko::initialize<Mtx>(
+        {-13945.16, 11205.66, 16132.96, 24342.18, -10910.98}, exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0, 0.0, 0.0}, exec);
+
+    solver->apply(b, x);
+
+    const auto& selected = logger->get().krylov_storage_precision_selected;
+    ASSERT_EQ(selected.size(), 3);
+    ASSERT_EQ(selected[0]->solver, solver.get());
+    ASSERT_EQ(selected[0]->num_iterations, 0);
+    ASSERT_EQ(selected[0]->precision, storage_precision::reduce2);
+    ASSERT_EQ(selected[1]->num_iterations, 4);
+    ASSERT_EQ(selected[1]->precision, storage_precision::reduce1);
+    ASSERT_EQ(selected[2]->num_iterations, 8);
+    ASSERT_EQ(selected[2]->precision, storage_precision::keep);
+    GKO_ASSERT_MTX_NEAR(x, l({-140.20, -142.20, 48.80, -17.70, -19.60}),
+                        std::sqrt(r<value_type>::value));
+}
+
+
 }  // namespace
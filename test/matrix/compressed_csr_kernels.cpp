@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/compressed_csr_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/compressed_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "test/utils/executor.hpp"
+
+
+namespace {
+
+
+class CompressedCsr : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::CompressedCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    CompressedCsr() : rng{42}
+    {
+        csr = gko::test::generate_random_matrix<Csr>(
+            532, 231, std::uniform_int_distribution<>(0, 20),
+            std::normal_distribution<>(-1.0, 1.0), rng, ref);
+        b = gko::test::generate_random_matrix<Vec>(
+            231, 3, std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<>(-1.0, 1.0), rng, ref);
+        x = gko::test::generate_random_matrix<Vec>(
+            532, 3, std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<>(-1.0, 1.0), rng, ref);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        db = gko::clone(exec, b);
+        dx = gko::clone(exec, x);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    void set_up(gko::precision_reduction storage_precision, bool row_scaling,
+                gko::matrix::compressed_csr::index_compression compression =
+                    gko::matrix::compressed_csr::index_compression::none)
+    {
+        mtx = Mtx::create(ref, csr.get(), storage_precision, row_scaling,
+                          compression);
+        dmtx = Mtx::create(exec, csr.get(), storage_precision, row_scaling,
+                           compression);
+    }
+
+    std::default_random_engine rng;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> db;
+    std::unique_ptr<Vec> x;
+    std::unique_ptr<Vec> dx;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> beta;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(CompressedCsr, CompressIsEquivalentToRef)
+{
+    set_up(gko::precision_reduction(0, 1), true);
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(ref, mtx->get_size()[0],
+                                   mtx->get_const_row_scales()),
+        gko::make_const_array_view(exec, dmtx->get_size()[0],
+                                   dmtx->get_const_row_scales()));
+    GKO_ASSERT_MTX_NEAR(mtx, dmtx, 0.0);
+}
+
+
+TEST_F(CompressedCsr, SimpleApplyIsEquivalentToRef)
+{
+    for (auto row_scaling : {false, true}) {
+        SCOPED_TRACE(row_scaling);
+        set_up(gko::precision_reduction(0, 2), row_scaling);
+        auto result = x->clone();
+        auto dresult = dx->clone();
+
+        mtx->apply(b, result);
+        dmtx->apply(db, dresult);
+
+        GKO_ASSERT_MTX_NEAR(dresult, result, r<value_type>::value);
+    }
+}
+
+
+TEST_F(CompressedCsr, AdvancedApplyIsEquivalentToRef)
+{
+    set_up(gko::precision_reduction(1, 1), true);
+
+    mtx->apply(alpha, b, beta, x);
+    dmtx->apply(dalpha, db, dbeta, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(CompressedCsr, CompressIndexesIsEquivalentToRef)
+{
+    set_up(gko::precision_reduction(0, 1), false,
+           gko::matrix::compressed_csr::index_compression::delta8);
+    const auto nnz = mtx->get_num_stored_elements();
+    const auto num_rows = mtx->get_size()[0];
+
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(ref, nnz, mtx->get_const_col_deltas()),
+        gko::make_const_array_view(exec, nnz, dmtx->get_const_col_deltas()));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(ref, num_rows + 1,
+                                   mtx->get_const_outlier_ptrs()),
+        gko::make_const_array_view(exec, num_rows + 1,
+                                   dmtx->get_const_outlier_ptrs()));
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(ref, mtx->get_num_outliers(),
+                                   mtx->get_const_outlier_cols()),
+        gko::make_const_array_view(exec, dmtx->get_num_outliers(),
+                                   dmtx->get_const_outlier_cols()));
+}
+
+
+TEST_F(CompressedCsr, ApplyWithCompressedIndexesIsEquivalentToRef)
+{
+    for (auto compression :
+         {gko::matrix::compressed_csr::index_compression::delta8,
+          gko::matrix::compressed_csr::index_compression::delta16}) {
+        SCOPED_TRACE(static_cast<int>(compression));
+        set_up(gko::precision_reduction(0, 1), true, compression);
+        auto result = x->clone();
+        auto dresult = dx->clone();
+
+        mtx->apply(alpha, b, beta, result);
+        dmtx->apply(dalpha, db, dbeta, dresult);
+
+        GKO_ASSERT_MTX_NEAR(dresult, result, r<value_type>::value);
+    }
+}
+
+
+TEST_F(CompressedCsr, ConvertToCsrIsEquivalentToRef)
+{
+    set_up(gko::precision_reduction(0, 1), true);
+    auto result = Csr::create(ref);
+    auto dresult = Csr::create(exec);
+
+    mtx->convert_to(result);
+    dmtx->convert_to(dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, result, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dresult, result);
+}
+
+
+}  // namespace
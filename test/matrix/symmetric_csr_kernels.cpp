@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "core/test/utils/matrix_generator.hpp"
+#include "core/utils/matrix_utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+namespace {
+
+
+class SymmetricCsr : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsr() : rng{42}
+    {
+        auto data =
+            gko::test::generate_random_matrix_data<value_type, index_type>(
+                532, 532, std::uniform_int_distribution<>(0, 20),
+                std::normal_distribution<>(-1.0, 1.0), rng);
+        gko::utils::make_symmetric(data);
+        csr = Csr::create(ref);
+        csr->read(data);
+        mtx = Mtx::create(ref, csr.get());
+        dmtx = Mtx::create(exec, csr.get());
+        b = gko::test::generate_random_matrix<Vec>(
+            532, 3, std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<>(-1.0, 1.0), rng, ref);
+        x = gko::test::generate_random_matrix<Vec>(
+            532, 3, std::uniform_int_distribution<>(3, 3),
+            std::normal_distribution<>(-1.0, 1.0), rng, ref);
+        alpha = gko::initialize<Vec>({2.0}, ref);
+        beta = gko::initialize<Vec>({-1.0}, ref);
+        db = gko::clone(exec, b);
+        dx = gko::clone(exec, x);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    std::default_random_engine rng;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> db;
+    std::unique_ptr<Vec> x;
+    std::unique_ptr<Vec> dx;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> beta;
+    std::unique_ptr<Vec> dbeta;
+};
+
+
+TEST_F(SymmetricCsr, ReadUpperIsEquivalentToRef)
+{
+    GKO_ASSERT_MTX_NEAR(mtx, dmtx, 0.0);
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(ref, mtx->get_size()[0] + 1,
+                                   mtx->get_const_row_ptrs()),
+        gko::make_const_array_view(exec, dmtx->get_size()[0] + 1,
+                                   dmtx->get_const_row_ptrs()));
+}
+
+
+TEST_F(SymmetricCsr, SimpleApplyIsEquivalentToRef)
+{
+    mtx->apply(b, x);
+    dmtx->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, AdvancedApplyIsEquivalentToRef)
+{
+    mtx->apply(alpha, b, beta, x);
+    dmtx->apply(dalpha, db, dbeta, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, ApplyIsEquivalentToCsr)
+{
+    auto dcsr = gko::clone(exec, csr);
+    auto expected = dx->clone();
+
+    dcsr->apply(db, expected);
+    dmtx->apply(db, dx);
+
+    GKO_ASSERT_MTX_NEAR(dx, expected, r<value_type>::value);
+}
+
+
+TEST_F(SymmetricCsr, ConvertToCsrIsEquivalentToRef)
+{
+    auto result = Csr::create(ref);
+    auto dresult = Csr::create(exec);
+
+    mtx->convert_to(result);
+    dmtx->convert_to(dresult);
+
+    GKO_ASSERT_MTX_NEAR(dresult, result, 0.0);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dresult, result);
+    GKO_ASSERT_MTX_NEAR(dresult, csr, 0.0);
+}
+
+
+}  // namespace
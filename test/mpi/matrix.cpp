@@ -156,6 +156,55 @@ TYPED_TEST(MatrixCreation, ReadsDistributedWithColPartition)
 }
 
 
+TYPED_TEST(MatrixCreation, ReadsDistributedNonLocalDataWithCommunication)
+{
+    using value_type = typename TestFixture::value_type;
+    using csr = typename TestFixture::local_matrix_type;
+    I<I<value_type>> res_local[] = {{{0, 1}, {0, 3}}, {{6, 0}, {0, 8}}, {{10}}};
+    I<I<value_type>> res_non_local[] = {
+        {{0, 2}, {4, 0}}, {{5, 0}, {0, 7}}, {{9}}};
+    auto rank = this->dist_mat->get_communicator().rank();
+
+    this->dist_mat->read_distributed(
+        this->dist_input[(rank + 1) % 3], this->row_part,
+        gko::experimental::distributed::assembly_mode::communicate);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_local_matrix()),
+                        res_local[rank], 0);
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_non_local_matrix()),
+                        res_non_local[rank], 0);
+}
+
+
+TYPED_TEST(MatrixCreation, SumsCommunicatedEntriesInChunks)
+{
+    using value_type = typename TestFixture::value_type;
+    using csr = typename TestFixture::local_matrix_type;
+    using matrix_data = typename TestFixture::matrix_data;
+    I<I<value_type>> res_local[] = {{{2, 0}, {0, 0}}, {{0, 5}, {0, 0}}, {{0}}};
+    I<I<value_type>> res_non_local[] = {
+        {{1, 0}, {3, 4}}, {{0, 0, 6}, {8, 7, 0}}, {{10, 9}}};
+    auto rank = this->dist_mat->get_communicator().rank();
+    // every rank contributes to every entry, the contributions sum up to
+    // the entries of mat_input
+    value_type scale[] = {1, 2, -2};
+    matrix_data input{this->size};
+    for (auto entry : this->mat_input.nonzeros) {
+        entry.value *= scale[rank];
+        input.nonzeros.push_back(entry);
+    }
+
+    this->dist_mat->read_distributed(
+        input, this->row_part, this->col_part,
+        gko::experimental::distributed::assembly_mode::communicate, 1);
+
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_local_matrix()),
+                        res_local[rank], 0);
+    GKO_ASSERT_MTX_NEAR(gko::as<csr>(this->dist_mat->get_non_local_matrix()),
+                        res_non_local[rank], 0);
+}
+
+
 TYPED_TEST(MatrixCreation, BuildOnlyLocal)
 {
     using value_type = typename TestFixture::value_type;
@@ -461,6 +510,27 @@ TYPED_TEST(Matrix, CanApplyToMultipleVectors)
 }
 
 
+TYPED_TEST(Matrix, CanApplyWithProgressThread)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::global_index_type;
+    auto vec_md = gko::matrix_data<value_type, index_type>{
+        I<I<value_type>>{{1, 11}, {2, 22}, {3, 33}, {4, 44}, {5, 55}}};
+    I<I<value_type>> result[3] = {
+        {{10, 110}, {18, 198}}, {{28, 308}, {67, 737}}, {{59, 649}}};
+    auto rank = this->comm.rank();
+    this->x->read_distributed(vec_md, this->col_part);
+    this->y->read_distributed(vec_md, this->row_part);
+    this->dist_mat->set_progress_thread(true);
+
+    this->dist_mat->apply(this->x, this->y);
+
+    GKO_ASSERT_MTX_NEAR(this->y->get_local_vector(), result[rank], 0);
+    this->dist_mat->set_progress_thread(false);
+    ASSERT_FALSE(this->dist_mat->has_progress_thread());
+}
+
+
 TYPED_TEST(Matrix, CanAdvancedApplyToSingleVector)
 {
     using value_type = typename TestFixture::value_type;
@@ -520,6 +590,107 @@ TYPED_TEST(Matrix, CanAdvancedApplyToMultipleVectorsLarge)
 }
 
 
+TYPED_TEST(Matrix, CanTranspose)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::global_index_type;
+    using csr_mtx_type = typename TestFixture::csr_mtx_type;
+    using dense_vec_type = typename TestFixture::dense_vec_type;
+    auto vec_md = gko::matrix_data<value_type, index_type>{
+        I<I<value_type>>{{1}, {2}, {3}, {4}, {5}}};
+    auto rank = this->comm.rank();
+    this->x->read_distributed(vec_md, this->row_part);
+    this->y->read_distributed(vec_md, this->col_part);
+    this->dense_x->read(vec_md);
+    this->dense_y->read(vec_md);
+
+    auto trans = gko::as<typename TestFixture::dist_mtx_type>(
+        this->dist_mat->transpose());
+    trans->apply(this->x, this->y);
+    gko::as<csr_mtx_type>(this->csr_mat->transpose())
+        ->apply(this->dense_x, this->dense_y);
+
+    ASSERT_EQ(trans->get_size(), gko::transpose(this->dist_mat->get_size()));
+    ASSERT_EQ(trans->get_row_partition(), this->col_part);
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->col_part.get(), rank);
+}
+
+
+TYPED_TEST(Matrix, CanMultiply)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::global_index_type;
+    using csr_mtx_type = typename TestFixture::csr_mtx_type;
+    auto vec_md = gko::matrix_data<value_type, index_type>{
+        I<I<value_type>>{{1}, {2}, {3}, {4}, {5}}};
+    auto rank = this->comm.rank();
+    this->x->read_distributed(vec_md, this->row_part);
+    this->y->read_distributed(vec_md, this->row_part);
+    this->dense_x->read(vec_md);
+    this->dense_y->read(vec_md);
+    auto trans = gko::as<typename TestFixture::dist_mtx_type>(
+        this->dist_mat->transpose());
+    auto csr_product = csr_mtx_type::create(this->exec, this->size);
+
+    auto product = this->dist_mat->multiply(trans);
+    product->apply(this->x, this->y);
+    this->csr_mat->apply(this->csr_mat->transpose(), csr_product);
+    csr_product->apply(this->dense_x, this->dense_y);
+
+    ASSERT_EQ(product->get_size(), this->size);
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part.get(), rank);
+}
+
+
+TYPED_TEST(Matrix, CanRecomputeProductValues)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::global_index_type;
+    using csr_mtx_type = typename TestFixture::csr_mtx_type;
+    auto vec_md = gko::matrix_data<value_type, index_type>{
+        I<I<value_type>>{{1}, {2}, {3}, {4}, {5}}};
+    auto rank = this->comm.rank();
+    gko::matrix_data<value_type, index_type> scaled_md;
+    this->csr_mat->write(scaled_md);
+    for (auto& entry : scaled_md.nonzeros) {
+        entry.value *= value_type{2};
+    }
+    auto scaled = TestFixture::dist_mtx_type::create(this->exec, this->comm);
+    scaled->read_distributed(scaled_md, this->row_part, this->col_part);
+    auto trans = gko::as<typename TestFixture::dist_mtx_type>(
+        this->dist_mat->transpose());
+    auto product = this->dist_mat->multiply(trans);
+    auto csr_scaled = csr_mtx_type::create(this->exec);
+    csr_scaled->read(scaled_md);
+    auto csr_product = csr_mtx_type::create(this->exec, this->size);
+    this->x->read_distributed(vec_md, this->row_part);
+    this->y->read_distributed(vec_md, this->row_part);
+    this->dense_x->read(vec_md);
+    this->dense_y->read(vec_md);
+
+    scaled->multiply_numeric(trans, product);
+    product->apply(this->x, this->y);
+    csr_scaled->apply(this->csr_mat->transpose(), csr_product);
+    csr_product->apply(this->dense_x, this->dense_y);
+
+    this->assert_local_vector_equal_to_global_vector(
+        this->y.get(), this->dense_y.get(), this->row_part.get(), rank);
+}
+
+
+TYPED_TEST(Matrix, RecomputingValuesRequiresProduct)
+{
+    auto trans = gko::as<typename TestFixture::dist_mtx_type>(
+        this->dist_mat->transpose());
+    auto result = TestFixture::dist_mtx_type::create(this->exec, this->comm);
+
+    ASSERT_THROW(this->dist_mat->multiply_numeric(trans, result),
+                 gko::NotSupported);
+}
+
+
 TYPED_TEST(Matrix, CanConvertToNextPrecision)
 {
     using T = typename TestFixture::value_type;
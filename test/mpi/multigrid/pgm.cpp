@@ -4,6 +4,7 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 
 #include <mpi.h>
@@ -18,6 +19,7 @@
 #include <ginkgo/core/distributed/matrix.hpp>
 #include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
+#include <ginkgo/core/log/record.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/multigrid/pgm.hpp>
 
@@ -51,6 +53,7 @@ protected:
                                                   global_index_type>;
     using matrix_data = gko::matrix_data<value_type, global_index_type>;
     using pgm = gko::multigrid::Pgm<value_type, local_index_type>;
+    using dist_vec_type = gko::experimental::distributed::Vector<value_type>;
 
     Pgm()
         : size{8, 8}, mat_input{size, {{0, 0, 5},  {0, 1, -1}, {1, 0, -1},
@@ -76,6 +79,57 @@ protected:
 
     void SetUp() override { ASSERT_EQ(comm.size(), 3); }
 
+    // computes P * A_c * R * x on the host for the given aggregates of the
+    // global rows and returns the rows owned by this rank
+    std::unique_ptr<gko::matrix::Dense<value_type>> two_grid_reference(
+        const std::vector<int>& global_agg, int num_agg,
+        const std::vector<value_type>& x)
+    {
+        std::vector<value_type> coarse_x(num_agg);
+        std::vector<value_type> coarse_y(num_agg);
+        for (int row = 0; row < size[0]; row++) {
+            coarse_x[global_agg[row]] += x[row];
+        }
+        for (const auto& entry : mat_input.nonzeros) {
+            coarse_y[global_agg[entry.row]] +=
+                entry.value * coarse_x[global_agg[entry.column]];
+        }
+        auto begin = row_part->get_range_bounds()[comm.rank()];
+        auto end = row_part->get_range_bounds()[comm.rank() + 1];
+        auto result = gko::matrix::Dense<value_type>::create(
+            exec->get_master(), gko::dim<2>(end - begin, 1));
+        for (auto row = begin; row < end; row++) {
+            result->at(row - begin, 0) = coarse_y[global_agg[row]];
+        }
+        return result;
+    }
+
+    // applies P * A_c * R of the given level to x
+    std::unique_ptr<dist_vec_type> apply_two_grid(
+        const pgm* level, const std::vector<value_type>& x)
+    {
+        auto coarse = gko::as<dist_mtx_type>(level->get_coarse_op());
+        auto local_coarse_size = coarse->get_local_matrix()->get_size()[0];
+        gko::matrix_data<value_type, global_index_type> x_data{
+            gko::dim<2>{size[0], 1}};
+        for (int row = 0; row < size[0]; row++) {
+            x_data.nonzeros.emplace_back(row, 0, x[row]);
+        }
+        auto fine_x = dist_vec_type::create(exec, comm);
+        fine_x->read_distributed(x_data, row_part);
+        auto coarse_x = dist_vec_type::create(
+            exec, comm, gko::dim<2>{coarse->get_size()[0], 1},
+            gko::dim<2>{local_coarse_size, 1});
+        auto coarse_y = gko::clone(coarse_x);
+        auto fine_y = gko::clone(fine_x);
+        level->get_restrict_op()->apply(fine_x, coarse_x);
+        coarse->apply(coarse_x, coarse_y);
+        level->get_prolong_op()->apply(coarse_y, fine_y);
+        return fine_y;
+    }
+
+    std::vector<value_type> fine_x{1, -2, 3, 4, -5, 6, 7, 8};
+
     gko::dim<2> size;
     std::shared_ptr<Partition> row_part;
 
@@ -117,3 +171,132 @@ TYPED_TEST(Pgm, CanGenerateFromDistributedMatrix)
         gko::as<local_matrix_type>(coarse->get_non_local_matrix()),
         res_non_local[rank], r<value_type>::value);
 }
+
+
+TYPED_TEST(Pgm, CanAgglomerateCoarseLevel)
+{
+    using pgm = typename TestFixture::pgm;
+    using value_type = typename TestFixture::value_type;
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    auto pgm_factory = pgm::build()
+                           .with_deterministic(true)
+                           .with_agglomeration_threshold(4u)
+                           .on(this->exec);
+    // aggregates {0, 1}, {2}, {3}, {4, 6}, {5, 7}
+    std::vector<int> global_agg{0, 0, 1, 2, 3, 4, 3, 4};
+    gko::size_type local_coarse_size[] = {5, 0, 0};
+
+    auto result = pgm_factory->generate(this->dist_mat);
+
+    auto coarse = gko::as<dist_mtx_type>(result->get_coarse_op());
+    ASSERT_EQ(coarse->get_size(), gko::dim<2>(5, 5));
+    ASSERT_EQ(coarse->get_local_matrix()->get_size()[0],
+              local_coarse_size[this->comm.rank()]);
+    auto fine_y = this->apply_two_grid(result.get(), this->fine_x);
+    GKO_ASSERT_MTX_NEAR(
+        fine_y->get_local_vector(),
+        this->two_grid_reference(global_agg, 5, this->fine_x),
+        r<value_type>::value);
+}
+
+
+TYPED_TEST(Pgm, KeepsCoarseLevelAboveAgglomerationThreshold)
+{
+    using pgm = typename TestFixture::pgm;
+    using value_type = typename TestFixture::value_type;
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    auto pgm_factory = pgm::build()
+                           .with_deterministic(true)
+                           .with_agglomeration_threshold(1u)
+                           .on(this->exec);
+    std::vector<int> global_agg{0, 0, 1, 2, 3, 4, 3, 4};
+    gko::size_type local_coarse_size[] = {1, 2, 2};
+
+    auto result = pgm_factory->generate(this->dist_mat);
+
+    auto coarse = gko::as<dist_mtx_type>(result->get_coarse_op());
+    ASSERT_EQ(coarse->get_local_matrix()->get_size()[0],
+              local_coarse_size[this->comm.rank()]);
+    auto fine_y = this->apply_two_grid(result.get(), this->fine_x);
+    GKO_ASSERT_MTX_NEAR(
+        fine_y->get_local_vector(),
+        this->two_grid_reference(global_agg, 5, this->fine_x),
+        r<value_type>::value);
+}
+
+
+TYPED_TEST(Pgm, CanGenerateCrossRankAggregates)
+{
+    using pgm = typename TestFixture::pgm;
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    auto pgm_factory = pgm::build()
+                           .with_deterministic(true)
+                           .with_cross_rank_aggregates(true)
+                           .on(this->exec);
+    // rows 2 and 3 are alone on rank 1 and join their strongest neighbors
+    // 0 and 7 on the ranks 0 and 2: {0, 1, 2}, {4, 6}, {3, 5, 7}
+    std::vector<int> global_agg{0, 0, 0, 2, 1, 2, 1, 2};
+    gko::size_type local_coarse_size[] = {1, 0, 2};
+
+    auto result = pgm_factory->generate(this->dist_mat);
+
+    auto coarse = gko::as<dist_mtx_type>(result->get_coarse_op());
+    ASSERT_EQ(coarse->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(coarse->get_local_matrix()->get_size()[0],
+              local_coarse_size[this->comm.rank()]);
+    if (this->comm.rank() == 1) {
+        auto agg = gko::array<local_index_type>::view(
+            this->exec, 2, result->get_agg());
+        GKO_ASSERT_ARRAY_EQ(agg, I<local_index_type>({-1, -1}));
+    }
+    auto fine_y = this->apply_two_grid(result.get(), this->fine_x);
+    GKO_ASSERT_MTX_NEAR(
+        fine_y->get_local_vector(),
+        this->two_grid_reference(global_agg, 3, this->fine_x),
+        r<value_type>::value);
+}
+
+
+TYPED_TEST(Pgm, LogsCoarseLevelRanksAndCommunication)
+{
+    using pgm = typename TestFixture::pgm;
+    auto logger = gko::share(gko::log::Record::create(
+        gko::log::Logger::multigrid_level_generated_mask));
+    auto pgm_factory = pgm::build()
+                           .with_deterministic(true)
+                           .with_agglomeration_threshold(4u)
+                           .with_loggers(logger)
+                           .on(this->exec);
+
+    auto result = pgm_factory->generate(this->dist_mat);
+
+    auto& data = logger->get().multigrid_level_generated;
+    ASSERT_EQ(data.size(), 1);
+    ASSERT_EQ(data[0]->level, result.get());
+    ASSERT_EQ(data[0]->coarse, result->get_coarse_op().get());
+    ASSERT_EQ(data[0]->num_active_ranks, 1);
+    // all coarse rows live on rank 0, so there is nothing to exchange
+    ASSERT_EQ(data[0]->send_volume, 0);
+    ASSERT_EQ(data[0]->recv_volume, 0);
+}
+
+
+TYPED_TEST(Pgm, LogsDistributedCoarseLevel)
+{
+    using pgm = typename TestFixture::pgm;
+    auto logger = gko::share(gko::log::Record::create(
+        gko::log::Logger::multigrid_level_generated_mask));
+    auto pgm_factory = pgm::build().with_loggers(logger).on(this->exec);
+    // number of coarse columns received from the other ranks, see
+    // CanGenerateFromDistributedMatrix
+    gko::size_type recv_volume[] = {4, 3, 3};
+
+    auto result = pgm_factory->generate(this->dist_mat);
+
+    auto& data = logger->get().multigrid_level_generated;
+    ASSERT_EQ(data.size(), 1);
+    ASSERT_EQ(data[0]->num_active_ranks, 3);
+    ASSERT_EQ(data[0]->recv_volume, recv_volume[this->comm.rank()]);
+}
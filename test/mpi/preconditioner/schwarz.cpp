@@ -20,12 +20,15 @@
 #include <ginkgo/core/distributed/partition.hpp>
 #include <ginkgo/core/distributed/preconditioner/schwarz.hpp>
 #include <ginkgo/core/distributed/vector.hpp>
+#include <ginkgo/core/factorization/lu.hpp>
+#include <ginkgo/core/log/convergence.hpp>
 #include <ginkgo/core/log/logger.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/preconditioner/jacobi.hpp>
 #include <ginkgo/core/solver/bicgstab.hpp>
 #include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/solver/direct.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
 
@@ -70,6 +73,10 @@ protected:
         gko::experimental::distributed::Partition<local_index_type,
                                                   global_index_type>;
     using matrix_data = gko::matrix_data<value_type, global_index_type>;
+    using coarse_solver_type =
+        gko::experimental::solver::Direct<value_type, local_index_type>;
+    using coarse_factorization_type =
+        gko::experimental::factorization::Lu<value_type, local_index_type>;
 
 
     SchwarzPreconditioner()
@@ -111,6 +118,78 @@ protected:
 
         local_solver_factory =
             local_prec_type::build().with_max_block_size(1u).on(exec);
+        coarse_solver_factory =
+            coarse_solver_type::build()
+                .with_factorization(coarse_factorization_type::build())
+                .on(exec);
+    }
+
+    // creates a non-distributed coarse basis with num_basis columns per part,
+    // where column j of a part is (i + 1)^j on its i-th local row
+    std::unique_ptr<local_vec_type> create_coarse_basis(int num_basis)
+    {
+        auto host_row_part = row_part->clone(ref);
+        auto num_parts = host_row_part->get_num_parts();
+        auto bounds = host_row_part->get_range_bounds();
+        auto basis = local_vec_type::create(
+            ref, gko::dim<2>{size[0], static_cast<gko::size_type>(
+                                          num_parts * num_basis)});
+        basis->fill(gko::zero<value_type>());
+        for (int part = 0; part < num_parts; ++part) {
+            for (auto row = bounds[part]; row < bounds[part + 1]; ++row) {
+                auto value = gko::one<value_type>();
+                for (int j = 0; j < num_basis; ++j) {
+                    basis->at(row, part * num_basis + j) = value;
+                    value *= static_cast<value_type>(row - bounds[part] + 1);
+                }
+            }
+        }
+        return basis;
+    }
+
+    // extracts the local block of a non-distributed coarse basis
+    std::shared_ptr<dist_vec_type> create_dist_coarse_basis(
+        const local_vec_type* basis, int num_basis)
+    {
+        auto host_row_part = row_part->clone(ref);
+        auto rank = comm.rank();
+        auto bounds = host_row_part->get_range_bounds();
+        auto local_basis = gko::clone(
+            const_cast<local_vec_type*>(basis)->create_submatrix(
+                gko::span{static_cast<gko::size_type>(bounds[rank]),
+                          static_cast<gko::size_type>(bounds[rank + 1])},
+                gko::span{static_cast<gko::size_type>(rank * num_basis),
+                          static_cast<gko::size_type>((rank + 1) *
+                                                      num_basis)}));
+        return dist_vec_type::create(
+            exec, comm,
+            gko::dim<2>{size[0], static_cast<gko::size_type>(num_basis)},
+            gko::clone(exec, local_basis));
+    }
+
+    // computes the coarse correction Z (Z^T A Z)^{-1} Z^T b on the
+    // non-distributed matrix
+    std::unique_ptr<local_vec_type> compute_coarse_correction(
+        const local_vec_type* basis)
+    {
+        auto restriction = gko::as<local_vec_type>(basis->transpose());
+        auto a_basis = local_vec_type::create(ref, basis->get_size());
+        non_dist_mat->apply(basis, a_basis);
+        auto coarse_dense = local_vec_type::create(
+            ref, gko::dim<2>{basis->get_size()[1], basis->get_size()[1]});
+        restriction->apply(a_basis, coarse_dense);
+        auto coarse_mat = gko::share(local_matrix_type::create(exec));
+        coarse_dense->convert_to(coarse_mat);
+        auto coarse_b = local_vec_type::create(
+            ref, gko::dim<2>{basis->get_size()[1], non_dist_b->get_size()[1]});
+        auto coarse_x = coarse_b->clone();
+        coarse_x->fill(gko::zero<value_type>());
+        restriction->apply(non_dist_b, coarse_b);
+        coarse_solver_factory->generate(coarse_mat)->apply(coarse_b,
+                                                           coarse_x);
+        auto correction = local_vec_type::create(ref, non_dist_b->get_size());
+        basis->apply(coarse_x, correction);
+        return correction;
     }
 
     void SetUp() override { ASSERT_EQ(comm.size(), 3); }
@@ -129,6 +208,7 @@ protected:
     std::shared_ptr<gko::LinOpFactory> non_dist_solver_factory;
     std::shared_ptr<gko::LinOpFactory> dist_solver_factory;
     std::shared_ptr<gko::LinOpFactory> local_solver_factory;
+    std::shared_ptr<gko::LinOpFactory> coarse_solver_factory;
 
     void assert_equal_to_non_distributed_vector(
         std::shared_ptr<dist_vec_type> dist_vec,
@@ -300,3 +380,162 @@ TYPED_TEST(SchwarzPreconditioner, CanAdvancedApplyPreconditioner)
     this->assert_equal_to_non_distributed_vector(this->dist_x,
                                                  this->non_dist_x);
 }
+
+
+TYPED_TEST(SchwarzPreconditioner, CanApplyPreconditionerWithCoarseCorrection)
+{
+    using value_type = typename TestFixture::value_type;
+    using vec = typename TestFixture::local_vec_type;
+    using prec = typename TestFixture::dist_prec_type;
+
+    auto precond_factory = prec::build()
+                               .with_local_solver(this->local_solver_factory)
+                               .with_coarse_solver(this->coarse_solver_factory)
+                               .on(this->exec);
+    auto local_precond =
+        this->local_solver_factory->generate(this->non_dist_mat);
+    auto precond = precond_factory->generate(this->dist_mat);
+    auto correction =
+        this->compute_coarse_correction(this->create_coarse_basis(1).get());
+    auto one = gko::initialize<vec>({gko::one<value_type>()}, this->exec);
+
+    precond->apply(this->dist_b.get(), this->dist_x.get());
+    local_precond->apply(this->non_dist_b.get(), this->non_dist_x.get());
+    this->non_dist_x->add_scaled(one, correction);
+
+    this->assert_equal_to_non_distributed_vector(this->dist_x,
+                                                 this->non_dist_x);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, CanApplyPreconditionerWithCoarseBasis)
+{
+    using value_type = typename TestFixture::value_type;
+    using vec = typename TestFixture::local_vec_type;
+    using prec = typename TestFixture::dist_prec_type;
+    auto basis = this->create_coarse_basis(2);
+
+    auto precond =
+        prec::build()
+            .with_local_solver(this->local_solver_factory)
+            .with_coarse_solver(this->coarse_solver_factory)
+            .with_coarse_basis(this->create_dist_coarse_basis(basis.get(), 2))
+            .on(this->exec)
+            ->generate(this->dist_mat);
+    auto local_precond =
+        this->local_solver_factory->generate(this->non_dist_mat);
+    auto correction = this->compute_coarse_correction(basis.get());
+    auto one = gko::initialize<vec>({gko::one<value_type>()}, this->exec);
+
+    precond->apply(this->dist_b.get(), this->dist_x.get());
+    local_precond->apply(this->non_dist_b.get(), this->non_dist_x.get());
+    this->non_dist_x->add_scaled(one, correction);
+
+    this->assert_equal_to_non_distributed_vector(this->dist_x,
+                                                 this->non_dist_x);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, GenerateFailsIfCoarseBasisSizesDiffer)
+{
+    using prec = typename TestFixture::dist_prec_type;
+    using dist_vec_type = typename TestFixture::dist_vec_type;
+    using local_vec_type = typename TestFixture::local_vec_type;
+    auto local_size = this->dist_b->get_local_vector()->get_size()[0];
+    gko::size_type num_basis = this->comm.rank() == 0 ? 2 : 1;
+    auto local_basis =
+        local_vec_type::create(this->exec, gko::dim<2>{local_size, num_basis});
+    local_basis->fill(gko::one<typename TestFixture::value_type>());
+    auto basis = gko::share(dist_vec_type::create(
+        this->exec, this->comm, gko::dim<2>{this->size[0], num_basis},
+        std::move(local_basis)));
+    auto precond_factory = prec::build()
+                               .with_local_solver(this->local_solver_factory)
+                               .with_coarse_solver(this->coarse_solver_factory)
+                               .with_coarse_basis(basis)
+                               .on(this->exec);
+
+    ASSERT_THROW(precond_factory->generate(this->dist_mat),
+                 gko::InvalidStateError);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, CoarseCorrectionRejectsNonDistributedInput)
+{
+    using prec = typename TestFixture::dist_prec_type;
+    auto precond = prec::build()
+                       .with_local_solver(this->local_solver_factory)
+                       .with_coarse_solver(this->coarse_solver_factory)
+                       .on(this->exec)
+                       ->generate(this->dist_mat);
+
+    ASSERT_THROW(precond->apply(this->non_dist_b, this->non_dist_x),
+                 gko::NotSupported);
+}
+
+
+TYPED_TEST(SchwarzPreconditioner, CoarseCorrectionReducesIterationCount)
+{
+    using value_type = typename TestFixture::value_type;
+    using local_index_type = typename TestFixture::local_index_type;
+    using global_index_type = typename TestFixture::global_index_type;
+    using dist_mtx_type = typename TestFixture::dist_mtx_type;
+    using dist_vec_type = typename TestFixture::dist_vec_type;
+    using prec = typename TestFixture::dist_prec_type;
+    using Partition = typename TestFixture::Partition;
+    using solver_type = gko::solver::Cg<value_type>;
+    // 1D Laplacian with many rows per subdomain
+    const global_index_type num_rows = 90;
+    gko::matrix_data<value_type, global_index_type> data{
+        gko::dim<2>{static_cast<gko::size_type>(num_rows)}};
+    for (global_index_type row = 0; row < num_rows; ++row) {
+        if (row > 0) {
+            data.nonzeros.emplace_back(row, row - 1, -1.0);
+        }
+        data.nonzeros.emplace_back(row, row, 2.0);
+        if (row < num_rows - 1) {
+            data.nonzeros.emplace_back(row, row + 1, -1.0);
+        }
+    }
+    auto part = gko::share(Partition::build_from_global_size_uniform(
+        this->exec, this->comm.size(), num_rows));
+    auto mat = gko::share(dist_mtx_type::create(this->exec, this->comm));
+    mat->read_distributed(data, part);
+    auto b = dist_vec_type::create(
+        this->exec, this->comm, gko::dim<2>{data.size[0], 1},
+        gko::dim<2>{static_cast<gko::size_type>(
+                        part->get_part_size(this->comm.rank())),
+                    1});
+    b->fill(gko::one<value_type>());
+    auto solve = [&](bool use_coarse) {
+        auto prec_factory = prec::build()
+                                .with_local_solver(this->local_solver_factory)
+                                .on(this->exec);
+        if (use_coarse) {
+            prec_factory = prec::build()
+                               .with_local_solver(this->local_solver_factory)
+                               .with_coarse_solver(this->coarse_solver_factory)
+                               .on(this->exec);
+        }
+        auto logger = gko::share(gko::log::Convergence<value_type>::create());
+        auto solver =
+            solver_type::build()
+                .with_generated_preconditioner(prec_factory->generate(mat))
+                .with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(200u),
+                    gko::stop::ResidualNorm<value_type>::build()
+                        .with_reduction_factor(r<value_type>::value))
+                .on(this->exec)
+                ->generate(mat);
+        solver->add_logger(logger);
+        auto x = gko::clone(b);
+        x->fill(gko::zero<value_type>());
+        solver->apply(b, x);
+        return logger->get_num_iterations();
+    };
+
+    auto one_level_iters = solve(false);
+    auto two_level_iters = solve(true);
+
+    ASSERT_LT(two_level_iters, one_level_iters);
+}
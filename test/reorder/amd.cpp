@@ -5,7 +5,9 @@
 #include <algorithm>
 #include <initializer_list>
 #include <memory>
+#include <numeric>
 #include <random>
+#include <vector>
 
 
 #include <gtest/gtest.h>
@@ -15,6 +17,7 @@
 #include <ginkgo/core/reorder/amd.hpp>
 
 
+#include "core/factorization/symbolic.hpp"
 #include "core/test/utils.hpp"
 #include "core/test/utils/unsort_matrix.hpp"
 #include "matrices/config.hpp"
@@ -30,6 +33,7 @@ protected:
         typename std::tuple_element<1, decltype(ValueIndexType())>::type;
     using matrix_type = gko::matrix::Csr<value_type, index_type>;
     using reorder_type = gko::experimental::reorder::Amd<index_type>;
+    using permutation_type = gko::matrix::Permutation<index_type>;
 
     Amd() : rng{63420}
     {
@@ -38,6 +42,39 @@ protected:
         dmtx = gko::clone(exec, mtx);
     }
 
+    // returns the number of fill-in entries of the Cholesky factor of mtx
+    // after applying the permutation
+    gko::size_type get_fillin(const permutation_type* permutation)
+    {
+        auto permuted_mtx = mtx->permute(permutation);
+        std::unique_ptr<gko::factorization::elimination_forest<index_type>>
+            forest;
+        std::unique_ptr<matrix_type> factorized_mtx;
+        gko::factorization::symbolic_cholesky(permuted_mtx.get(), true,
+                                              factorized_mtx, forest);
+        return factorized_mtx->get_num_stored_elements() -
+               permuted_mtx->get_num_stored_elements();
+    }
+
+    // checks that the permutation computed on exec is valid and leads to a
+    // fill-in comparable to the one computed on ref
+    void assert_reduces_fillin_like_ref(const permutation_type* perm,
+                                        const permutation_type* dperm)
+    {
+        const auto num_rows = mtx->get_size()[0];
+        auto host_dperm = gko::clone(ref, dperm);
+        std::vector<index_type> sorted(
+            host_dperm->get_const_permutation(),
+            host_dperm->get_const_permutation() + num_rows);
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<index_type> identity(num_rows);
+        std::iota(identity.begin(), identity.end(), index_type{});
+        ASSERT_EQ(sorted, identity);
+        const auto fillin = get_fillin(perm);
+        const auto dfillin = get_fillin(host_dperm.get());
+        ASSERT_LE(dfillin, fillin * 3 / 2);
+    }
+
     std::default_random_engine rng;
     std::shared_ptr<matrix_type> mtx;
     std::shared_ptr<matrix_type> dmtx;
@@ -46,7 +83,7 @@ protected:
 TYPED_TEST_SUITE(Amd, gko::test::ValueIndexTypes, PairTypenameNameGenerator);
 
 
-TYPED_TEST(Amd, IsEquivalentToRef)
+TYPED_TEST(Amd, ReducesFillInLikeRef)
 {
     using reorder_type = typename TestFixture::reorder_type;
     auto factory = reorder_type::build().on(this->ref);
@@ -55,15 +92,11 @@ TYPED_TEST(Amd, IsEquivalentToRef)
     auto perm = factory->generate(this->mtx);
     auto dperm = dfactory->generate(this->dmtx);
 
-    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
-                                           perm->get_permutation());
-    auto dperm_array = gko::make_array_view(
-        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
-    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+    this->assert_reduces_fillin_like_ref(perm.get(), dperm.get());
 }
 
 
-TYPED_TEST(Amd, IsEquivalentToRefWithSkipSorting)
+TYPED_TEST(Amd, ReducesFillInLikeRefWithSkipSorting)
 {
     using reorder_type = typename TestFixture::reorder_type;
     auto factory = reorder_type::build().on(this->ref);
@@ -73,15 +106,11 @@ TYPED_TEST(Amd, IsEquivalentToRefWithSkipSorting)
     auto perm = factory->generate(this->mtx);
     auto dperm = dfactory->generate(this->dmtx);
 
-    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
-                                           perm->get_permutation());
-    auto dperm_array = gko::make_array_view(
-        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
-    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+    this->assert_reduces_fillin_like_ref(perm.get(), dperm.get());
 }
 
 
-TYPED_TEST(Amd, IsEquivalentToRefWithSkipSymmetrizeSorting)
+TYPED_TEST(Amd, ReducesFillInLikeRefWithSkipSymmetrizeSorting)
 {
     using reorder_type = typename TestFixture::reorder_type;
     auto factory = reorder_type::build().on(this->ref);
@@ -93,15 +122,11 @@ TYPED_TEST(Amd, IsEquivalentToRefWithSkipSymmetrizeSorting)
     auto perm = factory->generate(this->mtx);
     auto dperm = dfactory->generate(this->dmtx);
 
-    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
-                                           perm->get_permutation());
-    auto dperm_array = gko::make_array_view(
-        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
-    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+    this->assert_reduces_fillin_like_ref(perm.get(), dperm.get());
 }
 
 
-TYPED_TEST(Amd, IsEquivalentToRefWithSkipSymmetrize)
+TYPED_TEST(Amd, ReducesFillInLikeRefWithSkipSymmetrize)
 {
     using reorder_type = typename TestFixture::reorder_type;
     auto factory = reorder_type::build().on(this->ref);
@@ -111,15 +136,11 @@ TYPED_TEST(Amd, IsEquivalentToRefWithSkipSymmetrize)
     auto perm = factory->generate(this->mtx);
     auto dperm = dfactory->generate(this->dmtx);
 
-    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
-                                           perm->get_permutation());
-    auto dperm_array = gko::make_array_view(
-        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
-    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+    this->assert_reduces_fillin_like_ref(perm.get(), dperm.get());
 }
 
 
-TYPED_TEST(Amd, IsEquivalentToRefUnsorted)
+TYPED_TEST(Amd, ReducesFillInLikeRefUnsorted)
 {
     using reorder_type = typename TestFixture::reorder_type;
     auto factory = reorder_type::build().on(this->ref);
@@ -129,15 +150,11 @@ TYPED_TEST(Amd, IsEquivalentToRefUnsorted)
     auto perm = factory->generate(this->mtx);
     auto dperm = dfactory->generate(this->dmtx);
 
-    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
-                                           perm->get_permutation());
-    auto dperm_array = gko::make_array_view(
-        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
-    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+    this->assert_reduces_fillin_like_ref(perm.get(), dperm.get());
 }
 
 
-TYPED_TEST(Amd, IsEquivalentToRefUnsortedSkipSymmetrize)
+TYPED_TEST(Amd, ReducesFillInLikeRefUnsortedSkipSymmetrize)
 {
     using reorder_type = typename TestFixture::reorder_type;
     auto factory = reorder_type::build().on(this->ref);
@@ -148,9 +165,22 @@ TYPED_TEST(Amd, IsEquivalentToRefUnsortedSkipSymmetrize)
     auto perm = factory->generate(this->mtx);
     auto dperm = dfactory->generate(this->dmtx);
 
-    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
-                                           perm->get_permutation());
-    auto dperm_array = gko::make_array_view(
-        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
-    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+    this->assert_reduces_fillin_like_ref(perm.get(), dperm.get());
+}
+
+
+TYPED_TEST(Amd, IsDeterministic)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    auto dfactory = reorder_type::build().on(this->exec);
+
+    auto dperm = dfactory->generate(this->dmtx);
+    auto dperm2 = dfactory->generate(this->dmtx);
+
+    const auto num_rows = this->mtx->get_size()[0];
+    auto dperm_array = gko::make_array_view(this->exec, num_rows,
+                                            dperm->get_permutation());
+    auto dperm2_array = gko::make_array_view(this->exec, num_rows,
+                                             dperm2->get_permutation());
+    GKO_ASSERT_ARRAY_EQ(dperm_array, dperm2_array);
 }
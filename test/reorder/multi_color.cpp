@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <fstream>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/reorder/multi_color.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "matrices/config.hpp"
+#include "test/utils/executor.hpp"
+
+
+template <typename ValueIndexType>
+class MultiColor : public CommonTestFixture {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    using reorder_type = gko::experimental::reorder::MultiColor<index_type>;
+    using distance = gko::experimental::reorder::multi_color_distance;
+
+    MultiColor() : color_ptrs{ref}, dcolor_ptrs{exec}
+    {
+        std::ifstream stream{gko::matrices::location_ani4_mtx};
+        mtx = gko::read<matrix_type>(stream, ref);
+        dmtx = gko::clone(exec, mtx);
+    }
+
+    void assert_equivalent_to_ref(typename reorder_type::parameters_type params)
+    {
+        auto factory = params.on(ref);
+        auto dfactory = params.on(exec);
+
+        auto perm = factory->generate(mtx, color_ptrs);
+        auto dperm = dfactory->generate(dmtx, dcolor_ptrs);
+
+        auto perm_array = gko::make_array_view(ref, mtx->get_size()[0],
+                                               perm->get_permutation());
+        auto dperm_array = gko::make_array_view(exec, mtx->get_size()[0],
+                                                dperm->get_permutation());
+        GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+        GKO_ASSERT_ARRAY_EQ(color_ptrs, dcolor_ptrs);
+    }
+
+    std::shared_ptr<matrix_type> mtx;
+    std::shared_ptr<matrix_type> dmtx;
+    gko::array<index_type> color_ptrs;
+    gko::array<index_type> dcolor_ptrs;
+};
+
+TYPED_TEST_SUITE(MultiColor, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(MultiColor, IsEquivalentToRef)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+
+    this->assert_equivalent_to_ref(reorder_type::build());
+}
+
+
+TYPED_TEST(MultiColor, IsEquivalentToRefWithSkipSymmetrize)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+
+    this->assert_equivalent_to_ref(
+        reorder_type::build().with_skip_symmetrize(true));
+}
+
+
+TYPED_TEST(MultiColor, IsEquivalentToRefDistanceTwo)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    using distance = typename TestFixture::distance;
+
+    this->assert_equivalent_to_ref(
+        reorder_type::build().with_distance(distance::two));
+}
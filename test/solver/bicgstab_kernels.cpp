@@ -249,6 +249,28 @@ TEST_F(Bicgstab, BicgstabStep3IsEquivalentToRef)
 }
 
 
+TEST_F(Bicgstab, BicgstabStep3AndDotIsEquivalentToRef)
+{
+    initialize_data();
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::bicgstab::step_3_and_dot(
+        ref, x.get(), r.get(), s.get(), t.get(), y.get(), z.get(), rr.get(),
+        alpha.get(), beta.get(), gamma.get(), omega.get(), prev_rho.get(), tmp,
+        stop_status.get());
+    gko::kernels::EXEC_NAMESPACE::bicgstab::step_3_and_dot(
+        exec, d_x.get(), d_r.get(), d_s.get(), d_t.get(), d_y.get(), d_z.get(),
+        d_rr.get(), d_alpha.get(), d_beta.get(), d_gamma.get(), d_omega.get(),
+        d_prev_rho.get(), d_tmp, d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_omega, omega, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_r, r, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_prev_rho, prev_rho, ::r<value_type>::value);
+}
+
+
 TEST_F(Bicgstab, BicgstabApplyOneRHSIsEquivalentToRef)
 {
     int m = 123;
@@ -160,6 +160,24 @@ TEST_F(Cg, CgStep2IsEquivalentToRef)
 }
 
 
+TEST_F(Cg, CgStep2AndDotIsEquivalentToRef)
+{
+    initialize_data();
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+    gko::kernels::reference::cg::step_2_and_dot(
+        ref, x.get(), r.get(), p.get(), q.get(), beta.get(), rho.get(),
+        prev_rho.get(), tmp, stop_status.get());
+    gko::kernels::EXEC_NAMESPACE::cg::step_2_and_dot(
+        exec, d_x.get(), d_r.get(), d_p.get(), d_q.get(), d_beta.get(),
+        d_rho.get(), d_prev_rho.get(), d_tmp, d_stop_status.get());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_r, r, ::r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_prev_rho, prev_rho, ::r<value_type>::value);
+}
+
+
 TEST_F(Cg, ApplyIsEquivalentToRef)
 {
     auto data = gko::matrix_data<value_type, index_type>(
@@ -195,6 +195,28 @@ TEST_F(Gcr, GcrStep1IsEquivalentToRef)
 }
 
 
+TEST_F(Gcr, GcrStep1AndNormIsEquivalentToRef)
+{
+    initialize_data();
+    auto residual_norm = gen_mtx(1, x->get_size()[1]);
+    auto d_residual_norm = gko::clone(exec, residual_norm);
+    gko::array<char> tmp{ref};
+    gko::array<char> d_tmp{exec};
+
+    gko::kernels::reference::gcr::step_1_and_norm(
+        ref, x.get(), residual.get(), p.get(), Ap.get(), Ap_norm.get(),
+        rAp.get(), residual_norm.get(), tmp, stop_status.get_data());
+    gko::kernels::EXEC_NAMESPACE::gcr::step_1_and_norm(
+        exec, d_x.get(), d_residual.get(), d_p.get(), d_Ap.get(),
+        d_Ap_norm.get(), d_rAp.get(), d_residual_norm.get(), d_tmp,
+        d_stop_status.get_data());
+
+    GKO_ASSERT_MTX_NEAR(d_x, x, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_residual, residual, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(d_residual_norm, residual_norm, r<value_type>::value);
+}
+
+
 TEST_F(Gcr, GcrApplyOneRHSIsEquivalentToRef)
 {
     int m = 123;